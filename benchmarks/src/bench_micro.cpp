@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <orderedgoalsplanner/types/condition.hpp>
+#include <orderedgoalsplanner/types/domain.hpp>
+#include <orderedgoalsplanner/types/problem.hpp>
+#include <orderedgoalsplanner/types/setofcallbacks.hpp>
+#include "generateddomains.hpp"
+
+using namespace ogp;
+
+namespace
+{
+const SetOfCallbacks _callbacks;
+
+
+std::vector<Fact> _facts(const DomainAndProblemPtrs& pDomainAndProblemPtrs,
+                         const std::string& pFormat,
+                         std::size_t pNbOfFacts)
+{
+  std::vector<Fact> res;
+  const auto& ontology = pDomainAndProblemPtrs.domainPtr->getOntology();
+  const auto& entities = pDomainAndProblemPtrs.problemPtr->entities;
+  for (std::size_t i = 0; i < pNbOfFacts; ++i)
+  {
+    auto factStr = pFormat;
+    auto indexPos = factStr.find('#');
+    while (indexPos != std::string::npos)
+    {
+      factStr.replace(indexPos, 1, std::to_string(i));
+      indexPos = factStr.find('#');
+    }
+    res.emplace_back(factStr, true, ontology, entities, std::vector<Parameter>());
+  }
+  return res;
+}
+
+}
+
+
+/// Find exact facts and facts with a parameter in a world with N boxes.
+static void BM_SetOfFactsFind(benchmark::State& state)
+{
+  auto nbOfBoxes = static_cast<std::size_t>(state.range(0));
+  auto domainAndProblemPtrs = loadGeneratedPddl(generateWarehouse(1, nbOfBoxes));
+  const auto& ontology = domainAndProblemPtrs.domainPtr->getOntology();
+  const auto& problem = *domainAndProblemPtrs.problemPtr;
+  const auto& setOfFacts = problem.worldState.factsMapping();
+  Parameter boxParameter("?b", ontology.types.nameToType("box"));
+  Fact factWithParameter("(box-at ?b shelf" + std::to_string(nbOfBoxes / 2) + ")", true,
+                         ontology, problem.entities, {boxParameter});
+  auto exactFacts = _facts(domainAndProblemPtrs, "(box-at box# shelf#)", nbOfBoxes);
+
+  std::size_t i = 0;
+  for (auto _ : state)
+  {
+    for (const auto& currFact : setOfFacts.find(exactFacts[i++ % exactFacts.size()]))
+      benchmark::DoNotOptimize(&currFact);
+    for (const auto& currFact : setOfFacts.find(factWithParameter))
+      benchmark::DoNotOptimize(&currFact);
+  }
+}
+BENCHMARK(BM_SetOfFactsFind)->RangeMultiplier(8)->Range(8, 4096);
+
+
+/// Add N facts in a world state that has no event.
+static void BM_WorldStateAddFacts(benchmark::State& state)
+{
+  auto nbOfBalls = static_cast<std::size_t>(state.range(0));
+  auto domainAndProblemPtrs = loadGeneratedPddl(generateGripper(nbOfBalls));
+  const auto& domain = *domainAndProblemPtrs.domainPtr;
+  const auto& problem = *domainAndProblemPtrs.problemPtr;
+  auto factsToAdd = _facts(domainAndProblemPtrs, "(at ball# roomb)", nbOfBalls);
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    Problem problemCopy = problem;
+    state.ResumeTiming();
+    problemCopy.worldState.addFacts(factsToAdd, problemCopy.goalStack, domain.getSetOfEvents(), _callbacks,
+                                    domain.getOntology(), problemCopy.entities, {});
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nbOfBalls));
+}
+BENCHMARK(BM_WorldStateAddFacts)->RangeMultiplier(8)->Range(8, 4096);
+
+
+/// Evaluate a condition with a free parameter in a world with N boxes.
+static void BM_ConditionIsTrue(benchmark::State& state)
+{
+  auto nbOfBoxes = static_cast<std::size_t>(state.range(0));
+  auto domainAndProblemPtrs = loadGeneratedPddl(generateWarehouse(1, nbOfBoxes));
+  const auto& ontology = domainAndProblemPtrs.domainPtr->getOntology();
+  const auto& problem = *domainAndProblemPtrs.problemPtr;
+  std::string conditionPddl = "(and (exists (?b - box) (box-at ?b shelf" + std::to_string(nbOfBoxes - 1) + ")) (free robot0))";
+  std::size_t pos = 0;
+  auto condition = pddlToCondition(conditionPddl, pos, ontology, problem.entities, {});
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(condition->isTrue(problem.worldState, ontology.constants, problem.entities));
+}
+BENCHMARK(BM_ConditionIsTrue)->RangeMultiplier(8)->Range(8, 4096);
+
+
+/// Sort N facts, it is dominated by Fact::operator<.
+static void BM_FactLess(benchmark::State& state)
+{
+  auto nbOfBoxes = static_cast<std::size_t>(state.range(0));
+  auto domainAndProblemPtrs = loadGeneratedPddl(generateWarehouse(1, nbOfBoxes));
+  auto facts = _facts(domainAndProblemPtrs, "(box-at box# shelf#)", nbOfBoxes);
+  std::reverse(facts.begin(), facts.end());
+  std::vector<const Fact*> factPtrs;
+  for (const auto& currFact : facts)
+    factPtrs.emplace_back(&currFact);
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    auto factPtrsToSort = factPtrs;
+    state.ResumeTiming();
+    std::sort(factPtrsToSort.begin(), factPtrsToSort.end(),
+              [](const Fact* pFact1, const Fact* pFact2) { return *pFact1 < *pFact2; });
+    benchmark::DoNotOptimize(factPtrsToSort.data());
+  }
+}
+BENCHMARK(BM_FactLess)->RangeMultiplier(8)->Range(8, 4096);
+
+
+/// Move N boxes to the dock in one modification, an event marks each of them as delivered.
+static void BM_EventPropagation(benchmark::State& state)
+{
+  auto nbOfBoxes = static_cast<std::size_t>(state.range(0));
+  auto domainAndProblemPtrs = loadGeneratedPddl(generateWarehouse(1, nbOfBoxes));
+  const auto& domain = *domainAndProblemPtrs.domainPtr;
+  const auto& problem = *domainAndProblemPtrs.problemPtr;
+  auto factsToAdd = _facts(domainAndProblemPtrs, "(box-at box# dock)", nbOfBoxes);
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    Problem problemCopy = problem;
+    state.ResumeTiming();
+    problemCopy.worldState.addFacts(factsToAdd, problemCopy.goalStack, domain.getSetOfEvents(), _callbacks,
+                                    domain.getOntology(), problemCopy.entities, {});
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nbOfBoxes));
+}
+BENCHMARK(BM_EventPropagation)->RangeMultiplier(8)->Range(8, 512);
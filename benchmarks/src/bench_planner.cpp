@@ -0,0 +1,182 @@
+#include <benchmark/benchmark.h>
+#include <orderedgoalsplanner/types/domain.hpp>
+#include <orderedgoalsplanner/types/parallelplan.hpp>
+#include <orderedgoalsplanner/types/problem.hpp>
+#include <orderedgoalsplanner/types/setofcallbacks.hpp>
+#include <orderedgoalsplanner/orderedgoalsplanner.hpp>
+#include "generateddomains.hpp"
+
+using namespace ogp;
+
+namespace
+{
+const SetOfCallbacks _callbacks;
+const std::unique_ptr<std::chrono::steady_clock::time_point> _now;
+/// To stop the step by step planning if the planner loops.
+const std::size_t _maxNbOfSteps = 10000;
+
+
+GeneratedPddl _generate(benchmark::State& pState,
+                        GeneratedPddl (*pGenerator)(std::size_t, std::size_t))
+{
+  return pGenerator(static_cast<std::size_t>(pState.range(0)), static_cast<std::size_t>(pState.range(1)));
+}
+
+GeneratedPddl _generateGripper(benchmark::State& pState)
+{
+  return generateGripper(static_cast<std::size_t>(pState.range(0)));
+}
+
+
+ParallelPan _toParallelPlan(std::list<ActionInvocationWithGoal>&& pPlan)
+{
+  ParallelPan res;
+  for (auto& currAction : pPlan)
+  {
+    res.actionsToDoInParallel.emplace_back();
+    res.actionsToDoInParallel.back().actions.emplace_back(std::move(currAction));
+  }
+  return res;
+}
+
+
+/// Skip the benchmark with an error if the plan is empty, cannot be done or does not satisfy all the goals.
+void _skipIfNotASolution(benchmark::State& pState,
+                         const ParallelPan& pPlan,
+                         const DomainAndProblemPtrs& pDomainAndProblemPtrs)
+{
+  if (pPlan.actionsToDoInParallel.empty())
+  {
+    pState.SkipWithError("No plan found");
+    return;
+  }
+  const auto& domain = *pDomainAndProblemPtrs.domainPtr;
+  const auto& initialProblem = *pDomainAndProblemPtrs.problemPtr;
+  auto validationResult = validatePlan(pPlan, initialProblem, domain);
+  if (!validationResult.isValid())
+  {
+    pState.SkipWithError(("Invalid plan: " + validationResult.toStr()).c_str());
+    return;
+  }
+
+  Problem problem = initialProblem;
+  for (const auto& currActionsToDoInParallel : pPlan.actionsToDoInParallel)
+    for (const auto& currAction : currActionsToDoInParallel.actions)
+      notifyActionDone(problem, domain, _callbacks, currAction, _now);
+  const auto& constants = domain.getOntology().constants;
+  for (const auto& currGoalsWithPriority : initialProblem.goalStack.goals())
+  {
+    for (const auto& currGoal : currGoalsWithPriority.second)
+    {
+      if (!problem.worldState.isGoalSatisfied(currGoal, constants, problem.entities))
+      {
+        pState.SkipWithError(("Goal not satisfied by the plan: " + currGoal.toStr()).c_str());
+        return;
+      }
+    }
+  }
+}
+
+
+void _planForEveryGoals(benchmark::State& pState,
+                        const GeneratedPddl& pGeneratedPddl)
+{
+  auto domainAndProblemPtrs = loadGeneratedPddl(pGeneratedPddl);
+  const auto& domain = *domainAndProblemPtrs.domainPtr;
+  std::list<ActionInvocationWithGoal> plan;
+  for (auto _ : pState)
+  {
+    pState.PauseTiming();
+    Problem problem = *domainAndProblemPtrs.problemPtr;
+    pState.ResumeTiming();
+    plan = planForEveryGoals(problem, domain, _now);
+  }
+  pState.counters["steps"] = static_cast<double>(plan.size());
+  _skipIfNotASolution(pState, _toParallelPlan(std::move(plan)), domainAndProblemPtrs);
+}
+
+
+/// Ask the next action and notify that it is done until the goals are satisfied, as a robot would do.
+void _planStepByStep(benchmark::State& pState,
+                     const GeneratedPddl& pGeneratedPddl)
+{
+  auto domainAndProblemPtrs = loadGeneratedPddl(pGeneratedPddl);
+  const auto& domain = *domainAndProblemPtrs.domainPtr;
+  std::list<ActionInvocationWithGoal> actionsDone;
+  for (auto _ : pState)
+  {
+    pState.PauseTiming();
+    Problem problem = *domainAndProblemPtrs.problemPtr;
+    actionsDone.clear();
+    pState.ResumeTiming();
+    while (actionsDone.size() < _maxNbOfSteps)
+    {
+      auto plan = planForMoreImportantGoalPossible(problem, domain, true, _now);
+      if (plan.empty())
+        break;
+      notifyActionDone(problem, domain, _callbacks, plan.front(), _now);
+      actionsDone.splice(actionsDone.end(), plan, plan.begin());
+    }
+  }
+  pState.counters["steps"] = static_cast<double>(actionsDone.size());
+  _skipIfNotASolution(pState, _toParallelPlan(std::move(actionsDone)), domainAndProblemPtrs);
+}
+
+
+void _parallelPlanForEveryGoals(benchmark::State& pState,
+                                const GeneratedPddl& pGeneratedPddl)
+{
+  auto domainAndProblemPtrs = loadGeneratedPddl(pGeneratedPddl);
+  const auto& domain = *domainAndProblemPtrs.domainPtr;
+  ParallelPan plan;
+  for (auto _ : pState)
+  {
+    pState.PauseTiming();
+    Problem problem = *domainAndProblemPtrs.problemPtr;
+    pState.ResumeTiming();
+    plan = parallelPlanForEveryGoals(problem, domain, _now, nullptr);
+  }
+  pState.counters["parallel_steps"] = static_cast<double>(plan.actionsToDoInParallel.size());
+  _skipIfNotASolution(pState, plan, domainAndProblemPtrs);
+}
+}
+
+
+static void BM_PlanForEveryGoals_Gripper(benchmark::State& state)
+{
+  _planForEveryGoals(state, _generateGripper(state));
+}
+BENCHMARK(BM_PlanForEveryGoals_Gripper)->ArgName("balls")
+    ->DenseRange(2, 10, 2)->Unit(benchmark::kMillisecond);
+
+
+static void BM_PlanForEveryGoals_Warehouse(benchmark::State& state)
+{
+  _planForEveryGoals(state, _generate(state, generateWarehouse));
+}
+BENCHMARK(BM_PlanForEveryGoals_Warehouse)->ArgNames({"robots", "boxes"})
+    ->Args({1, 4})->Args({1, 16})->Args({2, 16})->Args({4, 16})->Args({4, 32})->Unit(benchmark::kMillisecond);
+
+
+static void BM_PlanStepByStep_Gripper(benchmark::State& state)
+{
+  _planStepByStep(state, _generateGripper(state));
+}
+BENCHMARK(BM_PlanStepByStep_Gripper)->ArgName("balls")
+    ->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond);
+
+
+static void BM_PlanStepByStep_Warehouse(benchmark::State& state)
+{
+  _planStepByStep(state, _generate(state, generateWarehouse));
+}
+BENCHMARK(BM_PlanStepByStep_Warehouse)->ArgNames({"robots", "boxes"})
+    ->Args({2, 8})->Args({4, 16})->Unit(benchmark::kMillisecond);
+
+
+static void BM_ParallelPlanForEveryGoals_Warehouse(benchmark::State& state)
+{
+  _parallelPlanForEveryGoals(state, _generate(state, generateWarehouse));
+}
+BENCHMARK(BM_ParallelPlanForEveryGoals_Warehouse)->ArgNames({"robots", "boxes"})
+    ->Args({2, 8})->Args({4, 16})->Unit(benchmark::kMillisecond);
@@ -0,0 +1,141 @@
+#include "generateddomains.hpp"
+#include <map>
+#include <orderedgoalsplanner/types/domain.hpp>
+#include <orderedgoalsplanner/types/problem.hpp>
+
+
+namespace ogp
+{
+namespace
+{
+
+std::string _objectName(const std::string& pPrefix,
+                        std::size_t pIndex)
+{
+  return pPrefix + std::to_string(pIndex);
+}
+
+}
+
+
+GeneratedPddl generateGripper(std::size_t pNbOfBalls)
+{
+  GeneratedPddl res;
+  res.domain = R"((define (domain gripper)
+  (:requirements :strips :typing)
+  (:types room ball gripper)
+  (:predicates
+    (at-robby ?r - room)
+    (at ?b - ball ?r - room)
+    (free ?g - gripper)
+    (carry ?b - ball ?g - gripper)
+  )
+  (:action move
+    :parameters (?from - room ?to - room)
+    :precondition (at-robby ?from)
+    :effect (and (at-robby ?to) (not (at-robby ?from)))
+  )
+  (:action pick
+    :parameters (?b - ball ?r - room ?g - gripper)
+    :precondition (and (at ?b ?r) (at-robby ?r) (free ?g))
+    :effect (and (carry ?b ?g) (not (at ?b ?r)) (not (free ?g)))
+  )
+  (:action drop
+    :parameters (?b - ball ?r - room ?g - gripper)
+    :precondition (and (carry ?b ?g) (at-robby ?r))
+    :effect (and (at ?b ?r) (free ?g) (not (carry ?b ?g)))
+  )
+))";
+
+  std::string balls;
+  std::string init;
+  std::string goal;
+  for (std::size_t i = 0; i < pNbOfBalls; ++i)
+  {
+    auto ball = _objectName("ball", i);
+    balls += " " + ball;
+    init += "    (at " + ball + " rooma)\n";
+    goal += "      (at " + ball + " roomb)\n";
+  }
+  res.problem = "(define (problem gripper-" + std::to_string(pNbOfBalls) + ")\n"
+      "  (:domain gripper)\n"
+      "  (:objects\n    rooma roomb - room\n    left right - gripper\n   " + balls + " - ball\n  )\n"
+      "  (:init\n    (at-robby rooma)\n    (free left)\n    (free right)\n" + init + "  )\n"
+      "  (:goal\n    (and ;; __ORDERED\n" + goal + "    )\n  )\n)";
+  return res;
+}
+
+
+GeneratedPddl generateWarehouse(std::size_t pNbOfRobots,
+                                std::size_t pNbOfBoxes)
+{
+  GeneratedPddl res;
+  res.domain = R"((define (domain warehouse)
+  (:requirements :strips :typing)
+  (:types robot box location)
+  (:predicates
+    (at ?r - robot ?l - location)
+    (box-at ?b - box ?l - location)
+    (is-dock ?l - location)
+    (free ?r - robot)
+    (holding ?r - robot ?b - box)
+    (delivered ?b - box)
+  )
+  (:event mark-delivered
+    :parameters (?b - box ?l - location)
+    :precondition (and (box-at ?b ?l) (is-dock ?l))
+    :effect (delivered ?b)
+  )
+  (:action move
+    :parameters (?r - robot ?from - location ?to - location)
+    :precondition (at ?r ?from)
+    :effect (and (not (at ?r ?from)) (at ?r ?to))
+  )
+  (:action pick
+    :parameters (?r - robot ?b - box ?l - location)
+    :precondition (and (box-at ?b ?l) (at ?r ?l) (free ?r))
+    :effect (and (not (box-at ?b ?l)) (not (free ?r)) (holding ?r ?b))
+  )
+  (:action drop
+    :parameters (?r - robot ?b - box ?l - location)
+    :precondition (and (at ?r ?l) (holding ?r ?b))
+    :effect (and (box-at ?b ?l) (free ?r) (not (holding ?r ?b)))
+  )
+))";
+
+  std::string objects = "    dock - location\n";
+  std::string init = "    (is-dock dock)\n";
+  for (std::size_t i = 0; i < pNbOfRobots; ++i)
+  {
+    auto robot = _objectName("robot", i);
+    objects += "    " + robot + " - robot\n";
+    init += "    (at " + robot + " dock)\n    (free " + robot + ")\n";
+  }
+  std::string goal;
+  for (std::size_t i = 0; i < pNbOfBoxes; ++i)
+  {
+    auto box = _objectName("box", i);
+    auto shelf = _objectName("shelf", i);
+    objects += "    " + box + " - box\n    " + shelf + " - location\n";
+    init += "    (box-at " + box + " " + shelf + ")\n";
+    goal += "      (box-at " + box + " dock)\n";
+  }
+  res.problem = "(define (problem warehouse-" + std::to_string(pNbOfRobots) + "-" + std::to_string(pNbOfBoxes) + ")\n"
+      "  (:domain warehouse)\n"
+      "  (:objects\n" + objects + "  )\n"
+      "  (:init\n" + init + "  )\n"
+      "  (:goal\n    (and ;; __ORDERED\n" + goal + "    )\n  )\n)";
+  return res;
+}
+
+
+DomainAndProblemPtrs loadGeneratedPddl(const GeneratedPddl& pGeneratedPddl)
+{
+  std::map<std::string, Domain> loadedDomains;
+  auto domain = pddlToDomain(pGeneratedPddl.domain, loadedDomains);
+  loadedDomains.emplace(domain.getName(), std::move(domain));
+  return pddlToProblem(pGeneratedPddl.problem, loadedDomains);
+}
+
+
+} // !ogp
@@ -0,0 +1,34 @@
+#ifndef ORDEREDGOALSPLANNER_BENCHMARKS_GENERATEDDOMAINS_HPP
+#define ORDEREDGOALSPLANNER_BENCHMARKS_GENERATEDDOMAINS_HPP
+
+#include <cstddef>
+#include <string>
+#include <orderedgoalsplanner/util/serializer/deserializefrompddl.hpp>
+
+
+namespace ogp
+{
+
+/// Domain and problem generated in PDDL.<br/>
+/// The goals are ordered, so each object to move is a goal of its own.
+struct GeneratedPddl
+{
+  std::string domain;
+  std::string problem;
+};
+
+
+/// Gripper: one robot with two grippers carries all the balls from a room to another room.
+GeneratedPddl generateGripper(std::size_t pNbOfBalls);
+
+/// Warehouse: robots carry boxes to a dock, an event marks the boxes arrived at the dock as delivered.
+GeneratedPddl generateWarehouse(std::size_t pNbOfRobots,
+                                std::size_t pNbOfBoxes);
+
+/// Parse a generated domain and problem.
+DomainAndProblemPtrs loadGeneratedPddl(const GeneratedPddl& pGeneratedPddl);
+
+} // !ogp
+
+
+#endif // ORDEREDGOALSPLANNER_BENCHMARKS_GENERATEDDOMAINS_HPP
@@ -0,0 +1,41 @@
+#ifndef ORDEREDGOALSPLANNER_BIN_FILECONTENT_HPP
+#define ORDEREDGOALSPLANNER_BIN_FILECONTENT_HPP
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+
+namespace ogp
+{
+
+inline std::string getFileContent(const std::string& filePath)
+{
+  std::ifstream file(filePath, std::ios::binary);
+  if (!file.is_open()) {
+    throw std::runtime_error("Error: Could not open file " + filePath);
+  }
+
+  // The size is unknown for pipes and FIFOs, so their content is streamed
+  file.seekg(0, std::ios::end);
+  const auto fileSize = file.tellg();
+  if (fileSize < 0) {
+    file.clear();
+    std::ostringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+  }
+
+  // Read the whole file at once instead of concatenating it line by line
+  std::string res(static_cast<std::size_t>(fileSize), '\0');
+  file.seekg(0);
+  file.read(res.data(), static_cast<std::streamsize>(res.size()));
+  res.resize(static_cast<std::size_t>(file.gcount()));
+  return res;
+}
+
+} // !ogp
+
+
+#endif // ORDEREDGOALSPLANNER_BIN_FILECONTENT_HPP
@@ -1,39 +1,254 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
 #include <string>
+#include <thread>
+#include <vector>
 #include <orderedgoalsplanner/types/domain.hpp>
+#include <orderedgoalsplanner/types/parallelplan.hpp>
+#include <orderedgoalsplanner/types/plannerstatistics.hpp>
 #include <orderedgoalsplanner/types/problem.hpp>
 #include <orderedgoalsplanner/util/serializer/deserializefrompddl.hpp>
 #include <orderedgoalsplanner/util/serializer/serializeinpddl.hpp>
 #include <orderedgoalsplanner/orderedgoalsplanner.hpp>
+#include "filecontent.hpp"
+#include "plannerserver.hpp"
 
 using namespace ogp;
 
 namespace
 {
-std::string _getFileContent(const std::string& filePath)
+/// Result of the planning of one problem of a batch.
+struct BatchResult
 {
-  std::ifstream file(filePath);
-  if (!file.is_open()) {
-    throw std::runtime_error("Error: Could not open file " + filePath);
+  std::string problemFile;
+  double parseDurationInMs = 0;
+  double planningDurationInMs = 0;
+  std::size_t nbOfSteps = 0;
+  std::string status = "not done";
+  ogp::PlannerStatistics statistics;
+};
+
+
+double _durationInMs(const std::chrono::steady_clock::time_point& pBegin,
+                     const std::chrono::steady_clock::time_point& pEnd)
+{
+  return std::chrono::duration<double, std::milli>(pEnd - pBegin).count();
+}
+
+bool _writePlanFile(const std::string& pOutputPlanFile,
+                    const std::string& pProblemFile,
+                    const std::string& pPlanStr)
+{
+  std::ofstream file(pOutputPlanFile);
+  if (!file.is_open())
+    return false;
+
+  std::filesystem::path filePath = pProblemFile;
+  std::string problemFileName = filePath.filename().string();
+  file << "; Plan generated by orderedgoalsplanner.\n";
+  file << "; Problem file: " << problemFileName << "\n\n";
+  file << pPlanStr;
+  return true;
+}
+
+
+/// Get the problem files of a directory or listed in a manifest file (one path per line, relative to the manifest).
+std::vector<std::string> _getBatchProblemFiles(const std::string& pBatchInput,
+                                               const std::string& pDomainFile)
+{
+  std::vector<std::string> res;
+  std::filesystem::path batchInputPath = pBatchInput;
+  if (std::filesystem::is_directory(batchInputPath))
+  {
+    std::error_code errorCode;
+    auto domainPath = std::filesystem::weakly_canonical(pDomainFile, errorCode);
+    for (const auto& currEntry : std::filesystem::directory_iterator(batchInputPath))
+    {
+      if (!currEntry.is_regular_file() || currEntry.path().extension() != ".pddl")
+        continue;
+      if (std::filesystem::weakly_canonical(currEntry.path(), errorCode) == domainPath ||
+          currEntry.path().filename() == "domain.pddl")
+        continue;
+      res.emplace_back(currEntry.path().string());
+    }
+    std::sort(res.begin(), res.end());
+    return res;
   }
 
-  std::string res;
+  std::ifstream manifest(pBatchInput);
+  if (!manifest.is_open())
+    throw std::runtime_error("Error: Could not open file " + pBatchInput);
   std::string line;
-  while (std::getline(file, line))
-    res += line + "\n";
-
-  file.close();
+  while (std::getline(manifest, line))
+  {
+    while (!line.empty() && (line.back() == '\r' || line.back() == ' '))
+      line.pop_back();
+    if (line.empty() || line[0] == '#' || line[0] == ';')
+      continue;
+    std::filesystem::path problemPath = line;
+    if (problemPath.is_relative())
+      problemPath = batchInputPath.parent_path() / problemPath;
+    res.emplace_back(problemPath.string());
+  }
   return res;
 }
 
+
+void _planProblemOfBatch(BatchResult& pResult,
+                         const std::map<std::string, ogp::Domain>& pLoadedDomains,
+                         const ogp::PlannerOptions& pPlannerOptions,
+                         bool pWithStatistics,
+                         const std::string& pOutputDirectory)
+{
+  try
+  {
+    auto beginTime = std::chrono::steady_clock::now();
+    auto problemContent = getFileContent(pResult.problemFile);
+    ogp::DomainAndProblemPtrs domainAndProblemPtrs = ogp::pddlToProblem(problemContent, pLoadedDomains);
+    auto parsedTime = std::chrono::steady_clock::now();
+    pResult.parseDurationInMs = _durationInMs(beginTime, parsedTime);
+
+    const auto& domain = *domainAndProblemPtrs.domainPtr;
+    auto plannerOptions = pPlannerOptions;
+    if (pWithStatistics)
+      plannerOptions.statisticsPtr = &pResult.statistics;
+    auto plan = ogp::planForEveryGoals(*domainAndProblemPtrs.problemPtr, domain, {}, plannerOptions);
+    pResult.planningDurationInMs = _durationInMs(parsedTime, std::chrono::steady_clock::now());
+    pResult.nbOfSteps = plan.size();
+    if (plan.empty())
+    {
+      pResult.status = "no plan";
+      return;
+    }
+
+    std::filesystem::path planPath = pResult.problemFile;
+    planPath.replace_extension(".plan");
+    if (!pOutputDirectory.empty())
+      planPath = std::filesystem::path(pOutputDirectory) / planPath.filename();
+    if (!_writePlanFile(planPath.string(), pResult.problemFile, ogp::planToPddl(plan, domain)))
+    {
+      pResult.status = "cannot write " + planPath.string();
+      return;
+    }
+    pResult.status = "ok";
+  }
+  catch (const std::exception& e)
+  {
+    pResult.status = std::string("error: ") + e.what();
+  }
+}
+
+
+void _printBatchSummary(const std::vector<BatchResult>& pResults,
+                        double pDomainParseDurationInMs,
+                        double pWallDurationInMs)
+{
+  std::size_t problemColumnWidth = 7;
+  for (const auto& currResult : pResults)
+    problemColumnWidth = std::max(problemColumnWidth, currResult.problemFile.size());
+
+  std::cout << std::left << std::setw(static_cast<int>(problemColumnWidth)) << "problem"
+            << std::right << std::setw(12) << "parse (ms)" << std::setw(15) << "planning (ms)"
+            << std::setw(12) << "total (ms)" << std::setw(8) << "steps" << "  status" << "\n";
+  std::size_t nbOfSuccesses = 0;
+  std::cout << std::fixed << std::setprecision(2);
+  for (const auto& currResult : pResults)
+  {
+    if (currResult.status == "ok")
+      ++nbOfSuccesses;
+    std::cout << std::left << std::setw(static_cast<int>(problemColumnWidth)) << currResult.problemFile
+              << std::right << std::setw(12) << currResult.parseDurationInMs
+              << std::setw(15) << currResult.planningDurationInMs
+              << std::setw(12) << currResult.parseDurationInMs + currResult.planningDurationInMs
+              << std::setw(8) << currResult.nbOfSteps << "  " << currResult.status << "\n";
+  }
+  std::cout << "\n" << nbOfSuccesses << "/" << pResults.size() << " problems solved. "
+            << "Domain parsed in " << pDomainParseDurationInMs << " ms, wall time " << pWallDurationInMs << " ms."
+            << std::endl;
+}
+
+
+int _runBatch(const std::string& pDomainFile,
+              const std::string& pBatchInput,
+              const std::string& pOutputDirectory,
+              const ogp::PlannerOptions& pPlannerOptions,
+              bool pWithStatistics)
+{
+  auto beginTime = std::chrono::steady_clock::now();
+  std::map<std::string, ogp::Domain> loadedDomains;
+  auto domain = ogp::pddlToDomain(getFileContent(pDomainFile), loadedDomains);
+  loadedDomains.emplace(domain.getName(), std::move(domain));
+  auto domainParseDurationInMs = _durationInMs(beginTime, std::chrono::steady_clock::now());
+
+  if (!pOutputDirectory.empty())
+    std::filesystem::create_directories(pOutputDirectory);
+
+  std::vector<BatchResult> results;
+  for (auto& currProblemFile : _getBatchProblemFiles(pBatchInput, pDomainFile))
+  {
+    results.emplace_back();
+    results.back().problemFile = std::move(currProblemFile);
+  }
+
+  auto nbOfThreads = std::max<std::size_t>(1, std::min(pPlannerOptions.nbOfThreads, results.size()));
+  // The threads are shared between the problems, so a problem only plans its goals with the threads left by the workers
+  auto problemPlannerOptions = pPlannerOptions;
+  problemPlannerOptions.nbOfThreads = std::max<std::size_t>(1, pPlannerOptions.nbOfThreads / nbOfThreads);
+
+  // Each worker takes the next problem not planned yet, the loaded domains are only read
+  std::atomic<std::size_t> nextProblemIndex{0};
+  auto worker = [&]() {
+    for (auto i = nextProblemIndex++; i < results.size(); i = nextProblemIndex++)
+      _planProblemOfBatch(results[i], loadedDomains, problemPlannerOptions, pWithStatistics, pOutputDirectory);
+  };
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < nbOfThreads; ++i)
+    threads.emplace_back(worker);
+  worker();
+  for (auto& currThread : threads)
+    currThread.join();
+
+  _printBatchSummary(results, domainParseDurationInMs, _durationInMs(beginTime, std::chrono::steady_clock::now()));
+  if (pWithStatistics)
+  {
+    ogp::PlannerStatistics statistics;
+    for (const auto& currResult : results)
+      statistics.add(currResult.statistics);
+    std::cerr << statistics.toStr() << std::endl;
+  }
+  for (const auto& currResult : results)
+    if (currResult.status != "ok")
+      return 1;
+  return 0;
+}
+
+
 void printUsage() {
   std::cout << "Usage: orderedgoalsplanner -d <domain_file> -p <problem_file> [--verbose] [-o <output_plan_file>]" << std::endl;
   std::cout << "or" << std::endl;
   std::cout << "Usage: orderedgoalsplanner <domain_file> <problem_file> [--verbose] [-o <output_plan_file>]" << std::endl;
   std::cout << "or" << std::endl;
   std::cout << "Usage: orderedgoalsplanner --dp <directory_with_domain_pddl_and_problem_pddl_files_in_it> [--verbose] [-o <output_plan_file>]" << std::endl;
+  std::cout << "or" << std::endl;
+  std::cout << "Usage: orderedgoalsplanner -d <domain_file> --batch <problems_directory_or_manifest_file> [-j <nb_of_threads>] [--out-dir <plans_directory>]" << std::endl;
+  std::cout << "or" << std::endl;
+  std::cout << "Usage: orderedgoalsplanner [-d <domain_file>] [-p <problem_file>] --server [--socket <unix_socket_path>]" << std::endl;
+  std::cout << "or" << std::endl;
+  std::cout << "Usage: orderedgoalsplanner -d <domain_file> -p <problem_file> --validate <plan_file>" << std::endl;
+  std::cout << "\nSearch options:" << std::endl;
+  std::cout << "  --search-mode <greedy|rollout-optimal>  How to choose between the candidate actions (default rollout-optimal)" << std::endl;
+  std::cout << "  --max-repetitions <nb>                  Number of times a same action can be repeated in a plan (default 10)" << std::endl;
+  std::cout << "  --max-rollout-depth <nb>                Maximum number of actions simulated to evaluate a candidate action (default no limit)" << std::endl;
+  std::cout << "  --time-budget-ms <ms>                   Time budget of the planning, the actions found before are returned (default no limit)" << std::endl;
+  std::cout << "  --threads <nb>                          Same as -j" << std::endl;
+  std::cout << "  --parallel-goals                        Plan in parallel the goals that cannot interfere" << std::endl;
+  std::cout << "  --statistics                            Print the statistics of the planner on the error output" << std::endl;
+  std::cout << "  --stream                                Print each action as soon as it is found" << std::endl;
 }
 
 }
@@ -45,6 +260,16 @@ int main(int argc, char* argv[])
   std::string problem_file;
   std::string domain_and_problem_directory;
   std::string output_plan_file;
+  std::string batch_input;
+  std::string output_directory;
+  std::string socket_path;
+  std::string plan_file_to_validate;
+  bool server_mode = false;
+  bool stream_mode = false;
+  ogp::PlannerOptions planner_options;
+  planner_options.nbOfThreads = std::max(1u, std::thread::hardware_concurrency());
+  ogp::PlannerStatistics statistics;
+  bool with_statistics = false;
   bool verbose = false;
 
   for (int i = 1; i < argc; ++i) {
@@ -58,6 +283,38 @@ int main(int argc, char* argv[])
       domain_and_problem_directory = argv[++i];
     } else if (arg == "-o" && i + 1 < argc) {
       output_plan_file = argv[++i];
+    } else if (arg == "--batch" && i + 1 < argc) {
+      batch_input = argv[++i];
+    } else if (arg == "--out-dir" && i + 1 < argc) {
+      output_directory = argv[++i];
+    } else if ((arg == "-j" || arg == "--threads") && i + 1 < argc) {
+      planner_options.nbOfThreads = std::max(1, std::atoi(argv[++i]));
+    } else if (arg == "--search-mode" && i + 1 < argc) {
+      try {
+        planner_options.searchMode = ogp::plannerSearchModeFromStr(argv[++i]);
+      } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+      }
+    } else if (arg == "--max-repetitions" && i + 1 < argc) {
+      planner_options.maxNbOfRepetitionsOfAnAction = std::max(0, std::atoi(argv[++i]));
+    } else if (arg == "--max-rollout-depth" && i + 1 < argc) {
+      planner_options.maxRolloutDepth = std::max(0, std::atoi(argv[++i]));
+    } else if (arg == "--time-budget-ms" && i + 1 < argc) {
+      planner_options.timeBudget = std::chrono::milliseconds(std::max(0, std::atoi(argv[++i])));
+    } else if (arg == "--parallel-goals") {
+      planner_options.planIndependentGoalsInParallel = true;
+    } else if (arg == "--statistics") {
+      with_statistics = true;
+    } else if (arg == "--server") {
+      server_mode = true;
+    } else if (arg == "--socket" && i + 1 < argc) {
+      socket_path = argv[++i];
+      server_mode = true;
+    } else if (arg == "--stream") {
+      stream_mode = true;
+    } else if (arg == "--validate" && i + 1 < argc) {
+      plan_file_to_validate = argv[++i];
     } else if (arg == "--verbose") {
       verbose = true;
     } else if (domain_file == "") {
@@ -70,6 +327,34 @@ int main(int argc, char* argv[])
     }
   }
 
+  if (server_mode) {
+    // The domain and the problem of the arguments are loaded before serving the requests
+    ogp::PlannerServer server;
+    for (const auto& currRequest : {domain_file.empty() ? "" : "load-domain " + domain_file,
+                                    problem_file.empty() ? "" : "load-problem " + problem_file}) {
+      if (currRequest.empty())
+        continue;
+      auto response = server.handleRequest(currRequest);
+      if (response.compare(0, 2, "ok") != 0) {
+        std::cerr << response << std::endl;
+        return 1;
+      }
+    }
+    if (!socket_path.empty())
+      return ogp::runPlannerServerOnUnixSocket(server, socket_path);
+    ogp::runPlannerServerOnStreams(server, std::cin, std::cout);
+    return 0;
+  }
+
+  if (!batch_input.empty()) {
+    if (domain_file.empty()) {
+      std::cerr << "Error: Missing domain file in arguments.\n";
+      printUsage();
+      return 1;
+    }
+    return _runBatch(domain_file, batch_input, output_directory, planner_options, with_statistics);
+  }
+
   if (!domain_and_problem_directory.empty()) {
     domain_file = domain_and_problem_directory + "/domain.pddl";
     problem_file = domain_and_problem_directory + "/problem.pddl";
@@ -85,19 +370,33 @@ int main(int argc, char* argv[])
     return 1;
   }
 
-  auto domainContent = _getFileContent(domain_file);
+  auto domainContent = getFileContent(domain_file);
   std::map<std::string, ogp::Domain> loadedDomains;
-  auto domain = ogp::pddlToDomain(domainContent, loadedDomains);
-  loadedDomains.emplace(domain.getName(), std::move(domain));
+  auto loadedDomain = ogp::pddlToDomain(domainContent, loadedDomains);
+  loadedDomains.emplace(loadedDomain.getName(), std::move(loadedDomain));
   if (verbose)
     std::cout << "Parsing domain file \"" << domain_file << "\" done successfully." << std::endl;
 
-  auto problemContent = _getFileContent(problem_file);
+  auto problemContent = getFileContent(problem_file);
   ogp::DomainAndProblemPtrs domainAndProblemPtrs = ogp::pddlToProblem(problemContent, loadedDomains);
+  auto& domain = *domainAndProblemPtrs.domainPtr;
   auto& problem = *domainAndProblemPtrs.problemPtr;
   if (verbose)
     std::cout << "Parsing problem file \"" << problem_file << "\" done successfully." << std::endl;
 
+  if (!plan_file_to_validate.empty())
+  {
+    try {
+      auto plan = ogp::pddlToParallelPlan(getFileContent(plan_file_to_validate), domain, problem.entities);
+      auto validationResult = ogp::validatePlan(plan, problem, domain);
+      std::cout << "Plan " << validationResult.toStr() << std::endl;
+      return validationResult.isValid() ? 0 : 1;
+    } catch (const std::exception& e) {
+      std::cerr << "Error: " << e.what() << std::endl;
+      return 1;
+    }
+  }
+
   if (verbose)
   {
     std::cout << "\n" << std::endl;
@@ -109,7 +408,27 @@ int main(int argc, char* argv[])
 
   if (verbose)
     std::cout << "Searching for a plan..." << std::endl;
-  std::string planStr = ogp::planToPddl(ogp::planForEveryGoals(problem, domain, {}), domain);
+  if (with_statistics)
+    planner_options.statisticsPtr = &statistics;
+  if (stream_mode)
+  {
+    std::size_t step = 0;
+    ogp::planForEveryGoalsStreaming(problem, domain, [&](ogp::ActionInvocationWithGoal&& pAction) {
+      std::cout << std::setw(2) << std::setfill('0') << step++ << ": " << pAction.actionInvocation.toPddl(domain) << std::endl;
+      return ogp::ContinueOrBreak::CONTINUE;
+    }, {}, planner_options);
+    if (with_statistics)
+      std::cerr << statistics.toStr() << std::endl;
+    if (step == 0)
+    {
+      std::cerr << "No plan found." << std::endl;
+      return 1;
+    }
+    return 0;
+  }
+  std::string planStr = ogp::planToPddl(ogp::planForEveryGoals(problem, domain, {}, planner_options), domain);
+  if (with_statistics)
+    std::cerr << statistics.toStr() << std::endl;
 
 
   if (planStr == "")
@@ -130,19 +449,10 @@ int main(int argc, char* argv[])
 
   if (!output_plan_file.empty())
   {
-
-    std::ofstream file(output_plan_file);
-    if (!file.is_open()) {
+    if (!_writePlanFile(output_plan_file, problem_file, planStr)) {
       std::cerr << "Error: Could not open the file " << output_plan_file << std::endl;
       return 1;
     }
-
-    std::filesystem::path filePath = problem_file;
-    std::string problemFileName = filePath.filename().string();
-    file << "; Plan generated by orderedgoalsplanner.\n";
-    file << "; Problem file: " << problemFileName << "\n\n";
-    file << planStr;
-    file.close();
     if (verbose)
       std::cout << "Output Plan wrote in " << output_plan_file << std::endl;
   }
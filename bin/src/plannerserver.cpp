@@ -0,0 +1,308 @@
+#include "plannerserver.hpp"
+#include <cctype>
+#include <chrono>
+#include <stdexcept>
+#include <orderedgoalsplanner/types/goal.hpp>
+#include <orderedgoalsplanner/types/setofcallbacks.hpp>
+#include <orderedgoalsplanner/util/serializer/deserializefrompddl.hpp>
+#include <orderedgoalsplanner/orderedgoalsplanner.hpp>
+#include "filecontent.hpp"
+#ifndef _WIN32
+#include <csignal>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+
+namespace ogp
+{
+namespace
+{
+const SetOfCallbacks _noCallbacks;
+
+std::string _trim(const std::string& pStr)
+{
+  auto beginPos = pStr.find_first_not_of(" \t\r\n");
+  if (beginPos == std::string::npos)
+    return "";
+  auto endPos = pStr.find_last_not_of(" \t\r\n");
+  return pStr.substr(beginPos, endPos - beginPos + 1);
+}
+
+void _skipSpaces(const std::string& pStr,
+                 std::size_t& pPos)
+{
+  while (pPos < pStr.size() && std::isspace(static_cast<unsigned char>(pStr[pPos])))
+    ++pPos;
+}
+
+std::unique_ptr<std::chrono::steady_clock::time_point> _now()
+{
+  return std::make_unique<std::chrono::steady_clock::time_point>(std::chrono::steady_clock::now());
+}
+
+#ifndef _WIN32
+#ifdef MSG_NOSIGNAL
+const int _sendFlags = MSG_NOSIGNAL;
+#else
+const int _sendFlags = 0;
+#endif
+
+/// Send all the bytes to a socket. Return false if the client is disconnected.
+bool _sendAll(int pFd,
+              const std::string& pData)
+{
+  for (std::size_t sent = 0; sent < pData.size(); )
+  {
+    auto nbOfBytesSent = send(pFd, pData.data() + sent, pData.size() - sent, _sendFlags);
+    if (nbOfBytesSent <= 0)
+      return false;
+    sent += static_cast<std::size_t>(nbOfBytesSent);
+  }
+  return true;
+}
+#endif
+
+}
+
+
+std::string PlannerServer::handleRequest(const std::string& pRequest)
+{
+  auto request = _trim(pRequest);
+  auto spacePos = request.find(' ');
+  try
+  {
+    if (spacePos == std::string::npos)
+      return _handleCommand(request, "");
+    return _handleCommand(request.substr(0, spacePos), _trim(request.substr(spacePos + 1)));
+  }
+  catch (const std::exception& e)
+  {
+    std::string res = "error ";
+    // The response has to stay on one line
+    for (char currChar : std::string(e.what()))
+      res += currChar == '\n' ? ' ' : currChar;
+    return res;
+  }
+}
+
+
+std::string PlannerServer::_handleCommand(const std::string& pCommand,
+                                          const std::string& pArguments)
+{
+  if (pCommand == "load-domain")
+  {
+    auto domain = pddlToDomain(getFileContent(pArguments), _loadedDomains);
+    auto domainName = domain.getName();
+    _loadedDomains.erase(domainName);
+    _loadedDomains.emplace(domainName, std::move(domain));
+    return "ok " + domainName;
+  }
+  if (pCommand == "load-problem")
+  {
+    _domainAndProblemPtrs = pddlToProblem(getFileContent(pArguments), _loadedDomains);
+    _pendingActions.clear();
+    return "ok " + _domainAndProblemPtrs.problemPtr->name;
+  }
+  if (pCommand == "patch-facts")
+  {
+    auto& problem = _problem();
+    const auto& domain = _domain();
+    std::size_t pos = 0;
+    bool changed = problem.worldState.modifyFactsFromPddl(pArguments, pos, problem.goalStack, domain.getSetOfEvents(),
+                                                          _noCallbacks, domain.getOntology(), problem.entities, _now());
+    return changed ? "ok changed" : "ok unchanged";
+  }
+  if (pCommand == "set-facts")
+  {
+    auto& problem = _problem();
+    const auto& domain = _domain();
+    std::set<Fact> facts;
+    std::size_t pos = 0;
+    _skipSpaces(pArguments, pos);
+    while (pos < pArguments.size())
+    {
+      facts.emplace(pArguments, true, domain.getOntology(), problem.entities, std::vector<Parameter>(), nullptr, pos, &pos);
+      _skipSpaces(pArguments, pos);
+    }
+    problem.worldState.setFacts(facts, problem.goalStack, domain.getSetOfEvents(), _noCallbacks,
+                                domain.getOntology(), problem.entities, _now());
+    return "ok";
+  }
+  if (pCommand == "facts")
+  {
+    std::string res = "ok";
+    for (const auto& currFact : _problem().worldState.facts())
+    {
+      if (!currFact.second)
+        continue;
+      res += ' ';
+      currFact.first.toPddl(res, false, true);
+    }
+    return res;
+  }
+  if (pCommand == "push-goal")
+  {
+    auto& problem = _problem();
+    const auto& domain = _domain();
+    int priority = GoalStack::getDefaultPriority();
+    std::size_t pos = 0;
+    if (!pArguments.empty() && pArguments[0] != '(')
+    {
+      priority = std::stoi(pArguments, &pos);
+      _skipSpaces(pArguments, pos);
+    }
+    auto goal = pddlToGoal(pArguments, pos, domain.getOntology(), problem.entities);
+    problem.goalStack.pushBackGoal(*goal, problem.worldState, domain.getOntology().constants, problem.entities,
+                                   _now(), priority);
+    return "ok";
+  }
+  if (pCommand == "clear-goals")
+  {
+    auto& problem = _problem();
+    problem.goalStack.clearGoals(problem.worldState, _domain().getOntology().constants, problem.entities, _now());
+    return "ok";
+  }
+  if (pCommand == "next-action")
+  {
+    auto& problem = _problem();
+    const auto& domain = _domain();
+    auto plan = planForMoreImportantGoalPossible(problem, domain, true, _now());
+    if (plan.empty())
+      return "ok";
+    // The duration written after the action is removed, so that the client can give back the action as it is
+    auto actionPddl = plan.front().actionInvocation.toPddl(domain);
+    actionPddl.resize(actionPddl.rfind(')') + 1);
+    _pendingActions.erase(actionPddl);
+    _pendingActions.emplace(actionPddl, plan.front());
+    return "ok " + actionPddl;
+  }
+  if (pCommand == "action-started")
+  {
+    notifyActionStarted(_problem(), _domain(), _noCallbacks, _pendingAction(pArguments), _now());
+    return "ok";
+  }
+  if (pCommand == "action-done")
+  {
+    bool found = notifyActionDone(_problem(), _domain(), _noCallbacks, _pendingAction(pArguments), _now());
+    _pendingActions.erase(pArguments);
+    return found ? "ok" : "error The action is not in the domain";
+  }
+  if (pCommand == "quit")
+  {
+    _isQuitRequested = true;
+    return "ok";
+  }
+  return "error Unknown command \"" + pCommand + "\"";
+}
+
+
+Problem& PlannerServer::_problem()
+{
+  if (!_domainAndProblemPtrs.problemPtr)
+    throw std::runtime_error("No problem is loaded");
+  return *_domainAndProblemPtrs.problemPtr;
+}
+
+
+const Domain& PlannerServer::_domain()
+{
+  if (!_domainAndProblemPtrs.domainPtr)
+    throw std::runtime_error("No problem is loaded");
+  return *_domainAndProblemPtrs.domainPtr;
+}
+
+
+const ActionInvocationWithGoal& PlannerServer::_pendingAction(const std::string& pActionPddl)
+{
+  auto it = _pendingActions.find(pActionPddl);
+  if (it == _pendingActions.end())
+    throw std::runtime_error("The action \"" + pActionPddl + "\" was not given by next-action");
+  return it->second;
+}
+
+
+void runPlannerServerOnStreams(PlannerServer& pServer,
+                               std::istream& pInput,
+                               std::ostream& pOutput)
+{
+  std::string line;
+  while (!pServer.isQuitRequested() && std::getline(pInput, line))
+  {
+    if (_trim(line).empty())
+      continue;
+    pOutput << pServer.handleRequest(line) << std::endl;
+  }
+}
+
+
+int runPlannerServerOnUnixSocket(PlannerServer& pServer,
+                                 const std::string& pSocketPath)
+{
+#ifdef _WIN32
+  std::cerr << "Error: Unix sockets are not supported on this platform." << std::endl;
+  return 1;
+#else
+  sockaddr_un address{};
+  if (pSocketPath.size() >= sizeof(address.sun_path))
+  {
+    std::cerr << "Error: The socket path is too long." << std::endl;
+    return 1;
+  }
+  address.sun_family = AF_UNIX;
+  // A client that disconnects before reading its response must not kill the server
+  std::signal(SIGPIPE, SIG_IGN);
+  pSocketPath.copy(address.sun_path, pSocketPath.size());
+
+  int serverFd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (serverFd < 0)
+  {
+    std::cerr << "Error: Could not create the socket." << std::endl;
+    return 1;
+  }
+  unlink(pSocketPath.c_str());
+  if (bind(serverFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+      listen(serverFd, 1) != 0)
+  {
+    std::cerr << "Error: Could not listen on " << pSocketPath << std::endl;
+    close(serverFd);
+    return 1;
+  }
+
+  char buffer[4096];
+  while (!pServer.isQuitRequested())
+  {
+    int clientFd = accept(serverFd, nullptr, nullptr);
+    if (clientFd < 0)
+      break;
+    std::string pendingInput;
+    ssize_t nbOfBytesRead = 0;
+    bool isClientConnected = true;
+    while (isClientConnected && !pServer.isQuitRequested() &&
+           (nbOfBytesRead = read(clientFd, buffer, sizeof(buffer))) > 0)
+    {
+      pendingInput.append(buffer, static_cast<std::size_t>(nbOfBytesRead));
+      std::size_t lineBeginPos = 0;
+      for (auto lineEndPos = pendingInput.find('\n');
+           lineEndPos != std::string::npos && isClientConnected && !pServer.isQuitRequested();
+           lineEndPos = pendingInput.find('\n', lineBeginPos))
+      {
+        auto line = pendingInput.substr(lineBeginPos, lineEndPos - lineBeginPos);
+        lineBeginPos = lineEndPos + 1;
+        if (_trim(line).empty())
+          continue;
+        isClientConnected = _sendAll(clientFd, pServer.handleRequest(line) + "\n");
+      }
+      pendingInput.erase(0, lineBeginPos);
+    }
+    close(clientFd);
+  }
+  close(serverFd);
+  unlink(pSocketPath.c_str());
+  return 0;
+#endif
+}
+
+
+} // !ogp
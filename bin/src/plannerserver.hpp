@@ -0,0 +1,83 @@
+#ifndef ORDEREDGOALSPLANNER_BIN_PLANNERSERVER_HPP
+#define ORDEREDGOALSPLANNER_BIN_PLANNERSERVER_HPP
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <orderedgoalsplanner/types/actioninvocationwithgoal.hpp>
+#include <orderedgoalsplanner/types/domain.hpp>
+#include <orderedgoalsplanner/types/problem.hpp>
+#include <orderedgoalsplanner/util/serializer/deserializefrompddl.hpp>
+
+
+namespace ogp
+{
+
+/**
+ * @brief Planner that stays alive between requests, so that the domains are parsed only once.<br/>
+ * A request is one line: a command name followed by its PDDL arguments.<br/>
+ * The response is one line that starts with "ok" or with "error".
+ *
+ * Commands:
+ *  * load-domain <domain_file>
+ *  * load-problem <problem_file>
+ *  * patch-facts <facts>, a fact in a "(not ...)" is removed, the other facts are added
+ *  * set-facts <facts>
+ *  * facts
+ *  * push-goal [<priority>] <goal>
+ *  * clear-goals
+ *  * next-action
+ *  * action-started <action>, with an action given by next-action
+ *  * action-done <action>, with an action given by next-action
+ *  * quit
+ */
+class PlannerServer
+{
+public:
+  /**
+   * @brief Handle a request.
+   * @param[in] pRequest Request line.
+   * @return The response line.
+   */
+  std::string handleRequest(const std::string& pRequest);
+
+  /// Has the client asked to stop the server.
+  bool isQuitRequested() const { return _isQuitRequested; }
+
+private:
+  std::map<std::string, Domain> _loadedDomains{};
+  DomainAndProblemPtrs _domainAndProblemPtrs{};
+  /// Actions returned by next-action and not done yet, indexed by their PDDL.
+  std::map<std::string, ActionInvocationWithGoal> _pendingActions{};
+  bool _isQuitRequested = false;
+
+  std::string _handleCommand(const std::string& pCommand,
+                             const std::string& pArguments);
+  Problem& _problem();
+  const Domain& _domain();
+  const ActionInvocationWithGoal& _pendingAction(const std::string& pActionPddl);
+};
+
+
+/**
+ * @brief Serve the requests read line by line in a stream until the end of the stream or a quit request.
+ * @param[in] pInput Stream of requests.
+ * @param[out] pOutput Stream where the responses are written.
+ */
+void runPlannerServerOnStreams(PlannerServer& pServer,
+                               std::istream& pInput,
+                               std::ostream& pOutput);
+
+/**
+ * @brief Serve the requests of the clients connected to a local Unix socket, one client after the other.
+ * @param[in] pSocketPath File path of the socket to create.
+ * @return The exit code of the program.
+ */
+int runPlannerServerOnUnixSocket(PlannerServer& pServer,
+                                 const std::string& pSocketPath);
+
+} // !ogp
+
+
+#endif // ORDEREDGOALSPLANNER_BIN_PLANNERSERVER_HPP
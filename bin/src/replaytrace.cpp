@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <orderedgoalsplanner/util/trackers/plannertrace.hpp>
+#include "filecontent.hpp"
+
+using namespace ogp;
+
+namespace
+{
+/// Durations of all the calls of one kind.
+struct CallTypeSummary
+{
+  std::size_t nbOfCalls = 0;
+  std::chrono::nanoseconds recordedDuration{0};
+  std::chrono::nanoseconds replayedDuration{0};
+  std::chrono::nanoseconds maxReplayedDuration{0};
+};
+
+
+double _toMs(const std::chrono::nanoseconds& pDuration)
+{
+  return std::chrono::duration<double, std::milli>(pDuration).count();
+}
+
+
+void _printSummary(const std::map<PlannerTraceCallType, CallTypeSummary>& pTypeToSummary,
+                   std::size_t pNbOfDifferentResults)
+{
+  std::cout << std::left << std::setw(34) << "call" << std::right
+            << std::setw(8) << "count"
+            << std::setw(16) << "recorded (ms)"
+            << std::setw(16) << "replayed (ms)"
+            << std::setw(14) << "mean (ms)"
+            << std::setw(14) << "max (ms)" << "\n";
+  CallTypeSummary total;
+  std::cout << std::fixed << std::setprecision(3);
+  for (const auto& currTypeToSummary : pTypeToSummary)
+  {
+    const auto& summary = currTypeToSummary.second;
+    std::cout << std::left << std::setw(34) << plannerTraceCallTypeToStr(currTypeToSummary.first) << std::right
+              << std::setw(8) << summary.nbOfCalls
+              << std::setw(16) << _toMs(summary.recordedDuration)
+              << std::setw(16) << _toMs(summary.replayedDuration)
+              << std::setw(14) << _toMs(summary.replayedDuration) / static_cast<double>(summary.nbOfCalls)
+              << std::setw(14) << _toMs(summary.maxReplayedDuration) << "\n";
+    total.nbOfCalls += summary.nbOfCalls;
+    total.recordedDuration += summary.recordedDuration;
+    total.replayedDuration += summary.replayedDuration;
+  }
+  std::cout << std::left << std::setw(34) << "total" << std::right
+            << std::setw(8) << total.nbOfCalls
+            << std::setw(16) << _toMs(total.recordedDuration)
+            << std::setw(16) << _toMs(total.replayedDuration) << "\n";
+  if (pNbOfDifferentResults > 0)
+    std::cout << pNbOfDifferentResults << " call(s) returned a different result than during the recording." << std::endl;
+}
+
+
+void printUsage() {
+  std::cout << "Usage: ordered_goals_planner_replay <trace_file> [--repeat <nb_of_times>] [--verbose]" << std::endl;
+}
+
+}
+
+
+int main(int argc, char* argv[])
+{
+  std::string trace_file;
+  std::size_t nb_of_repeats = 1;
+  bool verbose = false;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+
+    if (arg == "--repeat" && i + 1 < argc) {
+      nb_of_repeats = std::max(1, std::atoi(argv[++i]));
+    } else if (arg == "--verbose") {
+      verbose = true;
+    } else if (trace_file == "") {
+      trace_file = arg;
+    } else {
+      printUsage();
+      return 1;
+    }
+  }
+
+  if (trace_file.empty()) {
+    printUsage();
+    return 1;
+  }
+
+  std::map<PlannerTraceCallType, CallTypeSummary> typeToSummary;
+  std::size_t nbOfDifferentResults = 0;
+  try {
+    auto trace = getFileContent(trace_file);
+    for (std::size_t i = 0; i < nb_of_repeats; ++i) {
+      replayPlannerTrace(trace, [&](const PlannerTraceCallReplayed& pCall) {
+        auto& summary = typeToSummary[pCall.type];
+        ++summary.nbOfCalls;
+        summary.recordedDuration += pCall.recordedDuration;
+        summary.replayedDuration += pCall.replayedDuration;
+        summary.maxReplayedDuration = std::max(summary.maxReplayedDuration, pCall.replayedDuration);
+        if (!pCall.sameResult)
+          ++nbOfDifferentResults;
+        if (verbose)
+          std::cout << std::setw(5) << pCall.index << ": " << plannerTraceCallTypeToStr(pCall.type)
+                    << " " << _toMs(pCall.replayedDuration) << " ms (recorded " << _toMs(pCall.recordedDuration) << " ms)"
+                    << (pCall.sameResult ? "" : " different result") << "\n";
+      });
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  _printSummary(typeToSummary, nbOfDifferentResults);
+  return nbOfDifferentResults == 0 ? 0 : 2;
+}
@@ -5,9 +5,13 @@
 #include <map>
 #include "util/api.hpp"
 #include <orderedgoalsplanner/util/alias.hpp>
+#include <orderedgoalsplanner/util/continueorbreak.hpp>
+#include <orderedgoalsplanner/util/functionref.hpp>
 #include <orderedgoalsplanner/types/domain.hpp>
 #include <orderedgoalsplanner/types/actioninvocationwithgoal.hpp>
 #include <orderedgoalsplanner/types/actionstodoinparallel.hpp>
+#include <orderedgoalsplanner/types/planneroptions.hpp>
+#include <orderedgoalsplanner/types/planvalidationresult.hpp>
 #include <orderedgoalsplanner/types/problem.hpp>
 #include <orderedgoalsplanner/types/lookforanactionoutputinfos.hpp>
 
@@ -37,6 +41,25 @@ std::list<ActionInvocationWithGoal> planForMoreImportantGoalPossible(
     const Historical* pGlobalHistorical = nullptr,
     LookForAnActionOutputInfos* pLookForAnActionOutputInfosPtr = nullptr);
 
+/**
+ * @brief Ask the planner to get the next action to do.
+ * @param[in, out] pProblem Problem of the planner.
+ * @param[in] pDomain Domain of the planner.
+ * @param[in] pNow Current time.
+ * @param[in] pOptions Options of the search.
+ * @param[in, opt] pGlobalHistorical A historical to give more priority to an action less frequently used.
+ * @param[out] pLookForAnActionOutputInfosPtr Output to know informations (is the goal satified, does the goal resolution failed, how many goals was solved, ...)
+ * @return The next action to do, his parameters and information about the goal that motivated that action.
+ */
+ORDEREDGOALSPLANNER_API
+std::list<ActionInvocationWithGoal> planForMoreImportantGoalPossible(
+    Problem& pProblem,
+    const Domain& pDomain,
+    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+    const PlannerOptions& pOptions,
+    const Historical* pGlobalHistorical = nullptr,
+    LookForAnActionOutputInfos* pLookForAnActionOutputInfosPtr = nullptr);
+
 
 
 /**
@@ -55,6 +78,15 @@ ActionsToDoInParallel actionsToDoInParallelNow(
     const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
     Historical* pGlobalHistorical = nullptr);
 
+/// Same as actionsToDoInParallelNow but with options for the search.
+ORDEREDGOALSPLANNER_API
+ActionsToDoInParallel actionsToDoInParallelNow(
+    Problem& pProblem,
+    const Domain& pDomain,
+    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+    const PlannerOptions& pOptions,
+    Historical* pGlobalHistorical = nullptr);
+
 
 /**
  * @brief Notify that an action started. This function will update the world (contained in the problem) accordingly.
@@ -107,13 +139,79 @@ std::list<ActionInvocationWithGoal> planForEveryGoals(
     Historical* pGlobalHistorical = nullptr,
     std::list<Goal>* pGoalsDonePtr = nullptr);
 
+/// Same as planForEveryGoals but with options for the search.
+ORDEREDGOALSPLANNER_API
+std::list<ActionInvocationWithGoal> planForEveryGoals(
+    Problem& pProblem,
+    const Domain& pDomain,
+    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+    const PlannerOptions& pOptions,
+    Historical* pGlobalHistorical = nullptr,
+    std::list<Goal>* pGoalsDonePtr = nullptr);
+
+/**
+ * @brief Same as planForEveryGoals but each action is given to a callback as soon as it is added to the plan.<br/>
+ * The goals are planned one after the other, so PlannerOptions::planIndependentGoalsInParallel is ignored.
+ * @param[in, out] pProblem Problem of the planner. It is modified as if the actions given to the callback were done.
+ * @param[in] pDomain Domain of the planner.
+ * @param[in] pOnAction Callback called for each action of the plan, in the order of the plan.<br/>
+ * The planning stops as soon as it returns ContinueOrBreak::BREAK.
+ * @param[in] pNow Current time.
+ * @param[in] pOptions Options for the search.
+ * @param[in, out] pGlobalHistorical Historical more global than the one contained in the problem.
+ * @param[out] pGoalsDonePtr List of goals satisfied by the actions given to the callback.
+ */
+ORDEREDGOALSPLANNER_API
+void planForEveryGoalsStreaming(
+    Problem& pProblem,
+    const Domain& pDomain,
+    FunctionRef<ContinueOrBreak (ActionInvocationWithGoal&&)> pOnAction,
+    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+    const PlannerOptions& pOptions = PlannerOptions(),
+    Historical* pGlobalHistorical = nullptr,
+    std::list<Goal>* pGoalsDonePtr = nullptr);
+
+ORDEREDGOALSPLANNER_API
+ParallelPan parallelPlanForEveryGoals(
+    Problem& pProblem,
+    const Domain& pDomain,
+    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+    Historical* pGlobalHistorical);
+
+/// Same as parallelPlanForEveryGoals but with options for the search.
 ORDEREDGOALSPLANNER_API
 ParallelPan parallelPlanForEveryGoals(
     Problem& pProblem,
     const Domain& pDomain,
     const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+    const PlannerOptions& pOptions,
     Historical* pGlobalHistorical);
 
+/**
+ * @brief Repair a plan found previously instead of planning again from scratch.<br/>
+ * The actions of the previous plan that are not done yet are checked against the current world state.<br/>
+ * The beginning that can still be done, for goals that are not satisfied yet, is kept.<br/>
+ * The planner only searches again for the goal of the first action that cannot be done anymore, then the actions
+ * of the other goals are checked again from the new state and the same is done until the end of the previous plan.
+ * @param[in] pRemainingPlan Actions of the previous plan that are not done yet.
+ * @param[in, out] pProblem Problem of the planner. Like for planForEveryGoals, it is modified as if the returned plan was done.
+ * @param[in] pDomain Domain of the planner.
+ * @param[in] pNow Current time.
+ * @param[in] pOptions Options of the search done after the kept actions.
+ * @param[in, out] pGlobalHistorical Historical more global than the one contained in the problem.
+ * @param[out] pNbOfActionsKeptPtr Number of actions of the previous plan kept at the beginning of the result.
+ * @return List of all the actions to do with their parameters with values.
+ */
+ORDEREDGOALSPLANNER_API
+std::list<ActionInvocationWithGoal> repairPlan(
+    const std::list<ActionInvocationWithGoal>& pRemainingPlan,
+    Problem& pProblem,
+    const Domain& pDomain,
+    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+    const PlannerOptions& pOptions = PlannerOptions(),
+    Historical* pGlobalHistorical = nullptr,
+    std::size_t* pNbOfActionsKeptPtr = nullptr);
+
 /**
  * @brief Convert a plan to a string.
  * @param[in] pPlan Plan to print.
@@ -152,6 +250,24 @@ bool evaluate
  Problem& pProblem,
  const Domain& pDomain);
 
+
+/**
+ * @brief Check that the actions of a plan can be done, without modifying the problem.<br/>
+ * The actions of a step must not interfere and their preconditions must be satisfied at the beginning of the step.
+ * @param[in] pPlan Plan to check.
+ * @param[in] pProblem Problem containing the current world state.
+ * @param[in] pDomain Domain of the actions.
+ * @param[in] pFirstStepIndex Index of the first step to check against the current world state.<br/>
+ * The previous steps are considered as already done, so a plan suffix can be checked after an update of the world state.
+ * @return Validation result with the index of the first step that cannot be done, if any.
+ */
+ORDEREDGOALSPLANNER_API
+PlanValidationResult validatePlan
+(const ParallelPan& pPlan,
+ const Problem& pProblem,
+ const Domain& pDomain,
+ std::size_t pFirstStepIndex = 0);
+
 } // !ogp
 
 
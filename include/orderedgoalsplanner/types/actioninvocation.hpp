@@ -24,6 +24,16 @@ struct ORDEREDGOALSPLANNER_API ActionInvocation
                    const std::map<Parameter, std::set<Entity>>& pParameters);
   ~ActionInvocation();
 
+  /// Are the action identifier, the parameter names and the parameter values the same (the types are not compared, like in toStr).
+  bool operator==(const ActionInvocation& pOther) const;
+  bool operator!=(const ActionInvocation& pOther) const { return !operator==(pOther); }
+
+  /**
+   * @brief Hash of the action identifier and of the parameter values, consistent with operator==.<br/>
+   * It is computed at construction, so actionId and parameters should not be modified afterwards.
+   */
+  std::size_t hash() const { return _hash; }
+
   /**
    * @brief Serialize in a string.
    * @return String containing the action identifier with his parameters.
@@ -32,10 +42,19 @@ struct ORDEREDGOALSPLANNER_API ActionInvocation
 
   std::string toPddl(const Domain& pDomain) const;
 
+  /// Same as toPddl but append the result to pRes, to avoid intermediate strings.
+  void toPddl(std::string& pRes,
+              const Domain& pDomain) const;
+
   /// Identifer of the action.
   std::string actionId;
   /// Action parameter values.
   std::map<Parameter, Entity> parameters;
+
+private:
+  std::size_t _hash;
+
+  std::size_t _computeHash() const;
 };
 
 
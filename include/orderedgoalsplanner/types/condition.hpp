@@ -9,6 +9,7 @@
 #include "../util/api.hpp"
 #include "factoptional.hpp"
 #include <orderedgoalsplanner/util/continueorbreak.hpp>
+#include <orderedgoalsplanner/util/functionref.hpp>
 #include <orderedgoalsplanner/util/util.hpp>
 
 namespace ogp
@@ -65,7 +66,7 @@ struct ORDEREDGOALSPLANNER_API Condition
    * @param[in] pFactCallback Callback called for each optional fact of the condition.
    * @param[in] pIsWrappingExpressionNegated Is the expression wrapping this call is negated.
    */
-  virtual ContinueOrBreak forAll(const std::function<ContinueOrBreak (const FactOptional&, bool)>& pFactCallback,
+  virtual ContinueOrBreak forAll(FunctionRef<ContinueOrBreak (const FactOptional&, bool)> pFactCallback,
                                  bool pIsWrappingExpressionNegated = false,
                                  bool pIgnoreFluent = false,
                                  bool pOnlyMandatoryFacts = false) const = 0;
@@ -85,7 +86,7 @@ struct ORDEREDGOALSPLANNER_API Condition
    * @return True if one callback returned true, false otherwise.
    */
   virtual bool findConditionCandidateFromFactFromEffect(
-      const std::function<bool (const FactOptional&)>& pDoesConditionFactMatchFactFromEffect,
+      FunctionRef<bool (const FactOptional&)> pDoesConditionFactMatchFactFromEffect,
       const WorldState& pWorldState,
       const SetOfEntities& pConstants,
       const SetOfEntities& pObjects,
@@ -101,7 +102,7 @@ struct ORDEREDGOALSPLANNER_API Condition
    * @param[in] pWorldState World state to consider.
    * @return False if one callback returned false, true otherwise.
    */
-  virtual bool untilFalse(const std::function<bool (const FactOptional&)>& pFactCallback,
+  virtual bool untilFalse(FunctionRef<bool (const FactOptional&)> pFactCallback,
                           const SetOfFacts& pSetOfFact) const = 0;
 
   /**
@@ -226,11 +227,11 @@ struct ORDEREDGOALSPLANNER_API ConditionNode : public Condition
                        const std::map<Parameter, std::set<Entity>>* pOtherFactParametersPtr,
                        const std::vector<Parameter>& pConditionParameters,
                        bool pIsWrappingExpressionNegated) const override;
-  ContinueOrBreak forAll(const std::function<ContinueOrBreak (const FactOptional&, bool)>& pFactCallback,
+  ContinueOrBreak forAll(FunctionRef<ContinueOrBreak (const FactOptional&, bool)> pFactCallback,
                          bool pIsWrappingExpressionNegated,
                          bool pIgnoreFluent,
                          bool pOnlyMandatoryFacts) const override;
-  bool findConditionCandidateFromFactFromEffect(const std::function<bool (const FactOptional&)>& pDoesConditionFactMatchFactFromEffect,
+  bool findConditionCandidateFromFactFromEffect(FunctionRef<bool (const FactOptional&)> pDoesConditionFactMatchFactFromEffect,
                                                 const WorldState& pWorldState,
                                                 const SetOfEntities& pConstants,
                                                 const SetOfEntities& pObjects,
@@ -239,7 +240,7 @@ struct ORDEREDGOALSPLANNER_API ConditionNode : public Condition
                                                 const std::map<Parameter, std::set<Entity>>* pFactFromEffectTmpParametersPtr,
                                                 const std::map<Parameter, std::set<Entity>>& pConditionParametersToPossibleArguments,
                                                 bool pIsWrappingExpressionNegated) const override;
-  bool untilFalse(const std::function<bool (const FactOptional&)>& pFactCallback,
+  bool untilFalse(FunctionRef<bool (const FactOptional&)> pFactCallback,
                   const SetOfFacts& pSetOfFact) const override;
   bool isTrue(const WorldState& pWorldState,
               const SetOfEntities& pConstants,
@@ -296,13 +297,13 @@ struct ORDEREDGOALSPLANNER_API ConditionExists : public Condition
                        const std::map<Parameter, std::set<Entity>>* pOtherFactParametersPtr,
                        const std::vector<Parameter>& pConditionParameters,
                        bool pIsWrappingExpressionNegated) const override;
-  ContinueOrBreak forAll(const std::function<ContinueOrBreak (const FactOptional&, bool)>& pFactCallback,
+  ContinueOrBreak forAll(FunctionRef<ContinueOrBreak (const FactOptional&, bool)> pFactCallback,
                          bool pIsWrappingExpressionNegated,
                          bool pIgnoreFluent,
                          bool pOnlyMandatoryFacts) const override;
 
   bool findConditionCandidateFromFactFromEffect(
-      const std::function<bool (const FactOptional&)>& pDoesConditionFactMatchFactFromEffect,
+      FunctionRef<bool (const FactOptional&)> pDoesConditionFactMatchFactFromEffect,
       const WorldState& pWorldState,
       const SetOfEntities& pConstants,
       const SetOfEntities& pObjects,
@@ -312,7 +313,7 @@ struct ORDEREDGOALSPLANNER_API ConditionExists : public Condition
       const std::map<Parameter, std::set<Entity>>& pConditionParametersToPossibleArguments,
       bool pIsWrappingExpressionNegated) const override;
 
-  bool untilFalse(const std::function<bool (const FactOptional&)>&,
+  bool untilFalse(FunctionRef<bool (const FactOptional&)>,
                   const SetOfFacts&) const override { return true; } // TODO
   bool isTrue(const WorldState& pWorldState,
               const SetOfEntities& pConstants,
@@ -368,13 +369,13 @@ struct ORDEREDGOALSPLANNER_API ConditionNot : public Condition
                        const std::map<Parameter, std::set<Entity>>* pOtherFactParametersPtr,
                        const std::vector<Parameter>& pConditionParameters,
                        bool pIsWrappingExpressionNegated) const override;
-  ContinueOrBreak forAll(const std::function<ContinueOrBreak (const FactOptional&, bool)>& pFactCallback,
+  ContinueOrBreak forAll(FunctionRef<ContinueOrBreak (const FactOptional&, bool)> pFactCallback,
                          bool pIsWrappingExpressionNegated,
                          bool pIgnoreFluent,
                          bool pOnlyMandatoryFacts) const override;
 
   bool findConditionCandidateFromFactFromEffect(
-      const std::function<bool (const FactOptional&)>& pDoesConditionFactMatchFactFromEffect,
+      FunctionRef<bool (const FactOptional&)> pDoesConditionFactMatchFactFromEffect,
       const WorldState& pWorldState,
       const SetOfEntities& pConstants,
       const SetOfEntities& pObjects,
@@ -384,7 +385,7 @@ struct ORDEREDGOALSPLANNER_API ConditionNot : public Condition
       const std::map<Parameter, std::set<Entity>>& pConditionParametersToPossibleArguments,
       bool pIsWrappingExpressionNegated) const override;
 
-  bool untilFalse(const std::function<bool (const FactOptional&)>& pFactCallback,
+  bool untilFalse(FunctionRef<bool (const FactOptional&)> pFactCallback,
                   const SetOfFacts& pSetOfFact) const override { return true; } // TODO
   bool isTrue(const WorldState& pWorldState,
               const SetOfEntities& pConstants,
@@ -438,12 +439,12 @@ struct ORDEREDGOALSPLANNER_API ConditionFact : public Condition
                        const std::map<Parameter, std::set<Entity>>* pOtherFactParametersPtr,
                        const std::vector<Parameter>& pConditionParameters,
                        bool pIsWrappingExpressionNegated) const override;
-  ContinueOrBreak forAll(const std::function<ContinueOrBreak (const FactOptional&, bool)>& pFactCallback,
+  ContinueOrBreak forAll(FunctionRef<ContinueOrBreak (const FactOptional&, bool)> pFactCallback,
                          bool pIsWrappingExpressionNegated,
                          bool pIgnoreFluent,
                          bool pOnlyMandatoryFacts) const override;
   bool findConditionCandidateFromFactFromEffect(
-      const std::function<bool (const FactOptional&)>& pDoesConditionFactMatchFactFromEffect,
+      FunctionRef<bool (const FactOptional&)> pDoesConditionFactMatchFactFromEffect,
       const WorldState&,
       const SetOfEntities&,
       const SetOfEntities&,
@@ -452,7 +453,7 @@ struct ORDEREDGOALSPLANNER_API ConditionFact : public Condition
       const std::map<Parameter, std::set<Entity>>*,
       const std::map<Parameter, std::set<Entity>>&,
       bool pIsWrappingExpressionNegated) const override;
-  bool untilFalse(const std::function<bool (const FactOptional&)>& pFactCallback,
+  bool untilFalse(FunctionRef<bool (const FactOptional&)> pFactCallback,
                   const SetOfFacts&) const override { return pFactCallback(factOptional); }
   bool isTrue(const WorldState& pWorldState,
               const SetOfEntities& pConstants,
@@ -506,9 +507,9 @@ struct ORDEREDGOALSPLANNER_API ConditionNumber : public Condition
                        const std::map<Parameter, std::set<Entity>>*,
                        const std::vector<Parameter>&,
                        bool) const override { return false; }
-  ContinueOrBreak forAll(const std::function<ContinueOrBreak (const FactOptional&, bool)>&, bool, bool, bool) const override { return ContinueOrBreak::CONTINUE; }
+  ContinueOrBreak forAll(FunctionRef<ContinueOrBreak (const FactOptional&, bool)>, bool, bool, bool) const override { return ContinueOrBreak::CONTINUE; }
   bool findConditionCandidateFromFactFromEffect(
-      const std::function<bool (const FactOptional&)>&,
+      FunctionRef<bool (const FactOptional&)>,
       const WorldState&,
       const SetOfEntities&,
       const SetOfEntities&,
@@ -517,7 +518,7 @@ struct ORDEREDGOALSPLANNER_API ConditionNumber : public Condition
       const std::map<Parameter, std::set<Entity>>*,
       const std::map<Parameter, std::set<Entity>>&,
       bool) const override { return true; }
-  bool untilFalse(const std::function<bool (const FactOptional&)>&,
+  bool untilFalse(FunctionRef<bool (const FactOptional&)>,
                   const SetOfFacts&) const override { return true; }
   bool isTrue(const WorldState&,
               const SetOfEntities&,
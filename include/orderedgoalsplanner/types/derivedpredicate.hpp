@@ -15,6 +15,10 @@ struct ORDEREDGOALSPLANNER_API DerivedPredicate
                    const std::string& pConditionStr,
                    const ogp::Ontology& pOntology);
 
+  /// Construct a derived predicate from a condition that is already parsed.
+  DerivedPredicate(const Predicate& pPredicate,
+                   std::unique_ptr<Condition> pCondition);
+
   /// Copy constructor.
   DerivedPredicate(const DerivedPredicate& pDerivedPredicate);
   /// Copy operator.
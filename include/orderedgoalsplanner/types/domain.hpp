@@ -2,6 +2,7 @@
 #define INCLUDE_ORDEREDGOALSPLANNER_TYPES_DOMAIN_HPP
 
 #include <map>
+#include <memory>
 #include <set>
 #include "../util/api.hpp"
 #include <orderedgoalsplanner/util/alias.hpp>
@@ -35,6 +36,24 @@ struct ORDEREDGOALSPLANNER_API Domain
          const SetOfConstFacts& pTimelessFacts = {},
          const std::string& pName = "domain");
 
+  /**
+   * @brief Construct a domain from a content already prepared by another domain, for example loaded from a binary snapshot.<br/>
+   * The actions are not cloned and the successions caches are not recomputed, so they have to be already filled.
+   * @param[in] pActions Map of action identifiers to prepared action.
+   * @param[in] pOntology Ontology of the domain.
+   * @param[in] pIdToSetOfEvents Map of set of events identifiers to prepared set of events.
+   * @param[in] pTimelessFacts Facts that never change.
+   * @param[in] pName Name of the domain.
+   * @param[in] pRequirements Requirements of the domain.
+   * @return The domain.
+   */
+  static std::unique_ptr<Domain> fromPreparedContent(std::map<ActionId, Action>&& pActions,
+                                                     Ontology&& pOntology,
+                                                     std::map<SetOfEventsId, SetOfEvents>&& pIdToSetOfEvents,
+                                                     SetOfConstFacts&& pTimelessFacts,
+                                                     const std::string& pName,
+                                                     const std::set<std::string>& pRequirements);
+
 
   // Actions
   // -------
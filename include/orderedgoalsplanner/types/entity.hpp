@@ -1,9 +1,11 @@
 #ifndef INCLUDE_ORDEREDGOALSPLANNER_ENTITY_HPP
 #define INCLUDE_ORDEREDGOALSPLANNER_ENTITY_HPP
 
+#include <optional>
 #include <string>
 #include <vector>
 #include "../util/api.hpp"
+#include "../util/util.hpp"
 #include "type.hpp"
 
 namespace ogp
@@ -19,6 +21,9 @@ struct ORDEREDGOALSPLANNER_API Entity
   Entity(const std::string& pValue,
          const std::shared_ptr<Type>& pType);
 
+  Entity(const Number& pNumber,
+         const std::shared_ptr<Type>& pType);
+
   Entity(const Entity& pOther) = default;
   Entity(Entity&& pOther) noexcept;
   Entity& operator=(const Entity& pOther) = default;
@@ -32,6 +37,7 @@ struct ORDEREDGOALSPLANNER_API Entity
   static const std::string& anyEntityValue();
   static Entity createAnyEntity();
   static Entity createNumberEntity(const std::string& pNumber);
+  static Entity createNumberEntity(const Number& pNumber);
   static Entity fromDeclaration(const std::string& pStr,
                                 const SetOfTypes& pSetOfTypes);
 
@@ -47,8 +53,18 @@ struct ORDEREDGOALSPLANNER_API Entity
   bool match(const Parameter& pParameter) const;
   bool isValidParameterAccordingToPossiblities(const std::vector<Parameter>& pParameter) const;
 
+  /// Get the numeric value of this entity, or an empty optional if the value is not a number.
+  std::optional<Number> toNumber() const;
+
+  /// Modify the value and keep the numeric value up to date.
+  void setValue(const std::string& pValue);
+
   std::string value;
   std::shared_ptr<Type> type;
+
+private:
+  /// Numeric value, extracted once at construction for the entities of number type.
+  std::optional<Number> _number;
 };
 
 } // !ogp
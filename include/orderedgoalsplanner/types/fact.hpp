@@ -47,6 +47,12 @@ struct ORDEREDGOALSPLANNER_API Fact
        const std::vector<Parameter>& pParameters,
        bool pIsOkIfFluentIsMissing = false);
 
+  /// Construct a fact from arguments that are already resolved, without any look up in an ontology.
+  Fact(const Predicate& pPredicate,
+       std::vector<Entity>&& pArguments,
+       std::optional<Entity>&& pFluent,
+       bool pIsFluentNegated);
+
   /// Destruct the fact.
   ~Fact();
 
@@ -166,6 +172,11 @@ struct ORDEREDGOALSPLANNER_API Fact
   std::string toPddl(bool pInEffectContext,
                      bool pPrintAnyFluent = true) const;
 
+  /// Same as toPddl but append the result to pRes, to avoid intermediate strings.
+  void toPddl(std::string& pRes,
+              bool pInEffectContext,
+              bool pPrintAnyFluent = true) const;
+
   /// Serialize this fact to a string.
   std::string toStr(bool pPrintAnyFluent = true) const;
 
@@ -269,6 +280,7 @@ struct ORDEREDGOALSPLANNER_API Fact
   void generateSignatureForAllUpperTypes(std::list<std::string>& pRes) const;
   void generateSignatureForSubAndUpperTypes(std::list<std::string>& pRes) const;
 
+  void setArgument(std::size_t pIndex, const Entity& pArgument);
   void setArgumentType(std::size_t pIndex, const std::shared_ptr<Type>& pType);
   void setFluentType(const std::shared_ptr<Type>& pType);
   void setFluent(const std::optional<Entity>& pFluent);
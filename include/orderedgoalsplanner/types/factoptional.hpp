@@ -71,6 +71,11 @@ struct ORDEREDGOALSPLANNER_API FactOptional
   std::string toPddl(bool pInEffectContext,
                      bool pPrintAnyFluent = true) const;
 
+  /// Same as toPddl but append the result to pRes, to avoid intermediate strings.
+  void toPddl(std::string& pRes,
+              bool pInEffectContext,
+              bool pPrintAnyFluent = true) const;
+
   bool doesFactEffectOfSuccessorGiveAnInterestForSuccessor(const FactOptional& pOptFact) const;
 
   bool hasAContradictionWith(const std::set<FactOptional>& pFactsOpt,
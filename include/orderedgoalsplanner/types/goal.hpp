@@ -1,9 +1,12 @@
 #ifndef INCLUDE_ORDEREDGOALSPLANNER_GOAL_HPP
 #define INCLUDE_ORDEREDGOALSPLANNER_GOAL_HPP
 
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <chrono>
+#include <vector>
 #include "condition.hpp"
 #include "factoptional.hpp"
 #include "../util/api.hpp"
@@ -12,6 +15,7 @@
 namespace ogp
 {
 struct Domain;
+struct WorldState;
 
 
 // A characteristic that the world should have. It is the motivation of the bot for doing actions to respect this characteristic of the world.
@@ -42,9 +46,12 @@ struct ORDEREDGOALSPLANNER_API Goal
   /// Check not equality with another goal.
   bool operator!=(const Goal& pOther) const { return !operator==(pOther); }
 
-  /// Clone the goal.
+  /// Clone the goal. The objective and the caches are shared with this goal, so it is cheap.
   std::unique_ptr<Goal> clone() const;
 
+  /// Check if the objective of this goal is equal to the objective of another goal.
+  bool hasSameObjectiveAs(const Goal& pOther) const;
+
   /// Set start of inactive time, if not already set. (inactive = not in top of the goals stack)
   void setInactiveSinceIfNotAlreadySet(const std::unique_ptr<std::chrono::steady_clock::time_point>& pInactiveSince);
 
@@ -77,8 +84,8 @@ struct ORDEREDGOALSPLANNER_API Goal
   /// Get a const reference of the optional fact contained in this goal.
   const Condition& objective() const { return *_objective; }
 
-  /// Get a reference of the optional fact contained in this goal.
-  Condition& objective() { return *_objective; }
+  /// Get a reference of the optional fact contained in this goal. The objective stops being shared with other goals.
+  Condition& objective();
 
   /// Get the group identifier of this goal. It can be empty if the goal does not belong to a group.
   const std::string& getGoalGroupId() const { return _goalGroupId; }
@@ -101,8 +108,8 @@ struct ORDEREDGOALSPLANNER_API Goal
 
   bool canDeductionSatisfyThisGoal(const ActionId& pDeductionId) const;
 
-  const std::set<ActionId>& getActionsPredecessors() const { return _cacheOfActionsPredecessors; }
-  const std::set<FullEventId>& getEventsPredecessors() const { return _cacheOfEventsPredecessors; }
+  const std::set<ActionId>& getActionsPredecessors() const { return _getCaches().actionsPredecessors; }
+  const std::set<FullEventId>& getEventsPredecessors() const { return _getCaches().eventsPredecessors; }
 
   /// Persist function name.
   static const std::string& getPersistFunctionName();
@@ -110,8 +117,23 @@ struct ORDEREDGOALSPLANNER_API Goal
   static const std::string& getOneStepTowardsFunctionName();
 
 private:
-  /// Condition that the world should satify in the world.
-  std::unique_ptr<Condition> _objective;
+  /// Actions and events related to the objective for a domain.
+  struct Caches
+  {
+    std::string uuidOfLastDomainUsed;
+    std::set<ActionId> actionsThatCanSatisfyThisGoal;
+    std::set<std::string> eventsIdThatCanSatisfyThisGoal;
+    std::set<ActionId> actionsPredecessors;
+    std::set<FullEventId> eventsPredecessors;
+
+    bool operator==(const Caches& pOther) const;
+  };
+
+  /**
+   * Condition that the world should satify in the world.<br/>
+   * It is shared between the copies of this goal and it is cloned only before being modified.
+   */
+  std::shared_ptr<Condition> _objective;
   /**
    * The maximum time that we allow for this goal to be inactive in second.<br/>
    * A negative value means that the time is infinite.<br/>
@@ -126,11 +148,28 @@ private:
   bool _oneStepTowards;
   /// Group identifier of this goal. It can be empty if the goal does not belong to a group.
   std::string _goalGroupId;
-  std::string _uuidOfLastDomainUsedForCache;
-  std::set<ActionId> _cacheOfActionsThatCanSatisfyThisGoal;
-  std::set<std::string> _cacheOfEventsIdThatCanSatisfyThisGoal;
-  std::set<ActionId> _cacheOfActionsPredecessors;
-  std::set<FullEventId> _cacheOfEventsPredecessors;
+  /// Caches computed by refreshIfNeeded. They are shared between the copies of this goal and never modified in place.
+  std::shared_ptr<const Caches> _caches;
+
+  /// Last evaluation of the objective, valid while the facts that the objective depends on do not change.
+  struct SatisfactionCache
+  {
+    /// Names of the facts that the objective depends on.
+    std::vector<std::string> watchedFactNames;
+    /// Modification stamps of the watched facts in the world state of the last evaluation.
+    std::vector<std::uint64_t> watchedFactStamps;
+    /// Modification stamps of the constants and of the objects during the last evaluation, because the quantifiers depend on them.
+    std::uint64_t constantsStamp = 0;
+    std::uint64_t objectsStamp = 0;
+    /// Result of the last evaluation.
+    bool isSatisfied = false;
+  };
+  /// Cache used by WorldState::isGoalSatisfied.
+  mutable std::optional<SatisfactionCache> _satisfactionCache;
+
+  const Caches& _getCaches() const;
+
+  friend struct WorldState;
 };
 
 } // !ogp
@@ -38,6 +38,12 @@ struct ORDEREDGOALSPLANNER_API Historical
    */
   std::size_t getNbOfTimeAnActionHasAlreadyBeenDone(const ActionId& pActionId) const;
 
+  /**
+   * @brief Get all the actions already done.
+   * @return Map of action identifier to the number of time that the action has already been done.
+   */
+  std::map<ActionId, std::size_t> getActionToNumberOfTimeAlreadyDone() const;
+
 private:
   /// Mutex to proect this struct.
   std::shared_ptr<std::mutex> _mutexPtr;
@@ -6,6 +6,7 @@
 #include <set>
 #include "../util/api.hpp"
 #include <orderedgoalsplanner/types/goal.hpp>
+#include <orderedgoalsplanner/types/plannerstatistics.hpp>
 
 
 namespace ogp
@@ -33,12 +34,23 @@ struct LookForAnActionOutputInfos
   bool isFirstGoalInSuccess() const { return _firstGoalInSuccess && *_firstGoalInSuccess; }
   void moveGoalsDone(std::list<Goal>& pGoals) { pGoals = std::move(_goalsSatisfied); }
 
+  /**
+   * @brief Ask the planner functions that receive this object to fill statistics.<br/>
+   * It does nothing if the library is built without ORDEREDGOALSPLANNER_STATISTICS.
+   */
+  void enableStatistics();
+  /// Statistics accumulated since they were enabled, or null if they are not enabled.
+  const PlannerStatistics* statistics() const { return _statistics ? &*_statistics : nullptr; }
+  /// Mutable access to the statistics, or null if they are not enabled.
+  PlannerStatistics* statisticsPtr() { return _statistics ? &*_statistics : nullptr; }
+
 private:
   PlannerStepType _type;
   std::size_t _nbOfNonPersistentGoalsNotSatisfied;
   std::list<Goal> _goalsSatisfied;
   std::set<const Goal*> _persistentGoalsSatisfied;
   std::optional<bool> _firstGoalInSuccess;
+  std::optional<PlannerStatistics> _statistics;
 };
 
 } // !ogp
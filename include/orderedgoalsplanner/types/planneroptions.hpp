@@ -0,0 +1,80 @@
+#ifndef INCLUDE_ORDEREDGOALSPLANNER_TYPES_PLANNEROPTIONS_HPP
+#define INCLUDE_ORDEREDGOALSPLANNER_TYPES_PLANNEROPTIONS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include "../util/api.hpp"
+
+
+namespace ogp
+{
+struct PlannerStatistics;
+
+
+/// How the planner chooses between the candidate actions of a goal.
+enum class PlannerSearchMode
+{
+  /// Take the most important candidate action without looking further.
+  GREEDY,
+  /// Simulate the plan that follows the candidate actions and take the one that brings the quicker to the goals.
+  ROLLOUT_OPTIMAL
+};
+
+/**
+ * @brief Convert a search mode to a string.
+ * @param[in] pSearchMode Search mode to convert.
+ * @return "greedy" or "rollout-optimal".
+ */
+ORDEREDGOALSPLANNER_API
+std::string plannerSearchModeToStr(PlannerSearchMode pSearchMode);
+
+/**
+ * @brief Convert a string to a search mode.
+ * @param[in] pStr String given by plannerSearchModeToStr.
+ * @return The search mode.
+ * @throw std::runtime_error If the string is not a search mode.
+ */
+ORDEREDGOALSPLANNER_API
+PlannerSearchMode plannerSearchModeFromStr(const std::string& pStr);
+
+
+/// Options to trade the quality of the plans for the time spent to find them.
+struct ORDEREDGOALSPLANNER_API PlannerOptions
+{
+  /// How the planner chooses between the candidate actions of a goal.
+  PlannerSearchMode searchMode = PlannerSearchMode::ROLLOUT_OPTIMAL;
+  /// Number of times planForEveryGoals accepts the same action invocation before stopping a sub plan.
+  std::size_t maxNbOfRepetitionsOfAnAction = 10;
+  /**
+   * @brief Maximum number of actions simulated to evaluate a candidate action. 0 means no limit.<br/>
+   * A truncated simulation is not a failure, but a complete simulation is preferred to it.
+   */
+  std::size_t maxRolloutDepth = 0;
+  /**
+   * @brief Time budget of a planning call. 0 means no limit.<br/>
+   * When it is exceeded the candidate actions are not compared with rollouts anymore
+   * and planForEveryGoals returns the actions already found.
+   */
+  std::chrono::milliseconds timeBudget{0};
+  /// Number of threads that the functions able to plan in parallel can use.
+  std::size_t nbOfThreads = 1;
+  /**
+   * @brief If true and if nbOfThreads is greater than 1, planForEveryGoals splits the goals in partitions
+   * that cannot interfere and plans them in parallel from the same state.<br/>
+   * The plans are merged in the priority order and checked by applying them.
+   * If the merged plan is not valid the goals are planned sequentially.
+   */
+  bool planIndependentGoalsInParallel = false;
+  /**
+   * @brief If not null, the statistics of the planning calls are added to it.<br/>
+   * It is only filled if the library is built with ORDEREDGOALSPLANNER_STATISTICS.
+   */
+  PlannerStatistics* statisticsPtr = nullptr;
+};
+
+
+} // !ogp
+
+
+#endif // INCLUDE_ORDEREDGOALSPLANNER_TYPES_PLANNEROPTIONS_HPP
@@ -0,0 +1,72 @@
+#ifndef INCLUDE_ORDEREDGOALSPLANNER_TYPES_PLANNERSTATISTICS_HPP
+#define INCLUDE_ORDEREDGOALSPLANNER_TYPES_PLANNERSTATISTICS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include "../util/api.hpp"
+
+
+namespace ogp
+{
+
+
+/**
+ * @brief Counters and cumulative wall times of the planner.<br/>
+ * They are only filled if the library is built with ORDEREDGOALSPLANNER_STATISTICS
+ * (CMake option ORDEREDGOALSPLANNER_ENABLE_STATISTICS) and if they are enabled in LookForAnActionOutputInfos.
+ */
+struct ORDEREDGOALSPLANNER_API PlannerStatistics
+{
+  /// Number of actions considered to satisfy a goal.
+  std::size_t nbOfCandidateActionsEvaluated = 0;
+  /// Number of times the planner looked in an effect for a way to satisfy a goal.
+  std::size_t nbOfLookForAPossibleEffectCalls = 0;
+  /// Number of simulated plans done to compare the cost of two candidate actions.
+  std::size_t nbOfRollouts = 0;
+  /// Number of simulated plans stopped at the maximum rollout depth.
+  std::size_t nbOfTruncatedRollouts = 0;
+  /// Number of partitions of independent goals planned in parallel.
+  std::size_t nbOfGoalPartitionsPlannedInParallel = 0;
+  /// Number of copies of the problem done by the planner.
+  std::size_t nbOfProblemCopies = 0;
+  /// Number of loops done to apply the events after a modification of the world.
+  std::size_t nbOfEventPropagationRounds = 0;
+  /// Number of times the cache of a goal or of a world state was up to date.
+  std::size_t nbOfCacheHits = 0;
+  /// Number of times the cache of a goal or of a world state had to be recomputed.
+  std::size_t nbOfCacheMisses = 0;
+  /// Number of times the satisfaction of a goal was given by its cache.
+  std::size_t nbOfGoalSatisfactionCacheHits = 0;
+  /// Number of times the objective of a goal had to be evaluated again.
+  std::size_t nbOfGoalSatisfactionCacheMisses = 0;
+
+  /// Time spent to refresh the goals.
+  std::chrono::nanoseconds goalRefreshDuration{0};
+  /// Time spent to refresh the cache of the world state.
+  std::chrono::nanoseconds cacheRefreshDuration{0};
+  /// Time spent to look for the next action of a goal.
+  std::chrono::nanoseconds candidateSearchDuration{0};
+  /// Time spent in the simulated plans. It is included in candidateSearchDuration.
+  std::chrono::nanoseconds rolloutDuration{0};
+  /// Time spent to apply the effects of the actions.
+  std::chrono::nanoseconds effectApplicationDuration{0};
+
+  /**
+   * @brief Add the counters and the durations of other statistics to this one.
+   * @param[in] pOther Other statistics.
+   */
+  void add(const PlannerStatistics& pOther);
+
+  /**
+   * @brief Convert the statistics to a string with one "name: value" per line.
+   * @return The statistics as a string. The durations are in microseconds.
+   */
+  std::string toStr() const;
+};
+
+
+} // !ogp
+
+
+#endif // INCLUDE_ORDEREDGOALSPLANNER_TYPES_PLANNERSTATISTICS_HPP
@@ -0,0 +1,34 @@
+#ifndef INCLUDE_ORDEREDGOALSPLANNER_TYPES_PLANVALIDATIONRESULT_HPP
+#define INCLUDE_ORDEREDGOALSPLANNER_TYPES_PLANVALIDATIONRESULT_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include "../util/api.hpp"
+
+
+namespace ogp
+{
+
+/// Result of the validation of a plan.
+struct ORDEREDGOALSPLANNER_API PlanValidationResult
+{
+  /// Is the plan executable from the world state.
+  bool isValid() const { return !failingStepIndex; }
+
+  /// Convert the result to a human readable string.
+  std::string toStr() const;
+
+  /// Index of the first step that cannot be done, or nothing if the plan is valid.
+  std::optional<std::size_t> failingStepIndex;
+  /// Identifier of the action of the failing step that cannot be done.
+  std::string failingActionId;
+  /// Why the failing step cannot be done.
+  std::string reason;
+};
+
+
+} // !ogp
+
+
+#endif // INCLUDE_ORDEREDGOALSPLANNER_TYPES_PLANVALIDATIONRESULT_HPP
@@ -19,6 +19,10 @@ struct ORDEREDGOALSPLANNER_API Predicate
             std::size_t pBeginPos = 0,
             std::size_t* pResPos = nullptr);
 
+  Predicate(const std::string& pName,
+            const std::vector<Parameter>& pParameters,
+            const std::shared_ptr<Type>& pFluent);
+
   std::string toPddl() const;
   std::string toStr() const;
 
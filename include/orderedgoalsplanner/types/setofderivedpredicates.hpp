@@ -21,6 +21,7 @@ struct ORDEREDGOALSPLANNER_API SetOfDerivedPredicates
   void addDerivedPredicate(const DerivedPredicate& pDerivedPredicate);
 
   const Predicate* nameToPredicatePtr(const std::string& pPredicateName) const;
+  const std::map<std::string, DerivedPredicate>& nameToDerivedPredicates() const { return _nameToDerivedPredicate; }
 
   std::unique_ptr<Condition> optFactToConditionPtr(const FactOptional& pFactOptional) const;
 
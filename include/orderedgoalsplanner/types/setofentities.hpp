@@ -2,6 +2,7 @@
 #define INCLUDE_ORDEREDGOALSPLANNER_TYPES_SETOFENTITIES_HPP
 
 #include "../util/api.hpp"
+#include <cstdint>
 #include <list>
 #include <map>
 #include <set>
@@ -29,13 +30,24 @@ struct ORDEREDGOALSPLANNER_API SetOfEntities
 
   const Entity* valueToEntity(const std::string& pValue) const;
 
+  /// Get all the entities indexed by their value.
+  const std::map<std::string, Entity>& valueToEntities() const { return _valueToEntity; }
+
   std::string toStr(std::size_t pIdentation = 0) const;
 
   bool empty() const { return _valueToEntity.empty(); }
 
+  /**
+   * @brief Get the stamp of the last modification of the entities.<br/>
+   * A stamp is unique among all the sets of entities and it is kept by the copies,
+   * so two sets of entities with the same stamp have the same entities.
+   */
+  std::uint64_t modificationStamp() const { return _modificationStamp; }
+
 private:
   std::map<std::string, Entity> _valueToEntity;
   std::map<std::string, std::set<Entity>> _typeNameToEntities;
+  std::uint64_t _modificationStamp;
 };
 
 } // namespace ogp
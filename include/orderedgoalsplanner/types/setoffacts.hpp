@@ -31,6 +31,9 @@ struct ORDEREDGOALSPLANNER_API SetOfFacts
 
   std::string toPddl(std::size_t pIdentation, bool pPrintTimeLessFactsToo) const;
 
+  /// Same as toPddl but append the result to pRes, to avoid intermediate strings.
+  void toPddl(std::string& pRes, std::size_t pIdentation, bool pPrintTimeLessFactsToo) const;
+
   void add(const Fact& pFact,
            bool pCanBeRemoved = true);
 
@@ -107,6 +110,15 @@ struct ORDEREDGOALSPLANNER_API SetOfFacts
 
   bool hasFact(const Fact& pFact) const;
 
+  /**
+   * @brief Get an upper bound of the number of facts that can match a fact, without iterating over them.
+   * @param[in] pFact Fact to consider. Its arguments that are parameters to fill can match any value.
+   * @return Size of the smallest index that contains all the facts that can match.<br/>
+   * It is 0 if no fact has the signature of pFact or if a constant argument of pFact is in no fact at this position,
+   * because no fact can match in these cases.
+   */
+  std::size_t estimateNbOfMatchingFacts(const Fact& pFact) const;
+
   bool empty() const { return _facts.empty(); }
 
 private:
@@ -34,6 +34,7 @@ struct ORDEREDGOALSPLANNER_API SetOfPredicates
 
   const Predicate* nameToPredicatePtr(const std::string& pName) const;
   Predicate nameToPredicate(const std::string& pName) const;
+  const std::map<std::string, Predicate>& nameToPredicates() const { return _nameToPredicate; }
 
   std::string toPddl(PredicatePddlType pTypeFilter, std::size_t pIdentation = 0) const;
   std::string toStr() const;
@@ -23,6 +23,9 @@ struct ORDEREDGOALSPLANNER_API SetOfTypes
   std::shared_ptr<Type> nameToType(const std::string& pName) const;
   static std::shared_ptr<Type> numberType();
 
+  /// Types without parent. The other types are in their subtypes.
+  const std::list<std::shared_ptr<Type>>& rootTypes() const { return _types; }
+
   std::list<std::string> typesToStrs() const;
   std::string toStr(std::size_t pIdentation = 0) const;
   bool empty() const;
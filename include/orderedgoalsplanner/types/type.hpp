@@ -31,6 +31,13 @@ struct ORDEREDGOALSPLANNER_API Type
   const std::string name;
   const std::shared_ptr<Type> parent;
   std::list<std::shared_ptr<Type>> subTypes;
+
+  /// Interval encoding of the position of this type in its hierarchy (pre-order and post-order indexes).
+  /// A type is a sub-type of another type of the same hierarchy if its interval is included in the other one.
+  std::size_t preOrderIndex;
+  std::size_t postOrderIndex;
+  /// Root of the hierarchy where the indexes above are valid, nullptr if they are not computed.
+  const Type* hierarchyRootPtr;
 };
 
 } // namespace ogp
@@ -2,6 +2,7 @@
 #define INCLUDE_ORDEREDGOALSPLANNER_TYPES_WORLDSTATE_HPP
 
 #include <chrono>
+#include <cstdint>
 #include <list>
 #include <map>
 #include <memory>
@@ -10,6 +11,7 @@
 #include <orderedgoalsplanner/types/factstovalue.hpp>
 #include <orderedgoalsplanner/types/setoffacts.hpp>
 #include <orderedgoalsplanner/util/alias.hpp>
+#include <orderedgoalsplanner/util/functionref.hpp>
 #include <orderedgoalsplanner/util/observableunsafe.hpp>
 #include "../util/api.hpp"
 
@@ -161,6 +163,7 @@ struct ORDEREDGOALSPLANNER_API WorldState
    * For example the current goal of the stack can be satisfied now and so maybe it should be removed from the goal stack.
    * @param[in] pSetOfEvents events to apply indirect modifications according to the events.
    * @param[in] pNow Current time.
+   * @param[in] pParametersPtr Parameters to replace by their argument in the modification, or nullptr if it has no parameter.
    */
   bool modify(const WorldStateModification* pWsModifPtr,
               GoalStack& pGoalStack,
@@ -169,7 +172,19 @@ struct ORDEREDGOALSPLANNER_API WorldState
               const Ontology& pOntology,
               const SetOfEntities& pEntities,
               const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
-              bool pCanFactsBeRemoved = true);
+              bool pCanFactsBeRemoved = true,
+              const std::map<Parameter, Entity>* pParametersPtr = nullptr);
+
+  /**
+   * @brief Add and remove facts without deducing anything from them.<br/>
+   * No event or callback is applied and the goal stack is not refreshed, so it is meant to replicate
+   * in this world state some modifications already done and propagated in another world state.
+   * @param[in] pFactsToAdd Facts to add.
+   * @param[in] pFactsToRemove Facts to remove. They are removed after the addition of the facts to add.
+   * @return True if some facts were added or removed, false otherwise.
+   */
+  bool replicateModifications(const std::vector<Fact>& pFactsToAdd,
+                              const std::vector<Fact>& pFactsToRemove);
 
   /**
    * @brief Set the facts of the world.
@@ -239,7 +254,8 @@ struct ORDEREDGOALSPLANNER_API WorldState
 
   /**
    * @brief Check if a goal is satisfied.<br/>
-   * A goal is satisfied if his internal objective condition is satisfied and if the goal is enabled.
+   * A goal is satisfied if his internal objective condition is satisfied and if the goal is enabled.<br/>
+   * The result is cached in the goal and the objective is only evaluated again if a fact that it depends on changed.
    * @param[in] pGoal Goal to check.
    * @return True if the goal is satisfied.
    */
@@ -254,7 +270,7 @@ struct ORDEREDGOALSPLANNER_API WorldState
    * @param[in] pParametersToConsiderAsAnyValue Parameters to consider as "any value" if there possible values (set of string) is empty.
    * @param[in] pParametersToConsiderAsAnyValuePtr Other parameters to consider as "any value" if there possible values (set of string) is empty.
    */
-  void iterateOnMatchingFactsWithoutFluentConsideration(const std::function<bool (const Fact&)>& pCallback,
+  void iterateOnMatchingFactsWithoutFluentConsideration(FunctionRef<bool (const Fact&)> pCallback,
                                                         const Fact& pFact,
                                                         const std::map<Parameter, std::set<Entity>>& pParametersToConsiderAsAnyValue,
                                                         const std::map<Parameter, std::set<Entity>>* pParametersToConsiderAsAnyValuePtr = nullptr) const;
@@ -266,7 +282,7 @@ struct ORDEREDGOALSPLANNER_API WorldState
    * @param[in] pParametersToConsiderAsAnyValue Parameters to consider as "any value" if there possible values (set of string) is empty.
    * @param[in] pParametersToConsiderAsAnyValuePtr Other parameters to consider as "any value" if there possible values (set of string) is empty.
    */
-  void iterateOnMatchingFacts(const std::function<bool (const Fact&)>& pValueCallback,
+  void iterateOnMatchingFacts(FunctionRef<bool (const Fact&)> pValueCallback,
                               const Fact& pFact,
                               const std::map<Parameter, std::set<Entity>>& pParametersToConsiderAsAnyValue,
                               const std::map<Parameter, std::set<Entity>>* pParametersToConsiderAsAnyValuePtr = nullptr) const;
@@ -281,6 +297,19 @@ private:
   /// Facts of the world state.
   SetOfFacts _factsMapping;
   std::unique_ptr<WorldStateCache> _cache;
+  /// Modification stamp of the facts that were never modified since the initialization.
+  std::uint64_t _initialModificationStamp;
+  /**
+   * Fact names to the stamp of the last modification of their facts.<br/>
+   * A stamp is unique among all the world states and it is kept by the copies,
+   * so two world states with the same stamp for a fact name have the same facts with this name.
+   */
+  std::map<std::string, std::uint64_t> _factNameToModificationStamp;
+
+  /// Get the stamp of the last modification of the facts with a name.
+  std::uint64_t _getModificationStamp(const std::string& pFactName) const;
+  /// Give a new modification stamp to the facts with the name of a fact.
+  void _notifyFactModified(const Fact& pFact);
 
   /// Stored what changed.
   struct WhatChanged
@@ -351,6 +380,7 @@ private:
    * For example the current goal of the stack can be satisfied now and so maybe it should be removed from the goal stack.
    * @param[in] pSetOfEvents events to apply indirect modifications according to the events.
    * @param[in] pNow Current time.
+   * @param[in] pParametersPtr Parameters to replace by their argument in the modification, or nullptr if it has no parameter.
    */
   void _modify(WhatChanged& pWhatChanged,
                const WorldStateModification* pWsModifPtr,
@@ -360,7 +390,8 @@ private:
                const Ontology& pOntology,
                const SetOfEntities& pEntities,
                const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
-               bool pCanFactsBeRemoved);
+               bool pCanFactsBeRemoved,
+               const std::map<Parameter, Entity>* pParametersPtr = nullptr);
 
   /**
    * @brief Try to apply some events according to what changed in the world state.
@@ -2,12 +2,14 @@
 #define INCLUDE_ORDEREDGOALSPLANNER_WORLDSTATEMODIFICATION_HPP
 
 #include <functional>
+#include <map>
 #include <memory>
 #include <optional>
 #include "factoptional.hpp"
 #include "../util/api.hpp"
 #include <orderedgoalsplanner/util/alias.hpp>
 #include <orderedgoalsplanner/util/continueorbreak.hpp>
+#include <orderedgoalsplanner/util/functionref.hpp>
 
 namespace ogp
 {
@@ -29,6 +31,17 @@ struct ORDEREDGOALSPLANNER_API WorldStateModificationContainerId
 
 
 
+/// Buffers reused while the facts of an effect are iterated with parameters.<br/>
+/// The parameters are substituted in place, instead of allocating a new fact and a new binding map for each fact.
+struct ORDEREDGOALSPLANNER_API WorldStateModificationScratch
+{
+  /// Last fact of the effect with the parameters substituted.
+  std::optional<FactOptional> factOptional;
+  /// Effect parameters and for all parameters bound to their current value.
+  std::map<Parameter, Entity> parameters;
+};
+
+
 struct ORDEREDGOALSPLANNER_API Successions
 {
   bool empty() const { return actions.empty() && events.empty(); }
@@ -89,18 +102,25 @@ struct ORDEREDGOALSPLANNER_API WorldStateModification
    * @brief Iterate over all the optional facts with fact value resolution according to the world state.
    * @param[in] pFactCallback Callback called for each optional fact of this object.
    * @param[in] pSetOfFact Facts to use to extract value of the facts.
+   * @param[in] pParametersPtr Parameters to replace by their argument in the facts given to the callback.<br/>
+   * It allows to apply a parameterized effect without cloning it.
+   * @param[in, out] pScratchPtr Buffers to reuse for the substitution of the parameters.<br/>
+   * If it is null, buffers local to this call are used. The fact given to the callback can refer to these buffers,
+   * so it is only valid during the callback.
    */
-  virtual void forAll(const std::function<void (const FactOptional&)>& pFactCallback,
-                      const SetOfFacts& pSetOfFact) const = 0;
+  virtual void forAll(FunctionRef<void (const FactOptional&)> pFactCallback,
+                      const SetOfFacts& pSetOfFact,
+                      const std::map<Parameter, Entity>* pParametersPtr = nullptr,
+                      WorldStateModificationScratch* pScratchPtr = nullptr) const = 0;
 
-  virtual ContinueOrBreak forAllThatCanBeModified(const std::function<ContinueOrBreak (const FactOptional&)>& pFactCallback) const = 0;
+  virtual ContinueOrBreak forAllThatCanBeModified(FunctionRef<ContinueOrBreak (const FactOptional&)> pFactCallback) const = 0;
 
   /**
    * @brief Iterate over all the optional facts that can be accessible.
    * @param[in] pFactCallback Callback called for each optional fact that can be accessible.
    * @param[in] pSetOfFact Facts to use to extract value of the facts.
    */
-  virtual void iterateOverAllAccessibleFacts(const std::function<void (const FactOptional&)>& pFactCallback,
+  virtual void iterateOverAllAccessibleFacts(FunctionRef<void (const FactOptional&)> pFactCallback,
                                              const SetOfFacts& pSetOfFact) const = 0;
 
   /**
@@ -108,7 +128,7 @@ struct ORDEREDGOALSPLANNER_API WorldStateModification
    * @param[in] pFactCallback Callback called for each optional fact of this object.
    * @param[in] pSetOfFact Facts to use to extract value of the facts.
    */
-  virtual bool forAllUntilTrue(const std::function<bool (const FactOptional&)>& pFactCallback,
+  virtual bool forAllUntilTrue(FunctionRef<bool (const FactOptional&)> pFactCallback,
                                const SetOfFacts& pSetOfFact) const = 0;
 
   /**
@@ -118,12 +138,12 @@ struct ORDEREDGOALSPLANNER_API WorldStateModification
    * @param[in] pWorldState World state use to extract value of the facts.
    * @param[in] pFromDeductionId Identifier of the deduction holding the world state modification.
    */
-  virtual bool canSatisfyObjective(const std::function<bool (const FactOptional&, std::map<Parameter, std::set<Entity>>*, const std::function<bool (const std::map<Parameter, std::set<Entity>>&)>&)>& pFactCallback,
+  virtual bool canSatisfyObjective(FunctionRef<bool (const FactOptional&, std::map<Parameter, std::set<Entity>>*, FunctionRef<bool (const std::map<Parameter, std::set<Entity>>&)>)> pFactCallback,
                                    std::map<Parameter, std::set<Entity>>& pParameters,
                                    const WorldState& pWorldState,
                                    const std::string& pFromDeductionId) const = 0;
 
-  virtual bool iterateOnSuccessions(const std::function<bool (const Successions&, const FactOptional&, std::map<Parameter, std::set<Entity>>*, const std::function<bool (const std::map<Parameter, std::set<Entity>>&)>&)>& pCallback,
+  virtual bool iterateOnSuccessions(FunctionRef<bool (const Successions&, const FactOptional&, std::map<Parameter, std::set<Entity>>*, FunctionRef<bool (const std::map<Parameter, std::set<Entity>>&)>)> pCallback,
                                     std::map<Parameter, std::set<Entity>>& pParameters,
                                     const WorldState& pWorldState,
                                     bool pCanSatisfyThisGoal,
@@ -143,9 +163,11 @@ struct ORDEREDGOALSPLANNER_API WorldStateModification
   /**
    * @brief Convert this world state modification to a value.
    * @param[in] pWorldState World state use to extract value of the facts.
+   * @param[in] pParametersPtr Parameters to replace by their argument before extracting the value.
    * @return The world state modification converted to a string value.
    */
-  virtual std::optional<Entity> getFluent(const SetOfFacts& pSetOfFact) const = 0;
+  virtual std::optional<Entity> getFluent(const SetOfFacts& pSetOfFact,
+                                          const std::map<Parameter, Entity>* pParametersPtr = nullptr) const = 0;
 
   /// Convert this world state modification to an optional fact if possible.
   virtual const FactOptional* getOptionalFact() const = 0;
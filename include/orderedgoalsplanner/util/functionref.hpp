@@ -0,0 +1,53 @@
+#ifndef INCLUDE_ORDEREDGOALSPLANNER_UTIL_FUNCTIONREF_HPP
+#define INCLUDE_ORDEREDGOALSPLANNER_UTIL_FUNCTIONREF_HPP
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace ogp
+{
+
+template<typename Signature>
+class FunctionRef;
+
+
+/// Non-owning reference to a callable, used instead of std::function for the traversal callbacks.
+/// It never allocates and only stores two pointers, so it must not outlive the referenced callable.
+/// It is meant to be passed by value as a function parameter, to be called during the function execution.
+template<typename Ret, typename... Args>
+class FunctionRef<Ret(Args...)>
+{
+public:
+  template<typename Callable,
+           typename = std::enable_if_t<!std::is_same<std::decay_t<Callable>, FunctionRef>::value>>
+  FunctionRef(Callable&& pCallable)
+    : _callablePtr(const_cast<void*>(static_cast<const void*>(std::addressof(pCallable)))),
+      _invokePtr(&_invoke<std::remove_reference_t<Callable>>)
+  {
+  }
+
+  FunctionRef(const FunctionRef& pOther) = default;
+  FunctionRef& operator=(const FunctionRef& pOther) = default;
+
+  Ret operator()(Args... pArgs) const
+  {
+    return _invokePtr(_callablePtr, std::forward<Args>(pArgs)...);
+  }
+
+private:
+  void* _callablePtr;
+  Ret (*_invokePtr)(void*, Args...);
+
+  template<typename Callable>
+  static Ret _invoke(void* pCallablePtr, Args... pArgs)
+  {
+    return static_cast<Ret>((*static_cast<Callable*>(pCallablePtr))(std::forward<Args>(pArgs)...));
+  }
+};
+
+
+} // !ogp
+
+
+#endif // INCLUDE_ORDEREDGOALSPLANNER_UTIL_FUNCTIONREF_HPP
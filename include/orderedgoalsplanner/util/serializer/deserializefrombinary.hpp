@@ -0,0 +1,39 @@
+#ifndef INCLUDE_ORDEREDGOALSPLANNER_UTIL_SERIALIZER_DESERIALIZEFROMBINARY_HPP
+#define INCLUDE_ORDEREDGOALSPLANNER_UTIL_SERIALIZER_DESERIALIZEFROMBINARY_HPP
+
+#include <memory>
+#include <string>
+#include "../api.hpp"
+
+namespace ogp
+{
+struct Domain;
+struct Problem;
+
+
+/**
+ * @brief Load a prepared domain from a binary snapshot generated by domainToBinary.<br/>
+ * No PDDL is parsed and the successions caches are read instead of being computed.
+ * @param[in] pBinary Binary snapshot.
+ * @return The domain.
+ */
+ORDEREDGOALSPLANNER_API
+std::unique_ptr<Domain> binaryToDomain(const std::string& pBinary);
+
+
+/**
+ * @brief Load a problem from a binary snapshot generated by problemToBinary.<br/>
+ * No PDDL is parsed for the objects and the facts, only the goal conditions are stored in PDDL.
+ * @param[in] pBinary Binary snapshot.
+ * @param[in] pDomain Domain of the problem. It is referred by the problem and not copied, so it has to outlive the problem.
+ * @return The problem.
+ */
+ORDEREDGOALSPLANNER_API
+std::unique_ptr<Problem> binaryToProblem(const std::string& pBinary,
+                                         const Domain& pDomain);
+
+} // End of namespace ogp
+
+
+
+#endif // INCLUDE_ORDEREDGOALSPLANNER_UTIL_SERIALIZER_DESERIALIZEFROMBINARY_HPP
@@ -12,6 +12,7 @@ struct Condition;
 struct Domain;
 struct Goal;
 struct Ontology;
+struct ParallelPan;
 struct Parameter;
 struct SetOfEntities;
 struct WorldStateModification;
@@ -73,6 +74,21 @@ std::vector<Parameter> pddlToParameters(const std::string& pStr,
                                         const SetOfTypes& pSetOfTypes);
 
 
+/**
+ * @brief Read a plan written by planToPddl or parallelPlanToPddl.<br/>
+ * Each line is "<step>: (<action> <arguments>...) [<duration>]" and the consecutive lines of the same step are done in parallel.<br/>
+ * A line without step index is a step alone. Empty lines and lines starting with ';' are ignored.
+ * @param[in] pStr Plan to read.
+ * @param[in] pDomain Domain of the actions.
+ * @param[in] pEntities Entities of the problem, in addition to the constants of the domain.
+ * @return The plan, without the goals that motivated the actions.
+ * @throw std::runtime_error If an action or an argument is unknown.
+ */
+ParallelPan pddlToParallelPlan(const std::string& pStr,
+                               const Domain& pDomain,
+                               const SetOfEntities& pEntities);
+
+
 } // End of namespace ogp
 
 
@@ -0,0 +1,40 @@
+#ifndef INCLUDE_ORDEREDGOALSPLANNER_UTIL_SERIALIZER_SERIALIZEINBINARY_HPP
+#define INCLUDE_ORDEREDGOALSPLANNER_UTIL_SERIALIZER_SERIALIZEINBINARY_HPP
+
+#include <string>
+#include "../api.hpp"
+
+namespace ogp
+{
+struct Domain;
+struct Problem;
+
+
+/**
+ * @brief Serialize a problem in a versioned binary snapshot.<br/>
+ * The snapshot contains the objects, the facts, the goals and the historical of the problem.<br/>
+ * The strings are interned in a symbol table, so the facts are stored as lists of indexes.
+ * @param[in] pProblem Problem to serialize.
+ * @param[in] pDomain Domain of the problem.
+ * @return The binary snapshot.
+ */
+ORDEREDGOALSPLANNER_API
+std::string problemToBinary(const Problem& pProblem,
+                            const Domain& pDomain);
+
+
+/**
+ * @brief Serialize a prepared domain in a versioned binary snapshot.<br/>
+ * The snapshot contains the ontology, the timeless facts, the actions and the events with their successions caches,
+ * so that loading it does not need to parse PDDL nor to compute the successions again.
+ * @param[in] pDomain Domain to serialize.
+ * @return The binary snapshot.
+ */
+ORDEREDGOALSPLANNER_API
+std::string domainToBinary(const Domain& pDomain);
+
+} // End of namespace ogp
+
+
+
+#endif // INCLUDE_ORDEREDGOALSPLANNER_UTIL_SERIALIZER_SERIALIZEINBINARY_HPP
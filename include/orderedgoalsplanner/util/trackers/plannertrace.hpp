@@ -0,0 +1,141 @@
+#ifndef INCLUDE_TRACKERS_PLANNERTRACE_HPP
+#define INCLUDE_TRACKERS_PLANNERTRACE_HPP
+
+#include <chrono>
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../api.hpp"
+#include <orderedgoalsplanner/types/actioninvocationwithgoal.hpp>
+#include <orderedgoalsplanner/types/goalstack.hpp>
+
+
+namespace ogp
+{
+struct Domain;
+struct Fact;
+struct Historical;
+struct LookForAnActionOutputInfos;
+struct Problem;
+struct SetOfCallbacks;
+
+
+/// Kind of planner call stored in a trace.
+enum class PlannerTraceCallType
+{
+  ADD_FACTS,
+  REMOVE_FACTS,
+  PUSH_BACK_GOAL,
+  PLAN_FOR_MORE_IMPORTANT_GOAL_POSSIBLE,
+  NOTIFY_ACTION_STARTED,
+  NOTIFY_ACTION_DONE
+};
+
+/// Get the name of a kind of planner call.
+ORDEREDGOALSPLANNER_API
+std::string plannerTraceCallTypeToStr(PlannerTraceCallType pCallType);
+
+
+/**
+ * @brief Call the planner functions on a problem and record these calls with their inputs in a compact binary trace.<br/>
+ * The trace starts with a snapshot of the domain and of the problem, so it can be replayed alone by replayPlannerTrace.<br/>
+ * The callbacks and the global historical are not recorded.
+ */
+struct ORDEREDGOALSPLANNER_API PlannerTraceRecorder
+{
+  /**
+   * @brief Construct a recorder.<br/>
+   * The problem and the domain have to outlive this object, and they should only be modified through this object.
+   * @param[in, out] pProblem Problem to drive.
+   * @param[in] pDomain Domain of the problem.
+   */
+  PlannerTraceRecorder(Problem& pProblem,
+                       const Domain& pDomain);
+
+  /// Add facts in the world, like WorldState::addFacts.
+  bool addFacts(const std::vector<Fact>& pFacts,
+                const SetOfCallbacks& pCallbacks,
+                const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow);
+
+  /// Remove facts from the world, like WorldState::removeFacts.
+  bool removeFacts(const std::vector<Fact>& pFacts,
+                   const SetOfCallbacks& pCallbacks,
+                   const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow);
+
+  /// Add a goal after the existing goals of the same priority, like GoalStack::pushBackGoal.
+  void pushBackGoal(const Goal& pGoal,
+                    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+                    int pPriority = GoalStack::getDefaultPriority());
+
+  /// Look for the next action to do, like ogp::planForMoreImportantGoalPossible.
+  std::list<ActionInvocationWithGoal> planForMoreImportantGoalPossible(
+      bool pTryToDoMoreOptimalSolution,
+      const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+      const Historical* pGlobalHistorical = nullptr,
+      LookForAnActionOutputInfos* pLookForAnActionOutputInfosPtr = nullptr);
+
+  /// Notify that an action started, like ogp::notifyActionStarted.
+  void notifyActionStarted(const SetOfCallbacks& pCallbacks,
+                           const ActionInvocationWithGoal& pActionInvocationWithGoal,
+                           const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow);
+
+  /// Notify that an action finished, like ogp::notifyActionDone.
+  bool notifyActionDone(const SetOfCallbacks& pCallbacks,
+                        const ActionInvocationWithGoal& pOnStepOfPlannerResult,
+                        const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+                        LookForAnActionOutputInfos* pLookForAnActionOutputInfosPtr = nullptr);
+
+  /**
+   * @brief Get the part of the trace recorded since the construction or since the previous call of this function.<br/>
+   * The concatenation of all the returned strings is the full trace, so they can be appended to a file as they come.
+   * @return The new part of the trace.
+   */
+  std::string takeTrace();
+
+private:
+  Problem& _problem;
+  const Domain& _domain;
+  /// Time used as origin of the time points of the trace.
+  const std::chrono::steady_clock::time_point _origin;
+  /// Part of the trace that is not taken yet.
+  std::string _trace;
+
+  void _writeCallHeader(PlannerTraceCallType pCallType,
+                        const std::chrono::steady_clock::time_point& pCallBegin,
+                        const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow);
+  void _writeActionInvocation(const ActionInvocationWithGoal& pActionInvocationWithGoal);
+};
+
+
+/// Result of the replay of one call of a trace.
+struct ORDEREDGOALSPLANNER_API PlannerTraceCallReplayed
+{
+  /// Index of the call in the trace.
+  std::size_t index = 0;
+  /// Kind of call.
+  PlannerTraceCallType type = PlannerTraceCallType::ADD_FACTS;
+  /// Duration of the call when it was recorded.
+  std::chrono::nanoseconds recordedDuration{0};
+  /// Duration of the call during the replay.
+  std::chrono::nanoseconds replayedDuration{0};
+  /// True if the replayed call returned the same result as the recorded call.
+  bool sameResult = true;
+};
+
+
+/**
+ * @brief Run the calls of a trace recorded by PlannerTraceRecorder and measure each of them.
+ * @param[in] pTrace Trace to replay.
+ * @param[in] pOnCallReplayed Callback called after each replayed call.
+ * @throw std::runtime_error If the trace is not valid.
+ */
+ORDEREDGOALSPLANNER_API
+void replayPlannerTrace(const std::string& pTrace,
+                        const std::function<void(const PlannerTraceCallReplayed&)>& pOnCallReplayed);
+
+} // !ogp
+
+
+#endif // INCLUDE_TRACKERS_PLANNERTRACE_HPP
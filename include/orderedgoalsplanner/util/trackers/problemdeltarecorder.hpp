@@ -0,0 +1,67 @@
+#ifndef INCLUDE_TRACKERS_PROBLEMDELTARECORDER_HPP
+#define INCLUDE_TRACKERS_PROBLEMDELTARECORDER_HPP
+
+#include <map>
+#include <string>
+#include "../api.hpp"
+#include <orderedgoalsplanner/types/historical.hpp>
+#include <orderedgoalsplanner/util/observableunsafe.hpp>
+
+
+namespace ogp
+{
+struct Domain;
+struct Problem;
+
+/**
+ * @brief Record the modifications of a problem in a compact delta log.<br/>
+ * The delta log can be applied on a replica of the problem with applyProblemDeltaLog, so that the replica
+ * does not need to receive a full snapshot of the problem after each step.
+ */
+struct ORDEREDGOALSPLANNER_API ProblemDeltaRecorder
+{
+  /**
+   * @brief Construct a recorder.<br/>
+   * The problem has to outlive this object.
+   * @param[in] pProblem Problem to track.
+   */
+  ProblemDeltaRecorder(const Problem& pProblem);
+  ~ProblemDeltaRecorder();
+  ProblemDeltaRecorder(const ProblemDeltaRecorder&) = delete;
+  ProblemDeltaRecorder& operator=(const ProblemDeltaRecorder&) = delete;
+
+  /**
+   * @brief Get the modifications done since the construction or since the previous call of this function.
+   * @return The delta log. It is empty if nothing changed.
+   */
+  std::string takeDeltaLog();
+
+
+private:
+  const Problem& _problem;
+  /// Entries of the delta log that are not taken yet.
+  std::string _entries;
+  /// Historical already present in a delta log.
+  std::map<ActionId, std::size_t> _actionToNumberOfTimeAlreadyLogged;
+  ogpstd::observable::Connection _onFactsAddedConnection;
+  ogpstd::observable::Connection _onFactsRemovedConnection;
+  ogpstd::observable::Connection _onGoalsChangedConnection;
+};
+
+
+/**
+ * @brief Apply a delta log on a replica of the tracked problem.<br/>
+ * The facts are replicated without applying the events, because their consequences are already in the delta log.
+ * @param[in] pDeltaLog Delta log given by ProblemDeltaRecorder::takeDeltaLog.
+ * @param[in, out] pProblem Replica to modify.
+ * @param[in] pDomain Domain of the problem.
+ */
+ORDEREDGOALSPLANNER_API
+void applyProblemDeltaLog(const std::string& pDeltaLog,
+                          Problem& pProblem,
+                          const Domain& pDomain);
+
+} // !ogp
+
+
+#endif // INCLUDE_TRACKERS_PROBLEMDELTARECORDER_HPP
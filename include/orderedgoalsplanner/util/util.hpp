@@ -27,6 +27,9 @@ using Number = std::variant<int, float>;
 // Function to convert a string to either an int or a float and store it in a variant
 Number stringToNumber(const std::string& str);
 
+// Same as stringToNumber but return an empty optional instead of throwing if the string is not a number
+std::optional<Number> tryStringToNumber(const std::string& pStr);
+
 // Overloaded operator for addition of two Number objects
 Number operator+(const Number& lhs, const Number& rhs);
 
@@ -71,7 +74,7 @@ std::optional<Entity> multiplyNbOrStr(const std::optional<Entity>& pNb1,
                                       const std::optional<Entity>& pNb2);
 
 ORDEREDGOALSPLANNER_API
-bool compIntNb(const std::string& pNb1Str,
+bool compIntNb(const Entity& pNb1,
                const Number& pNb2,
                bool pBoolSuperiorOrInferior,
                bool pCanBeEqual);
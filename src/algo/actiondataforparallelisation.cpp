@@ -1,4 +1,6 @@
 #include "actiondataforparallelisation.hpp"
+#include <algorithm>
+#include <functional>
 #include <orderedgoalsplanner/types/action.hpp>
 #include <orderedgoalsplanner/types/domain.hpp>
 #include <orderedgoalsplanner/types/problem.hpp>
@@ -8,6 +10,40 @@
 namespace ogp
 {
 
+void FactsFootprint::addFact(const Fact& pFact)
+{
+  auto factNameId = std::hash<std::string>()(pFact.name());
+  factNamesMask |= std::uint64_t(1) << (factNameId % 64);
+  factNameIds.emplace_back(factNameId);
+}
+
+
+void FactsFootprint::finalize()
+{
+  std::sort(factNameIds.begin(), factNameIds.end());
+  factNameIds.erase(std::unique(factNameIds.begin(), factNameIds.end()), factNameIds.end());
+}
+
+
+bool FactsFootprint::canShareAFactNameWith(const FactsFootprint& pOther) const
+{
+  if ((factNamesMask & pOther.factNamesMask) == 0)
+    return false;
+  auto it = factNameIds.begin();
+  auto itOther = pOther.factNameIds.begin();
+  while (it != factNameIds.end() && itOther != pOther.factNameIds.end())
+  {
+    if (*it < *itOther)
+      ++it;
+    else if (*itOther < *it)
+      ++itOther;
+    else
+      return true;
+  }
+  return false;
+}
+
+
 ActionDataForParallelisation::ActionDataForParallelisation(const Action& pAction, ActionInvocationWithGoal&& pActionInvWithGoal)
   : action(pAction),
     actionInvWithGoal(std::move(pActionInvWithGoal)),
@@ -86,6 +122,36 @@ const std::set<FactOptional>& ActionDataForParallelisation::getAllOptFactsThatCa
 }
 
 
+const FactsFootprint& ActionDataForParallelisation::getConditionFootprint()
+{
+  if (!conditionFootprintPtr)
+  {
+    conditionFootprintPtr = std::make_unique<FactsFootprint>();
+    auto* conditionPtr = getConditionWithoutParameterPtr();
+    if (conditionPtr != nullptr)
+      conditionPtr->forAll([&](const FactOptional& pFactOptional, bool) {
+        conditionFootprintPtr->addFact(pFactOptional.fact);
+        return ContinueOrBreak::CONTINUE;
+      });
+    conditionFootprintPtr->finalize();
+  }
+  return *conditionFootprintPtr;
+}
+
+
+const FactsFootprint& ActionDataForParallelisation::getEffectsFootprint()
+{
+  if (!effectsFootprintPtr)
+  {
+    effectsFootprintPtr = std::make_unique<FactsFootprint>();
+    for (const auto& currFactOptional : getAllOptFactsThatCanBeModified())
+      effectsFootprintPtr->addFact(currFactOptional.fact);
+    effectsFootprintPtr->finalize();
+  }
+  return *effectsFootprintPtr;
+}
+
+
 bool ActionDataForParallelisation::hasAContradictionWithAnEffect(const std::set<FactOptional>& pFactsOpt)
 {
   auto* effectPtr = getWorldStateModificationAtStartWithoutParameterPtr();
@@ -105,19 +171,29 @@ bool ActionDataForParallelisation::hasAContradictionWithAnEffect(const std::set<
 
 bool ActionDataForParallelisation::canBeInParallel(ActionDataForParallelisation& pOther)
 {
+  // The footprints avoid to walk the condition and effect trees when no fact name is shared
+  const auto& effectsFootprint = getEffectsFootprint();
+  const auto& otherEffectsFootprint = pOther.getEffectsFootprint();
   const auto& effectFacts = getAllOptFactsThatCanBeModified();
-  auto* otherConditionPtr = pOther.getConditionWithoutParameterPtr();
-  if (otherConditionPtr != nullptr && otherConditionPtr->hasAContradictionWith(effectFacts))
-    return false;
+  if (pOther.getConditionFootprint().canShareAFactNameWith(effectsFootprint))
+  {
+    auto* otherConditionPtr = pOther.getConditionWithoutParameterPtr();
+    if (otherConditionPtr != nullptr && otherConditionPtr->hasAContradictionWith(effectFacts))
+      return false;
+  }
 
   const auto& otherEffectFacts = pOther.getAllOptFactsThatCanBeModified();
-  auto* conditionPtr = getConditionWithoutParameterPtr();
-  if (conditionPtr != nullptr && conditionPtr->hasAContradictionWith(otherEffectFacts))
-    return false;
+  if (getConditionFootprint().canShareAFactNameWith(otherEffectsFootprint))
+  {
+    auto* conditionPtr = getConditionWithoutParameterPtr();
+    if (conditionPtr != nullptr && conditionPtr->hasAContradictionWith(otherEffectFacts))
+      return false;
+  }
 
+  if (!effectsFootprint.canShareAFactNameWith(otherEffectsFootprint))
+    return true;
   if (hasAContradictionWithAnEffect(otherEffectFacts))
     return false;
-
   return !pOther.hasAContradictionWithAnEffect(effectFacts);
 }
 
@@ -132,56 +208,71 @@ bool ActionDataForParallelisation::canBeInParallelOfList(std::list<ActionDataFor
 
 
 
+bool applyActionForParallelisation(Problem& pProblem,
+                                   const Domain& pDomain,
+                                   ActionDataForParallelisation& pAction,
+                                   LookForAnActionOutputInfos& pLookForAnActionOutputInfos,
+                                   const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+                                   bool pCheckPrecondition)
+{
+  auto& setOfEvents = pDomain.getSetOfEvents();
+  const SetOfCallbacks callbacks;
+  const auto& ontology = pDomain.getOntology();
+
+  if (pCheckPrecondition)
+  {
+    const auto* conditionPtr = pAction.getConditionWithoutParameterPtr();
+    if (conditionPtr != nullptr && !conditionPtr->isTrue(pProblem.worldState, ontology.constants, pProblem.entities))
+      return false;
+  }
+
+  // Apply the effects of the action with its parameters, without the copies filled with the parameters
+  const auto& effect = pAction.action.effect;
+  const auto& parameters = pAction.actionInvWithGoal.actionInvocation.parameters;
+  const auto* parametersPtr = parameters.empty() ? nullptr : &parameters;
+  if (effect.worldStateModificationAtStart)
+    pProblem.worldState.modify(&*effect.worldStateModificationAtStart, pProblem.goalStack, setOfEvents,
+                               callbacks, ontology, pProblem.entities, pNow, true, parametersPtr);
+
+  bool somethingChanged = false;
+  if (effect.worldStateModification)
+    somethingChanged = pProblem.worldState.modify(&*effect.worldStateModification, pProblem.goalStack, setOfEvents,
+                                                  callbacks, ontology, pProblem.entities, pNow, true, parametersPtr);
+
+  if (effect.potentialWorldStateModification)
+    somethingChanged = pProblem.worldState.modify(&*effect.potentialWorldStateModification, pProblem.goalStack, setOfEvents,
+                                                  callbacks, ontology, pProblem.entities, pNow, true, parametersPtr) || somethingChanged;
+
+  if (!somethingChanged)
+    return false;
+
+  pProblem.goalStack.notifyActionDone(pAction.actionInvWithGoal, pNow,
+                                      &effect.goalsToAdd,
+                                      &effect.goalsToAddInCurrentPriority, pProblem.worldState,
+                                      ontology.constants, pProblem.entities, &pLookForAnActionOutputInfos);
+  return true;
+}
+
+
 std::list<Goal> extractSatisfiedGoals(
     Problem& pProblem,
     const Domain& pDomain,
     std::list<std::list<ActionDataForParallelisation>>::iterator pCurrItInPlan,
     std::list<std::list<ActionDataForParallelisation>>& pPlan,
     const ActionDataForParallelisation* pActionToSkipPtr,
-    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow)
+    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+    bool pCheckPreconditions)
 {
   std::list<Goal> res;
-  auto& setOfEvents = pDomain.getSetOfEvents();
-  const SetOfCallbacks callbacks;
-  const auto& ontology = pDomain.getOntology();
   LookForAnActionOutputInfos lookForAnActionOutputInfos;
   while (pCurrItInPlan != pPlan.end())
   {
-    std::list<ActionDataForParallelisation*> actionsInParallel;
     for (auto& currAction : *pCurrItInPlan)
     {
       if (&currAction == pActionToSkipPtr)
         continue;
-
-      const auto* conditionPtr = currAction.getConditionWithoutParameterPtr();
-      if (conditionPtr != nullptr && !conditionPtr->isTrue(pProblem.worldState, ontology.constants, pProblem.entities))
-        return {};
-
-      auto* worldStateModificationAtStartWithoutParameterPtr = currAction.getWorldStateModificationAtStartWithoutParameterPtr();
-      if (worldStateModificationAtStartWithoutParameterPtr != nullptr)
-        pProblem.worldState.modify(worldStateModificationAtStartWithoutParameterPtr, pProblem.goalStack, setOfEvents,
-                                   callbacks, ontology, pProblem.entities, pNow);
-      actionsInParallel.emplace_back(&currAction);
-
-      bool somethingChanged = false;
-
-      const auto* worldStateModificationWithoutParameterPtr = currAction.getWorldStateModificationWithoutParameterPtr();
-      if (worldStateModificationWithoutParameterPtr != nullptr)
-        somethingChanged = pProblem.worldState.modify(worldStateModificationWithoutParameterPtr, pProblem.goalStack, setOfEvents,
-                                                      callbacks, ontology, pProblem.entities, pNow);
-
-      const auto* potentialWorldStateModificationWithoutParameterPtr = currAction.getPotentialWorldStateModificationWithoutParameterPtr();
-      if (potentialWorldStateModificationWithoutParameterPtr != nullptr)
-        somethingChanged = pProblem.worldState.modify(potentialWorldStateModificationWithoutParameterPtr, pProblem.goalStack, setOfEvents,
-                                                      callbacks, ontology, pProblem.entities, pNow) || somethingChanged;
-
-      if (!somethingChanged)
+      if (!applyActionForParallelisation(pProblem, pDomain, currAction, lookForAnActionOutputInfos, pNow, pCheckPreconditions))
         return {};
-
-      pProblem.goalStack.notifyActionDone(currAction.actionInvWithGoal, pNow,
-                                          &currAction.action.effect.goalsToAdd,
-                                          &currAction.action.effect.goalsToAddInCurrentPriority, pProblem.worldState,
-                                          ontology.constants, pProblem.entities, &lookForAnActionOutputInfos);
     }
     ++pCurrItInPlan;
   }
@@ -1,20 +1,48 @@
 #ifndef ORDEREDGOALSPLANNER_SRC_ALGO_ACTIONDATAFORPARALLELISATION_HPP
 #define ORDEREDGOALSPLANNER_SRC_ALGO_ACTIONDATAFORPARALLELISATION_HPP
 
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <set>
+#include <vector>
 #include <orderedgoalsplanner/types/actioninvocationwithgoal.hpp>
 
 namespace ogp
 {
 struct Action;
 struct Condition;
+struct Fact;
 struct FactOptional;
+struct LookForAnActionOutputInfos;
 struct Problem;
 struct WorldStateModification;
 
 
+/**
+ * @brief Compact footprint of the names of a set of facts.
+ *
+ * Two facts can only interfere if they have the same name, so two footprints without common names
+ * guarantee that the corresponding facts do not interfere.
+ */
+struct FactsFootprint
+{
+  /// Add the name of a fact in the footprint.
+  void addFact(const Fact& pFact);
+
+  /// Sort the identifiers, to call after the last call of addFact.
+  void finalize();
+
+  /// Can a fact of this footprint have the same name as a fact of the other footprint.
+  bool canShareAFactNameWith(const FactsFootprint& pOther) const;
+
+  /// One bit per fact name identifier, to reject most of the pairs with one word operation.
+  std::uint64_t factNamesMask = 0;
+  /// Sorted hashes of the fact names.
+  std::vector<std::size_t> factNameIds;
+};
+
+
 struct ActionDataForParallelisation
 {
   ActionDataForParallelisation(const Action& pAction, ActionInvocationWithGoal&& pActionInvWithGoal);
@@ -29,6 +57,12 @@ struct ActionDataForParallelisation
 
   const std::set<FactOptional>& getAllOptFactsThatCanBeModified();
 
+  /// Footprint of the facts read by the precondition, computed once.
+  const FactsFootprint& getConditionFootprint();
+
+  /// Footprint of the facts that the effects can modify, computed once.
+  const FactsFootprint& getEffectsFootprint();
+
   bool hasAContradictionWithAnEffect(const std::set<FactOptional>& pFactsOpt);
 
   bool canBeInParallel(ActionDataForParallelisation& pOther);
@@ -42,15 +76,36 @@ struct ActionDataForParallelisation
   std::unique_ptr<WorldStateModification> worldStateModificationWithParameterFilled;
   std::unique_ptr<WorldStateModification> potentialWorldStateModificationWithParameterFilled;
   std::unique_ptr<std::set<FactOptional>> factsThatCanBeModifiedPtr;
+  std::unique_ptr<FactsFootprint> conditionFootprintPtr;
+  std::unique_ptr<FactsFootprint> effectsFootprintPtr;
 };
 
 
+/**
+ * @brief Check the precondition of an action and apply its effects on a problem.
+ * @param[in, out] pProblem Problem to modify.
+ * @param[in] pDomain Domain of the action.
+ * @param[in] pAction Action to apply.
+ * @param[in, out] pLookForAnActionOutputInfos Receives the goals satisfied by the action.
+ * @param[in] pNow Current time.
+ * @param[in] pCheckPrecondition False if the precondition is already known to be satisfied.
+ * @return False if the precondition is not satisfied or if the action did not change anything.
+ */
+bool applyActionForParallelisation(Problem& pProblem,
+                                   const Domain& pDomain,
+                                   ActionDataForParallelisation& pAction,
+                                   LookForAnActionOutputInfos& pLookForAnActionOutputInfos,
+                                   const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+                                   bool pCheckPrecondition = true);
+
+
 std::list<Goal> extractSatisfiedGoals(Problem& pProblem,
                                       const Domain& pDomain,
                                       std::list<std::list<ActionDataForParallelisation>>::iterator pCurrItInPlan,
                                       std::list<std::list<ActionDataForParallelisation>>& pPlan,
                                       const ActionDataForParallelisation* pActionToSkipPtr,
-                                      const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow);
+                                      const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+                                      bool pCheckPreconditions = true);
 
 
 } // End of namespace ogp
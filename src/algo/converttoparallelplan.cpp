@@ -1,10 +1,14 @@
 #include "converttoparallelplan.hpp"
+#include <algorithm>
 #include <list>
+#include <optional>
 #include <set>
+#include <vector>
 #include <orderedgoalsplanner/types/action.hpp>
 #include <orderedgoalsplanner/types/actioninvocationwithgoal.hpp>
 #include <orderedgoalsplanner/types/actionstodoinparallel.hpp>
 #include <orderedgoalsplanner/types/domain.hpp>
+#include <orderedgoalsplanner/types/lookforanactionoutputinfos.hpp>
 #include <orderedgoalsplanner/types/parallelplan.hpp>
 #include <orderedgoalsplanner/types/problem.hpp>
 #include <orderedgoalsplanner/types/setofcallbacks.hpp>
@@ -12,15 +16,24 @@
 #include <orderedgoalsplanner/orderedgoalsplanner.hpp>
 #include "actiondataforparallelisation.hpp"
 #include "notifyactiondone.hpp"
+#include "../util/plannerstatisticscollector.hpp"
 
 namespace ogp
 {
 
 namespace
 {
+/// Steps of a parallel plan, each step is a set of actions to do in parallel.
+using PlanSteps = std::vector<std::vector<ActionDataForParallelisation*>>;
 
+
+const ActionDataForParallelisation& _toActionData(const ActionDataForParallelisation& pActionData) { return pActionData; }
+const ActionDataForParallelisation& _toActionData(const ActionDataForParallelisation* pActionDataPtr) { return *pActionDataPtr; }
+
+
+template <typename ACTIONS>
 void _notifyActionsDoneAndRemoveCorrespondingGoals(std::list<Goal>& pGoals,
-                                                   const std::list<ActionDataForParallelisation>& pActions,
+                                                   const ACTIONS& pActions,
                                                    Problem& pProblem,
                                                    const Domain& pDomain,
                                                    const SetOfCallbacks& pCallbacks,
@@ -28,43 +41,215 @@ void _notifyActionsDoneAndRemoveCorrespondingGoals(std::list<Goal>& pGoals,
 {
   LookForAnActionOutputInfos lookForAnActionOutputInfos;
   for (auto& currActionTmpData : pActions)
-    notifyActionDone(pProblem, pDomain, pCallbacks, currActionTmpData.actionInvWithGoal, pNow, &lookForAnActionOutputInfos);
+    notifyActionDone(pProblem, pDomain, pCallbacks, _toActionData(currActionTmpData).actionInvWithGoal, pNow, &lookForAnActionOutputInfos);
   std::list<Goal> goalsSatisfied;
   lookForAnActionOutputInfos.moveGoalsDone(goalsSatisfied);
   for (auto& currGoal : goalsSatisfied)
     pGoals.remove(currGoal);
 }
 
+
+const Goal* _getGoalPtr(const ActionDataForParallelisation& pActionData)
+{
+  if (pActionData.actionInvWithGoal.fromGoal)
+    return &*pActionData.actionInvWithGoal.fromGoal;
+  return nullptr;
 }
 
 
-ParallelPan toParallelPlan
-(std::list<ActionInvocationWithGoal>& pSequentialPlan,
- bool pParalleliseOnyFirstStep,
- Problem& pProblem,
- const Domain& pDomain,
- std::list<Goal>& pGoals,
- const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow)
+/// Can 2 facts refer to the same ground fact (parameters and "any value" arguments match everything).
+bool _canBeTheSameFact(const Fact& pFact1, const Fact& pFact2)
+{
+  if (pFact1.name() != pFact2.name())
+    return false;
+  const auto& arguments1 = pFact1.arguments();
+  const auto& arguments2 = pFact2.arguments();
+  if (arguments1.size() != arguments2.size())
+    return false;
+  for (std::size_t i = 0; i < arguments1.size(); ++i)
+  {
+    const auto& argument1 = arguments1[i];
+    const auto& argument2 = arguments2[i];
+    if (argument1 != argument2 &&
+        !argument1.isAnyValue() && !argument1.isAParameterToFill() &&
+        !argument2.isAnyValue() && !argument2.isAParameterToFill())
+      return false;
+  }
+  return true;
+}
+
+
+bool _doesReadAFactWritten(ActionDataForParallelisation& pReader,
+                           ActionDataForParallelisation& pWriter)
+{
+  if (!pReader.getConditionFootprint().canShareAFactNameWith(pWriter.getEffectsFootprint()))
+    return false;
+  auto* conditionPtr = pReader.getConditionWithoutParameterPtr();
+  if (conditionPtr == nullptr)
+    return false;
+  const auto& factsWritten = pWriter.getAllOptFactsThatCanBeModified();
+  return conditionPtr->forAll([&](const FactOptional& pFactOptional, bool) {
+    for (const auto& currFactWritten : factsWritten)
+      if (_canBeTheSameFact(pFactOptional.fact, currFactWritten.fact))
+        return ContinueOrBreak::BREAK;
+    return ContinueOrBreak::CONTINUE;
+  }) == ContinueOrBreak::BREAK;
+}
+
+
+/**
+ * @brief Simulate a parallel plan on a problem.
+ * @param[in, out] pProblem Problem to modify.
+ * @param[in] pDomain Domain of the actions.
+ * @param[in] pSteps Steps of the plan.
+ * @param[in] pNow Current time.
+ * @return Goals satisfied by the plan, or nothing if an action cannot be done when its step starts.
+ */
+std::optional<std::list<Goal>> _simulatePlanSteps(Problem& pProblem,
+                                                  const Domain& pDomain,
+                                                  const PlanSteps& pSteps,
+                                                  const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow)
 {
-  const auto& actions = pDomain.actions();
   const auto& ontology = pDomain.getOntology();
-  std::list<std::list<ActionDataForParallelisation>> currentRes;
-  const SetOfCallbacks callbacks;
+  LookForAnActionOutputInfos lookForAnActionOutputInfos;
+  for (const auto& currStep : pSteps)
+  {
+    for (auto* currActionPtr : currStep)
+    {
+      const auto* conditionPtr = currActionPtr->getConditionWithoutParameterPtr();
+      if (conditionPtr != nullptr && !conditionPtr->isTrue(pProblem.worldState, ontology.constants, pProblem.entities))
+        return {};
+    }
+    for (auto* currActionPtr : currStep)
+      if (!applyActionForParallelisation(pProblem, pDomain, *currActionPtr, lookForAnActionOutputInfos, pNow))
+        return {};
+  }
+  std::list<Goal> res;
+  lookForAnActionOutputInfos.moveGoalsDone(res);
+  return res;
+}
 
-  // Connvert list of actions to a list of list of actions
-  while (!pSequentialPlan.empty())
+
+/**
+ * @brief Group the actions of a sequential plan in steps according to a dependency graph.
+ *
+ * Consecutive actions done for the same goal form a segment. Inside a segment, an action depends on a
+ * previous one if they cannot be done in parallel (threat) or if it reads a fact written by the previous
+ * one while its precondition is not already satisfied at the beginning of the segment (causal link).
+ * Each action is put in the step just after its latest dependency (longest path), and the final steps are
+ * validated by one simulation of the whole plan.
+ * @return The steps, or nothing if the simulation does not give the same satisfied goals as the sequential plan.
+ */
+std::optional<PlanSteps> _planStepsFromDependencyGraph(std::vector<ActionDataForParallelisation>& pActionsData,
+                                                       bool pParalleliseOnyFirstStep,
+                                                       const Problem& pProblem,
+                                                       const Domain& pDomain,
+                                                       const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow)
+{
+  const auto& ontology = pDomain.getOntology();
+  PlanSteps res;
+  auto sequentialProblem = pProblem;
+  ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfProblemCopies);
+  LookForAnActionOutputInfos sequentialOutputInfos;
+
+  std::size_t segmentBegin = 0;
+  while (segmentBegin < pActionsData.size())
   {
-    ActionInvocationWithGoal& actionInvWithGoal = pSequentialPlan.front();
-    auto itAction = actions.find(actionInvWithGoal.actionInvocation.actionId);
-    if (itAction == actions.end())
-      throw std::runtime_error("ActionId \"" + actionInvWithGoal.actionInvocation.actionId + "\" not found in algorithm to manaage parralelisation");
-    std::list<ActionDataForParallelisation> actionInASubList;
-    actionInASubList.emplace_back(itAction->second, std::move(actionInvWithGoal));
-    currentRes.emplace_back(std::move(actionInASubList));
-    pSequentialPlan.pop_front();
+    const Goal* goalPtr = _getGoalPtr(pActionsData[segmentBegin]);
+    std::size_t segmentEnd = segmentBegin + 1;
+    if (goalPtr != nullptr)
+    {
+      while (segmentEnd < pActionsData.size())
+      {
+        const Goal* currGoalPtr = _getGoalPtr(pActionsData[segmentEnd]);
+        if (currGoalPtr == nullptr || *currGoalPtr != *goalPtr)
+          break;
+        ++segmentEnd;
+      }
+    }
+
+    // Longest path in the dependency graph of the segment
+    std::vector<std::size_t> stepIndexes(segmentEnd - segmentBegin, 0);
+    std::size_t nbOfSteps = 1;
+    for (std::size_t j = segmentBegin + 1; j < segmentEnd; ++j)
+    {
+      auto& currAction = pActionsData[j];
+      const auto* conditionPtr = currAction.getConditionWithoutParameterPtr();
+      bool needsACausalLink = conditionPtr != nullptr &&
+          !conditionPtr->isTrue(sequentialProblem.worldState, ontology.constants, sequentialProblem.entities);
+
+      std::vector<bool> isThreatened(j - segmentBegin, false);
+      for (std::size_t i = segmentBegin; i < j; ++i)
+      {
+        if (!currAction.canBeInParallel(pActionsData[i]))
+        {
+          isThreatened[i - segmentBegin] = true;
+          needsACausalLink = true;
+        }
+      }
+
+      auto& stepIndex = stepIndexes[j - segmentBegin];
+      for (std::size_t i = segmentBegin; i < j; ++i)
+        if (isThreatened[i - segmentBegin] ||
+            (needsACausalLink && _doesReadAFactWritten(currAction, pActionsData[i])))
+          stepIndex = std::max(stepIndex, stepIndexes[i - segmentBegin] + 1);
+      nbOfSteps = std::max(nbOfSteps, stepIndex + 1);
+    }
+
+    const std::size_t firstStepOfSegment = res.size();
+    res.resize(firstStepOfSegment + nbOfSteps);
+    for (std::size_t j = segmentBegin; j < segmentEnd; ++j)
+      res[firstStepOfSegment + stepIndexes[j - segmentBegin]].emplace_back(&pActionsData[j]);
+
+    for (std::size_t j = segmentBegin; j < segmentEnd; ++j)
+      if (!applyActionForParallelisation(sequentialProblem, pDomain, pActionsData[j], sequentialOutputInfos, pNow))
+        return {};
+    segmentBegin = segmentEnd;
   }
 
-  for (auto itPlanStep = currentRes.begin(); itPlanStep != currentRes.end(); ++itPlanStep)
+  if (pParalleliseOnyFirstStep)
+  {
+    // Keep only the first step that has a goal, the next actions stay sequential
+    auto itStep = std::find_if(res.begin(), res.end(), [](const std::vector<ActionDataForParallelisation*>& pStep) {
+      return std::any_of(pStep.begin(), pStep.end(), [](const ActionDataForParallelisation* pActionPtr) {
+        return _getGoalPtr(*pActionPtr) != nullptr;
+      });
+    });
+    if (itStep != res.end())
+    {
+      ++itStep;
+      std::vector<ActionDataForParallelisation*> nextActions;
+      for (auto itNextStep = itStep; itNextStep != res.end(); ++itNextStep)
+        nextActions.insert(nextActions.end(), itNextStep->begin(), itNextStep->end());
+      std::sort(nextActions.begin(), nextActions.end()); // pointers in pActionsData are in the order of the plan
+      res.erase(itStep, res.end());
+      for (auto* currActionPtr : nextActions)
+        res.emplace_back(1, currActionPtr);
+    }
+  }
+
+  std::list<Goal> sequentialGoalsSatisfied;
+  sequentialOutputInfos.moveGoalsDone(sequentialGoalsSatisfied);
+  auto parallelProblem = pProblem;
+  ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfProblemCopies);
+  auto parallelGoalsSatisfiedOpt = _simulatePlanSteps(parallelProblem, pDomain, res, pNow);
+  if (!parallelGoalsSatisfiedOpt || *parallelGoalsSatisfiedOpt != sequentialGoalsSatisfied)
+    return {};
+  return res;
+}
+
+
+/// Previous algorithm, used as fallback: try to merge each candidate action by simulating the rest of the plan.
+void _parallelisePlanBySimulatingEachCandidate(std::list<std::list<ActionDataForParallelisation>>& pCurrentRes,
+                                               bool pParalleliseOnyFirstStep,
+                                               Problem& pProblem,
+                                               const Domain& pDomain,
+                                               std::list<Goal>& pGoals,
+                                               const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow)
+{
+  const auto& ontology = pDomain.getOntology();
+  const SetOfCallbacks callbacks;
+  for (auto itPlanStep = pCurrentRes.begin(); itPlanStep != pCurrentRes.end(); ++itPlanStep)
   {
     const Goal* goalPtr = nullptr;
     for (ActionDataForParallelisation& currActionTmpData : *itPlanStep)
@@ -79,7 +264,7 @@ ParallelPan toParallelPlan
 
     auto itPlanStepCandidate = itPlanStep;
     ++itPlanStepCandidate;
-    while (itPlanStepCandidate != currentRes.end())
+    while (itPlanStepCandidate != pCurrentRes.end())
     {
       if (!itPlanStepCandidate->empty())
       {
@@ -94,6 +279,7 @@ ParallelPan toParallelPlan
               conditionWithoutParameterPtr->isTrue(pProblem.worldState, ontology.constants, pProblem.entities))
           {
             auto tmpProblem = pProblem;
+            ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfProblemCopies);
             notifyActionStarted(tmpProblem, pDomain, callbacks, actionInvocationCand.actionInvWithGoal, pNow);
             notifyActionDone(tmpProblem, pDomain, callbacks, actionInvocationCand.actionInvWithGoal, pNow);
             auto remainingGoals = pGoals;
@@ -101,12 +287,12 @@ ParallelPan toParallelPlan
 
             auto itNextInPlan = itPlanStep;
             ++itNextInPlan;
-            auto goalsCand = extractSatisfiedGoals(tmpProblem, pDomain, itNextInPlan, currentRes, &actionInvocationCand, pNow);
+            auto goalsCand = extractSatisfiedGoals(tmpProblem, pDomain, itNextInPlan, pCurrentRes, &actionInvocationCand, pNow);
             if (goalsCand == remainingGoals)
             {
               notifyActionStarted(pProblem, pDomain, callbacks, actionInvocationCand.actionInvWithGoal, pNow);
               itPlanStep->emplace_back(std::move(actionInvocationCand));
-              itPlanStepCandidate = currentRes.erase(itPlanStepCandidate);
+              itPlanStepCandidate = pCurrentRes.erase(itPlanStepCandidate);
               continue;
             }
           }
@@ -119,8 +305,74 @@ ParallelPan toParallelPlan
       break;
     _notifyActionsDoneAndRemoveCorrespondingGoals(pGoals, *itPlanStep, pProblem, pDomain, callbacks, pNow);
   }
+}
+
+}
+
+
+ParallelPan toParallelPlan
+(std::list<ActionInvocationWithGoal>& pSequentialPlan,
+ bool pParalleliseOnyFirstStep,
+ Problem& pProblem,
+ const Domain& pDomain,
+ std::list<Goal>& pGoals,
+ const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow)
+{
+  const auto& actions = pDomain.actions();
+  const SetOfCallbacks callbacks;
+
+  std::vector<ActionDataForParallelisation> actionsData;
+  actionsData.reserve(pSequentialPlan.size());
+  while (!pSequentialPlan.empty())
+  {
+    ActionInvocationWithGoal& actionInvWithGoal = pSequentialPlan.front();
+    auto itAction = actions.find(actionInvWithGoal.actionInvocation.actionId);
+    if (itAction == actions.end())
+      throw std::runtime_error("ActionId \"" + actionInvWithGoal.actionInvocation.actionId + "\" not found in algorithm to manaage parralelisation");
+    actionsData.emplace_back(itAction->second, std::move(actionInvWithGoal));
+    pSequentialPlan.pop_front();
+  }
 
   ParallelPan res;
+  auto planStepsOpt = _planStepsFromDependencyGraph(actionsData, pParalleliseOnyFirstStep, pProblem, pDomain, pNow);
+  if (planStepsOpt)
+  {
+    for (auto& currStep : *planStepsOpt)
+    {
+      bool hasAGoal = false;
+      for (auto* currActionPtr : currStep)
+      {
+        notifyActionStarted(pProblem, pDomain, callbacks, currActionPtr->actionInvWithGoal, pNow);
+        hasAGoal = hasAGoal || _getGoalPtr(*currActionPtr) != nullptr;
+      }
+      if (!hasAGoal)
+        continue;
+      if (pParalleliseOnyFirstStep)
+        break;
+      _notifyActionsDoneAndRemoveCorrespondingGoals(pGoals, currStep, pProblem, pDomain, callbacks, pNow);
+    }
+
+    for (auto& currStep : *planStepsOpt)
+    {
+      ActionsToDoInParallel subRes;
+      for (auto* currActionPtr : currStep)
+        subRes.actions.emplace_back(std::move(currActionPtr->actionInvWithGoal));
+      if (!subRes.actions.empty())
+        res.actionsToDoInParallel.emplace_back(std::move(subRes));
+    }
+    return res;
+  }
+
+  // Connvert list of actions to a list of list of actions
+  std::list<std::list<ActionDataForParallelisation>> currentRes;
+  for (auto& currActionData : actionsData)
+  {
+    std::list<ActionDataForParallelisation> actionInASubList;
+    actionInASubList.emplace_back(std::move(currActionData));
+    currentRes.emplace_back(std::move(actionInASubList));
+  }
+  _parallelisePlanBySimulatingEachCandidate(currentRes, pParalleliseOnyFirstStep, pProblem, pDomain, pGoals, pNow);
+
   for (auto& currResStep : currentRes)
   {
     ActionsToDoInParallel subRes;
@@ -0,0 +1,178 @@
+#include "goalpartitions.hpp"
+#include <set>
+#include <string>
+#include <orderedgoalsplanner/types/action.hpp>
+#include <orderedgoalsplanner/types/domain.hpp>
+#include <orderedgoalsplanner/types/setofevents.hpp>
+#include <orderedgoalsplanner/types/worldstatemodification.hpp>
+
+namespace ogp
+{
+namespace
+{
+
+bool _hasACommonElement(const std::set<std::string>& pSet1,
+                        const std::set<std::string>& pSet2)
+{
+  auto it1 = pSet1.begin();
+  auto it2 = pSet2.begin();
+  while (it1 != pSet1.end() && it2 != pSet2.end())
+  {
+    if (*it1 < *it2)
+      ++it1;
+    else if (*it2 < *it1)
+      ++it2;
+    else
+      return true;
+  }
+  return false;
+}
+
+
+/// Names of the facts that can be read or written while planning for some goals.
+struct FactsFootprint
+{
+  std::set<std::string> readFactNames;
+  std::set<std::string> writtenFactNames;
+
+  void addRead(const Condition* pConditionPtr)
+  {
+    if (pConditionPtr == nullptr)
+      return;
+    pConditionPtr->forAll([&](const FactOptional& pFactOptional, bool) {
+      readFactNames.insert(pFactOptional.fact.name());
+      return ContinueOrBreak::CONTINUE;
+    });
+  }
+
+  /// Add the facts written by a modification and return true if some of them were not already written.
+  bool addWritten(const WorldStateModification* pWsModificationPtr)
+  {
+    if (pWsModificationPtr == nullptr)
+      return false;
+    bool res = false;
+    pWsModificationPtr->forAllThatCanBeModified([&](const FactOptional& pFactOptional) {
+      if (writtenFactNames.insert(pFactOptional.fact.name()).second)
+        res = true;
+      return ContinueOrBreak::CONTINUE;
+    });
+    return res;
+  }
+
+  bool canInterfereWith(const FactsFootprint& pOther) const
+  {
+    return _hasACommonElement(writtenFactNames, pOther.readFactNames) ||
+        _hasACommonElement(writtenFactNames, pOther.writtenFactNames) ||
+        _hasACommonElement(readFactNames, pOther.writtenFactNames);
+  }
+};
+
+
+FactsFootprint _getGoalFootprint(const Goal& pGoal,
+                                 const Domain& pDomain)
+{
+  FactsFootprint res;
+  res.addRead(&pGoal.objective());
+
+  const auto& actions = pDomain.actions();
+  for (const auto& currActionId : pGoal.getActionsPredecessors())
+  {
+    auto itAction = actions.find(currActionId);
+    if (itAction == actions.end())
+      continue;
+    const Action& action = itAction->second;
+    res.addRead(action.precondition.get());
+    res.addRead(action.overAllCondition.get());
+    res.addWritten(action.effect.worldStateModificationAtStart.get());
+    res.addWritten(action.effect.worldStateModification.get());
+    res.addWritten(action.effect.potentialWorldStateModification.get());
+  }
+
+  const auto& eventsPredecessors = pGoal.getEventsPredecessors();
+  for (const auto& currIdToSetOfEvents : pDomain.getSetOfEvents())
+  {
+    for (const auto& currIdToEvent : currIdToSetOfEvents.second.events())
+    {
+      if (eventsPredecessors.count(generateFullEventId(currIdToSetOfEvents.first, currIdToEvent.first)) == 0)
+        continue;
+      res.addRead(currIdToEvent.second.precondition.get());
+      res.addWritten(currIdToEvent.second.factsToModify.get());
+    }
+  }
+
+  // The written facts can trigger other events
+  bool newFactsWritten = true;
+  while (newFactsWritten)
+  {
+    newFactsWritten = false;
+    for (const auto& currIdToSetOfEvents : pDomain.getSetOfEvents())
+    {
+      for (const auto& currIdToEvent : currIdToSetOfEvents.second.events())
+      {
+        const Event& event = currIdToEvent.second;
+        FactsFootprint eventFootprint;
+        eventFootprint.addRead(event.precondition.get());
+        if (!_hasACommonElement(eventFootprint.readFactNames, res.writtenFactNames))
+          continue;
+        res.readFactNames.insert(eventFootprint.readFactNames.begin(), eventFootprint.readFactNames.end());
+        if (res.addWritten(event.factsToModify.get()))
+          newFactsWritten = true;
+      }
+    }
+  }
+  return res;
+}
+
+
+std::size_t _findRoot(std::vector<std::size_t>& pParents,
+                      std::size_t pIndex)
+{
+  while (pParents[pIndex] != pIndex)
+  {
+    pParents[pIndex] = pParents[pParents[pIndex]];
+    pIndex = pParents[pIndex];
+  }
+  return pIndex;
+}
+
+}
+
+
+std::vector<GoalPartition> partitionGoalsByFootprint(const std::map<int, std::vector<Goal>>& pGoals,
+                                                     const Domain& pDomain)
+{
+  // Goals in the order of the goal stack, so the most important first
+  std::vector<std::pair<int, const Goal*>> goals;
+  for (auto itGoalsGroup = pGoals.rbegin(); itGoalsGroup != pGoals.rend(); ++itGoalsGroup)
+    for (const auto& currGoal : itGoalsGroup->second)
+      goals.emplace_back(itGoalsGroup->first, &currGoal);
+
+  std::vector<FactsFootprint> footprints;
+  footprints.reserve(goals.size());
+  for (const auto& currGoal : goals)
+    footprints.emplace_back(_getGoalFootprint(*currGoal.second, pDomain));
+
+  std::vector<std::size_t> parents(goals.size());
+  for (std::size_t i = 0; i < goals.size(); ++i)
+    parents[i] = i;
+  for (std::size_t i = 0; i < goals.size(); ++i)
+    for (std::size_t j = i + 1; j < goals.size(); ++j)
+      if (footprints[i].canInterfereWith(footprints[j]))
+        parents[_findRoot(parents, j)] = _findRoot(parents, i);
+
+  std::vector<GoalPartition> res;
+  std::map<std::size_t, std::size_t> rootToPartitionIndex;
+  for (std::size_t i = 0; i < goals.size(); ++i)
+  {
+    auto itPartition = rootToPartitionIndex.emplace(_findRoot(parents, i), res.size()).first;
+    if (itPartition->second == res.size())
+    {
+      res.emplace_back();
+      res.back().highestPriority = goals[i].first;
+    }
+    res[itPartition->second].goals[goals[i].first].push_back(*goals[i].second);
+  }
+  return res;
+}
+
+} // End of namespace ogp
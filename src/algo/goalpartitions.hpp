@@ -0,0 +1,37 @@
+#ifndef ORDEREDGOALSPLANNER_SRC_ALGO_GOALPARTITIONS_HPP
+#define ORDEREDGOALSPLANNER_SRC_ALGO_GOALPARTITIONS_HPP
+
+#include <map>
+#include <vector>
+#include <orderedgoalsplanner/types/goal.hpp>
+
+namespace ogp
+{
+struct Domain;
+
+
+/// Goals that can be planned without considering the goals of the other partitions.
+struct GoalPartition
+{
+  /// Priority to goals of this partition, in the order of the goal stack.
+  std::map<int, std::vector<Goal>> goals;
+  /// Highest priority of the goals of this partition.
+  int highestPriority = 0;
+};
+
+
+/**
+ * @brief Split goals in partitions that cannot interfere.<br/>
+ * The footprint of a goal is the facts read and written by its objective, by the actions and by the events that can lead to it.
+ * Two goals are in the same partition if one of them can write a fact of the footprint of the other.
+ * @param[in] pGoals Priority to goals. The predecessors caches of the goals have to be refreshed with the domain.
+ * @param[in] pDomain Domain of the goals.
+ * @return The partitions sorted by highest priority first, then by order of their first goal in the goal stack.
+ */
+std::vector<GoalPartition> partitionGoalsByFootprint(const std::map<int, std::vector<Goal>>& pGoals,
+                                                     const Domain& pDomain);
+
+} // End of namespace ogp
+
+
+#endif // ORDEREDGOALSPLANNER_SRC_ALGO_GOALPARTITIONS_HPP
@@ -5,6 +5,7 @@
 #include <orderedgoalsplanner/types/problem.hpp>
 #include <orderedgoalsplanner/types/setofcallbacks.hpp>
 #include <orderedgoalsplanner/types/worldstate.hpp>
+#include "../util/plannerstatisticscollector.hpp"
 
 namespace ogp
 {
@@ -21,6 +22,7 @@ void notifyActionInvocationDone(Problem& pProblem,
                                 const std::vector<Goal>* pGoalsToAddInCurrentPriority,
                                 LookForAnActionOutputInfos* pLookForAnActionOutputInfosPtr)
 {
+  ORDEREDGOALSPLANNER_STATISTICS_PHASE_TIMER(effectApplicationDuration);
   pProblem.historical.notifyActionDone(pOnStepOfPlannerResult.actionInvocation.actionId);
 
   pProblem.worldState.applyEffect(pOnStepOfPlannerResult.actionInvocation.parameters, pEffect,
@@ -63,15 +65,18 @@ void updateProblemForNextPotentialPlannerResultWithAction(
     Historical* pGlobalHistorical,
     LookForAnActionOutputInfos* pLookForAnActionOutputInfosPtr)
 {
+  ORDEREDGOALSPLANNER_STATISTICS_PHASE_TIMER(effectApplicationDuration);
   if (pGlobalHistorical != nullptr)
     pGlobalHistorical->notifyActionDone(pOneStepOfPlannerResult.actionInvocation.actionId);
   auto& setOfEvents = pDomain.getSetOfEvents();
   const SetOfCallbacks callbacks;
 
   const auto& ontology = pDomain.getOntology();
+  const auto& parameters = pOneStepOfPlannerResult.actionInvocation.parameters;
+  const auto* parametersPtr = parameters.empty() ? nullptr : &parameters;
   if (pOneStepAction.effect.worldStateModificationAtStart)
     pProblem.worldState.modify(&*pOneStepAction.effect.worldStateModificationAtStart, pProblem.goalStack, setOfEvents,
-                               callbacks, ontology, pProblem.entities, pNow);
+                               callbacks, ontology, pProblem.entities, pNow, true, parametersPtr);
 
   notifyActionInvocationDone(pProblem, pGoalChanged, setOfEvents, callbacks, pOneStepOfPlannerResult,
                              pOneStepAction.effect.worldStateModification, ontology, pNow,
@@ -79,12 +84,8 @@ void updateProblemForNextPotentialPlannerResultWithAction(
                              pLookForAnActionOutputInfosPtr);
 
   if (pOneStepAction.effect.potentialWorldStateModification)
-  {
-    auto potentialEffect = pOneStepAction.effect.potentialWorldStateModification->clone(&pOneStepOfPlannerResult.actionInvocation.parameters);
-    if (potentialEffect)
-      pProblem.worldState.modify(&*potentialEffect, pProblem.goalStack, setOfEvents,
-                                 callbacks, ontology, pProblem.entities, pNow);
-  }
+    pProblem.worldState.modify(&*pOneStepAction.effect.potentialWorldStateModification, pProblem.goalStack, setOfEvents,
+                               callbacks, ontology, pProblem.entities, pNow, true, parametersPtr);
 }
 
 
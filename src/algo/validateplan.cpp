@@ -0,0 +1,122 @@
+#include "validateplan.hpp"
+#include <vector>
+#include <orderedgoalsplanner/types/action.hpp>
+#include <orderedgoalsplanner/types/actioninvocationwithgoal.hpp>
+#include <orderedgoalsplanner/types/domain.hpp>
+#include <orderedgoalsplanner/types/factoptional.hpp>
+#include <orderedgoalsplanner/types/goalstack.hpp>
+#include <orderedgoalsplanner/types/parallelplan.hpp>
+#include <orderedgoalsplanner/types/problem.hpp>
+#include <orderedgoalsplanner/types/setofcallbacks.hpp>
+#include <orderedgoalsplanner/types/worldstate.hpp>
+#include "actiondataforparallelisation.hpp"
+
+namespace ogp
+{
+
+namespace
+{
+
+PlanValidationResult _failure(std::size_t pStepIndex,
+                              const std::string& pActionId,
+                              const std::string& pReason)
+{
+  PlanValidationResult res;
+  res.failingStepIndex = pStepIndex;
+  res.failingActionId = pActionId;
+  res.reason = pReason;
+  return res;
+}
+
+
+/// Does an action add a fact that the other action removes.
+bool _haveOppositeEffects(ActionDataForParallelisation& pAction1,
+                          ActionDataForParallelisation& pAction2)
+{
+  if (!pAction1.getEffectsFootprint().canShareAFactNameWith(pAction2.getEffectsFootprint()))
+    return false;
+  for (const auto& currFactOpt1 : pAction1.getAllOptFactsThatCanBeModified())
+    for (const auto& currFactOpt2 : pAction2.getAllOptFactsThatCanBeModified())
+      if (currFactOpt1.isFactNegated != currFactOpt2.isFactNegated && currFactOpt1.fact == currFactOpt2.fact)
+        return true;
+  return false;
+}
+
+}
+
+
+PlanValidationResult validatePlanSteps(const ParallelPan& pPlan,
+                                       const Problem& pProblem,
+                                       const Domain& pDomain,
+                                       std::size_t pFirstStepIndex)
+{
+  const auto& actions = pDomain.actions();
+  const auto& ontology = pDomain.getOntology();
+  const auto& setOfEvents = pDomain.getSetOfEvents();
+  const SetOfCallbacks callbacks;
+  const std::unique_ptr<std::chrono::steady_clock::time_point> now;
+
+  // Only the world state is copied, the goals are not needed to check the actions
+  auto worldState = pProblem.worldState;
+  GoalStack goalStack;
+
+  std::size_t stepIndex = 0;
+  for (const auto& currStep : pPlan.actionsToDoInParallel)
+  {
+    if (stepIndex < pFirstStepIndex)
+    {
+      ++stepIndex;
+      continue;
+    }
+
+    std::vector<ActionDataForParallelisation> actionsData;
+    actionsData.reserve(currStep.actions.size());
+    for (const auto& currAction : currStep.actions)
+    {
+      const auto& actionId = currAction.actionInvocation.actionId;
+      auto itAction = actions.find(actionId);
+      if (itAction == actions.end())
+        return _failure(stepIndex, actionId, "unknown action");
+      // The goal is not copied because it is not needed for the validation
+      actionsData.emplace_back(itAction->second,
+                               ActionInvocationWithGoal(actionId, currAction.actionInvocation.parameters, {}, currAction.fromGoalPriority));
+    }
+
+    for (std::size_t i = 0; i < actionsData.size(); ++i)
+      for (std::size_t j = i + 1; j < actionsData.size(); ++j)
+        if (!actionsData[i].canBeInParallel(actionsData[j]) ||
+            _haveOppositeEffects(actionsData[i], actionsData[j]))
+          return _failure(stepIndex, actionsData[j].actionInvWithGoal.actionInvocation.actionId,
+                          "interferes with " + actionsData[i].actionInvWithGoal.actionInvocation.actionId);
+
+    for (auto& currActionData : actionsData)
+    {
+      const auto* conditionPtr = currActionData.getConditionWithoutParameterPtr();
+      if (conditionPtr != nullptr && !conditionPtr->isTrue(worldState, ontology.constants, pProblem.entities))
+        return _failure(stepIndex, currActionData.actionInvWithGoal.actionInvocation.actionId, "precondition not satisfied");
+      const auto& overAllCondition = currActionData.action.overAllCondition;
+      const auto& parameters = currActionData.actionInvWithGoal.actionInvocation.parameters;
+      if (overAllCondition &&
+          !overAllCondition->clone(&parameters)->isTrue(worldState, ontology.constants, pProblem.entities))
+        return _failure(stepIndex, currActionData.actionInvWithGoal.actionInvocation.actionId, "over all condition not satisfied");
+    }
+
+    for (auto& currActionData : actionsData)
+    {
+      const auto& effect = currActionData.action.effect;
+      const auto& parameters = currActionData.actionInvWithGoal.actionInvocation.parameters;
+      const auto* parametersPtr = parameters.empty() ? nullptr : &parameters;
+      for (const auto* currWsModificationPtr : {effect.worldStateModificationAtStart.get(),
+                                                effect.worldStateModification.get(),
+                                                effect.potentialWorldStateModification.get()})
+        if (currWsModificationPtr != nullptr)
+          worldState.modify(currWsModificationPtr, goalStack, setOfEvents, callbacks, ontology,
+                            pProblem.entities, now, true, parametersPtr);
+    }
+    ++stepIndex;
+  }
+  return {};
+}
+
+
+} // End of namespace ogp
@@ -0,0 +1,34 @@
+#ifndef ORDEREDGOALSPLANNER_SRC_ALGO_VALIDATEPLAN_HPP
+#define ORDEREDGOALSPLANNER_SRC_ALGO_VALIDATEPLAN_HPP
+
+#include <cstddef>
+#include <orderedgoalsplanner/types/planvalidationresult.hpp>
+
+namespace ogp
+{
+struct Domain;
+struct ParallelPan;
+struct Problem;
+
+
+/**
+ * @brief Check step by step that the actions of a plan can be done.
+ *
+ * For each step, the actions must not interfere with each other and their preconditions must be
+ * satisfied at the beginning of the step. Then the effects and the events are applied on a copy
+ * of the world state. The goals and the callbacks are ignored.
+ * @param[in] pPlan Plan to check.
+ * @param[in] pProblem Problem containing the world state at the beginning of the first step to check.
+ * @param[in] pDomain Domain of the actions.
+ * @param[in] pFirstStepIndex Index of the first step to check, the previous steps are considered as already done.
+ * @return The index of the first failing step, if any.
+ */
+PlanValidationResult validatePlanSteps(const ParallelPan& pPlan,
+                                       const Problem& pProblem,
+                                       const Domain& pDomain,
+                                       std::size_t pFirstStepIndex);
+
+} // End of namespace ogp
+
+
+#endif // ORDEREDGOALSPLANNER_SRC_ALGO_VALIDATEPLAN_HPP
@@ -1,15 +1,20 @@
 #include <orderedgoalsplanner/orderedgoalsplanner.hpp>
 #include <algorithm>
-#include <iomanip>
+#include <atomic>
 #include <optional>
+#include <thread>
 #include <orderedgoalsplanner/types/parallelplan.hpp>
 #include <orderedgoalsplanner/types/setofevents.hpp>
 #include <orderedgoalsplanner/util/util.hpp>
+#include "types/actioninvocationcounter.hpp"
 #include "types/factsalreadychecked.hpp"
 #include "types/treeofalreadydonepaths.hpp"
 #include "algo/actiondataforparallelisation.hpp"
 #include "algo/converttoparallelplan.hpp"
+#include "algo/goalpartitions.hpp"
 #include "algo/notifyactiondone.hpp"
+#include "algo/validateplan.hpp"
+#include "util/plannerstatisticscollector.hpp"
 
 namespace ogp
 {
@@ -17,6 +22,16 @@ namespace ogp
 namespace
 {
 
+/// Append the step index of a plan, on at least 2 digits, followed by ": ".
+void _appendPlanStep(std::string& pRes,
+                     std::size_t pStep)
+{
+  if (pStep < 10)
+    pRes += '0';
+  pRes += std::to_string(pStep);
+  pRes += ": ";
+}
+
 enum class PossibleEffect
 {
   SATISFIED,
@@ -39,6 +54,8 @@ PossibleEffect _merge(PossibleEffect pEff1,
 struct PlanCost
 {
   bool success = true;
+  /// The simulation stopped at the maximum rollout depth before the end of the plan.
+  bool isTruncated = false;
   std::size_t nbOfGoalsNotSatisfied = 0;
   std::size_t nbOfGoalsSatisfied = 0;
   std::size_t nbOfActionDones = 0;
@@ -47,6 +64,8 @@ struct PlanCost
   {
     if (success != pOther.success)
       return success;
+    if (isTruncated != pOther.isTruncated)
+      return !isTruncated;
     if (nbOfGoalsNotSatisfied != pOther.nbOfGoalsNotSatisfied)
       return nbOfGoalsNotSatisfied > pOther.nbOfGoalsNotSatisfied;
     if (nbOfGoalsSatisfied != pOther.nbOfGoalsSatisfied)
@@ -76,6 +95,34 @@ struct ActionPtrWithGoal
 };
 
 
+/// Options of one planning call, shared by all its recursive calls.
+struct SearchOptions
+{
+  SearchOptions(const PlannerOptions& pOptions)
+    : tryToDoMoreOptimalSolution(pOptions.searchMode == PlannerSearchMode::ROLLOUT_OPTIMAL),
+      maxRolloutDepth(pOptions.maxRolloutDepth),
+      deadline()
+  {
+    if (pOptions.timeBudget.count() > 0)
+      deadline.emplace(std::chrono::steady_clock::now() + pOptions.timeBudget);
+  }
+
+  bool isDeadlineReached() const { return deadline && std::chrono::steady_clock::now() >= *deadline; }
+
+  /// Same options without the rollouts, for the plans simulated by a rollout.
+  SearchOptions withoutRollouts() const
+  {
+    auto res = *this;
+    res.tryToDoMoreOptimalSolution = false;
+    return res;
+  }
+
+  bool tryToDoMoreOptimalSolution;
+  std::size_t maxRolloutDepth;
+  std::optional<std::chrono::steady_clock::time_point> deadline;
+};
+
+
 struct DataRelatedToOptimisation
 {
   bool tryToDoMoreOptimalSolution = false;
@@ -169,7 +216,7 @@ struct ResearchContext
 
 std::list<ActionInvocationWithGoal> _planForMoreImportantGoalPossible(Problem& pProblem,
                                                                      const Domain& pDomain,
-                                                                     bool pTryToDoMoreOptimalSolution,
+                                                                     const SearchOptions& pSearchOptions,
                                                                      const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
                                                                      const Historical* pGlobalHistorical,
                                                                      LookForAnActionOutputInfos* pLookForAnActionOutputInfosPtr,
@@ -648,7 +695,7 @@ bool _doesStatisfyTheGoal(std::map<Parameter, std::set<Entity>>& pParameters,
 {
   auto checkObjectiveCallback = [&](const FactOptional& pFactOptional,
       std::map<Parameter, std::set<Entity>>* pParametersToModifyInPlacePtr,
-      const std::function<bool (const std::map<Parameter, std::set<Entity>>&)>& pCheckValidity) -> bool
+      FunctionRef<bool (const std::map<Parameter, std::set<Entity>>&)> pCheckValidity) -> bool
   {
     if (_doesConditionMatchAnOptionalFact(pParameters, pFactOptional, pParametersToModifyInPlacePtr, pContext))
     {
@@ -685,6 +732,7 @@ bool _lookForAPossibleEffect(PotentialNextActionParametersWithTmpData& pParamete
                              FactsAlreadyChecked& pFactsAlreadychecked,
                              const std::string& pFromDeductionId)
 {
+  ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfLookForAPossibleEffectCalls);
   bool canSatisfyThisGoal = pContext.goal.canDeductionSatisfyThisGoal(pFromDeductionId);
   if (canSatisfyThisGoal &&
       pContext.goal.isASimpleFactObjective())
@@ -703,7 +751,7 @@ bool _lookForAPossibleEffect(PotentialNextActionParametersWithTmpData& pParamete
   auto successionsCallback = [&](const Successions& pSuccessions,
                                  const ogp::FactOptional& pFactOptional,
                                  std::map<Parameter, std::set<Entity>>* pParametersToModifyInPlacePtr,
-                                 const std::function<bool (const std::map<Parameter, std::set<Entity>>&)>& pCheckValidity) {
+                                 FunctionRef<bool (const std::map<Parameter, std::set<Entity>>&)> pCheckValidity) {
     auto possibleEffect = PossibleEffect::NOT_SATISFIED;
     std::map<Parameter, std::set<Entity>> newPossibleParentParameters;
     std::map<Parameter, std::set<Entity>> newPossibleTmpParentParameters;
@@ -776,32 +824,41 @@ bool _lookForAPossibleEffect(PotentialNextActionParametersWithTmpData& pParamete
 PlanCost _extractPlanCost(
     Problem& pProblem,
     const Domain& pDomain,
+    const SearchOptions& pSearchOptions,
     const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
     Historical* pGlobalHistorical,
     LookForAnActionOutputInfos& pLookForAnActionOutputInfos,
     const ActionPtrWithGoal* pPreviousActionPtr)
 {
+  ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfRollouts);
+  ORDEREDGOALSPLANNER_STATISTICS_PHASE_TIMER(rolloutDuration);
   PlanCost res;
-  std::set<std::string> actionAlreadyInPlan;
+  ActionInvocationCounter actionAlreadyInPlan;
   bool shouldBreak = false;
-  while (!pProblem.goalStack.goals().empty())
+  const auto rolloutSearchOptions = pSearchOptions.withoutRollouts();
+  while (!pProblem.goalStack.goals().empty() && !res.isTruncated)
   {
     if (shouldBreak)
     {
       res.success = false;
       break;
     }
-    auto subPlan = _planForMoreImportantGoalPossible(pProblem, pDomain, false,
+    auto subPlan = _planForMoreImportantGoalPossible(pProblem, pDomain, rolloutSearchOptions,
                                                      pNow, pGlobalHistorical, &pLookForAnActionOutputInfos, pPreviousActionPtr);
     if (subPlan.empty())
       break;
     for (const auto& currActionInSubPlan : subPlan)
     {
+      if (pSearchOptions.maxRolloutDepth > 0 &&
+          res.nbOfActionDones >= pSearchOptions.maxRolloutDepth)
+      {
+        ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfTruncatedRollouts);
+        res.isTruncated = true;
+        break;
+      }
       ++res.nbOfActionDones;
-      const auto& actionToDoStr = currActionInSubPlan.actionInvocation.toStr();
-      if (actionAlreadyInPlan.count(actionToDoStr) > 0)
+      if (++actionAlreadyInPlan[currActionInSubPlan.actionInvocation] > 1)
         shouldBreak = true;
-      actionAlreadyInPlan.insert(actionToDoStr);
       bool goalChanged = false;
       updateProblemForNextPotentialPlannerResult(pProblem, goalChanged, currActionInSubPlan, pDomain, pNow, pGlobalHistorical,
                                                  &pLookForAnActionOutputInfos);
@@ -810,7 +867,8 @@ PlanCost _extractPlanCost(
     }
   }
 
-  res.success = pLookForAnActionOutputInfos.isFirstGoalInSuccess();
+  // A truncated simulation did not fail, it was only not done until the end
+  res.success = res.isTruncated || pLookForAnActionOutputInfos.isFirstGoalInSuccess();
   res.nbOfGoalsNotSatisfied = pLookForAnActionOutputInfos.nbOfNotSatisfiedGoals();
   res.nbOfGoalsSatisfied = pLookForAnActionOutputInfos.nbOfSatisfiedGoals();
   return res;
@@ -824,6 +882,7 @@ bool _isMoreOptimalNextAction(
     const PotentialNextAction& pCurrentNextAction,
     const Problem& pProblem,
     const Domain& pDomain,
+    const SearchOptions& pSearchOptions,
     const DataRelatedToOptimisation& pDataRelatedToOptimisation,
     std::size_t pLength,
     const Goal& pCurrentGoal,
@@ -844,17 +903,19 @@ bool _isMoreOptimalNextAction(
     bool nextStepIsAnEvent = pNewPotentialNextAction.parametersWithData.nextStepIsAnEvent(pDataRelatedToOptimisation.parameterToEntitiesFromEvent);
     {
       auto localProblem1 = pProblem;
+      ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfProblemCopies);
       bool goalChanged = false;
       LookForAnActionOutputInfos lookForAnActionOutputInfos;
       updateProblemForNextPotentialPlannerResult(localProblem1, goalChanged, oneStepOfPlannerResult1, pDomain, now, nullptr, &lookForAnActionOutputInfos);
       ActionPtrWithGoal actionPtrWithGoal(pNewPotentialNextAction.actionPtr, pCurrentGoal);
       auto* actionPtrWithGoalPtr = nextStepIsAnEvent ? nullptr : &actionPtrWithGoal;
-      newCost = _extractPlanCost(localProblem1, pDomain, now, nullptr, lookForAnActionOutputInfos, actionPtrWithGoalPtr);
+      newCost = _extractPlanCost(localProblem1, pDomain, pSearchOptions, now, nullptr, lookForAnActionOutputInfos, actionPtrWithGoalPtr);
     }
 
     if (!pPotentialNextActionComparisonCacheOpt)
     {
       auto localProblem2 = pProblem;
+      ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfProblemCopies);
       bool goalChanged = false;
       LookForAnActionOutputInfos lookForAnActionOutputInfos;
       updateProblemForNextPotentialPlannerResult(localProblem2, goalChanged, oneStepOfPlannerResult2, pDomain, now, nullptr, &lookForAnActionOutputInfos);
@@ -862,7 +923,7 @@ bool _isMoreOptimalNextAction(
       ActionPtrWithGoal actionPtrWithGoal(pCurrentNextAction.actionPtr, pCurrentGoal);
       bool nextStepIsAnEventForCurrentAction = pCurrentNextAction.parametersWithData.nextStepIsAnEvent(pDataRelatedToOptimisation.parameterToEntitiesFromEvent);
       auto* actionPtrWithGoalPtr = nextStepIsAnEventForCurrentAction ? nullptr : &actionPtrWithGoal;
-      pPotentialNextActionComparisonCacheOpt->currentCost = _extractPlanCost(localProblem2, pDomain, now, nullptr, lookForAnActionOutputInfos, actionPtrWithGoalPtr);
+      pPotentialNextActionComparisonCacheOpt->currentCost = _extractPlanCost(localProblem2, pDomain, pSearchOptions, now, nullptr, lookForAnActionOutputInfos, actionPtrWithGoalPtr);
     }
 
     if (newCost.isBetterThan(pPotentialNextActionComparisonCacheOpt->currentCost))
@@ -896,18 +957,21 @@ ActionId _findFirstActionForAGoal(
     const Goal& pGoal,
     const Problem& pProblem,
     const Domain& pDomain,
-    bool pTryToDoMoreOptimalSolution,
+    const SearchOptions& pSearchOptions,
     std::size_t pLength,
     const Historical* pGlobalHistorical,
     const ActionPtrWithGoal* pPreviousActionPtr)
 {
+  ORDEREDGOALSPLANNER_STATISTICS_PHASE_TIMER(candidateSearchDuration);
   PotentialNextAction res;
   std::set<ActionId> actionIdsToSkip;
   if (pPreviousActionPtr != nullptr &&
-      pPreviousActionPtr->goal.objective() == pGoal.objective() &&
+      pPreviousActionPtr->goal.hasSameObjectiveAs(pGoal) &&
       pPreviousActionPtr->actionPtr != nullptr)
     actionIdsToSkip = pPreviousActionPtr->actionPtr->actionsSuccessionsWithoutInterestCache;
   std::optional<PotentialNextActionComparisonCache> potentialNextActionComparisonCacheOpt;
+  const bool tryToDoMoreOptimalSolution = pSearchOptions.tryToDoMoreOptimalSolution &&
+      !pSearchOptions.isDeadlineReached();
 
   ResearchContext context(pGoal, pProblem, pDomain,
                           pGoal.getActionsPredecessors(), pGoal.getEventsPredecessors());
@@ -928,10 +992,11 @@ ActionId _findFirstActionForAGoal(
       auto* newTreePtr = pTreeOfAlreadyDonePath.getNextActionTreeIfNotAnExistingLeaf(currActionId);
       if (newTreePtr != nullptr) // To skip leaf of already seen path
       {
+        ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfCandidateActionsEvaluated);
         FactsAlreadyChecked factsAlreadyChecked;
         auto newPotRes = PotentialNextAction(currActionId, action);
         DataRelatedToOptimisation dataRelatedToOptimisation;
-        dataRelatedToOptimisation.tryToDoMoreOptimalSolution = pTryToDoMoreOptimalSolution;
+        dataRelatedToOptimisation.tryToDoMoreOptimalSolution = tryToDoMoreOptimalSolution;
         if (_lookForAPossibleEffect(newPotRes.parametersWithData, dataRelatedToOptimisation, *newTreePtr,
                                     action.effect.worldStateModification, action.effect.potentialWorldStateModification,
                                     context, factsAlreadyChecked, currActionId) &&
@@ -939,7 +1004,7 @@ ActionId _findFirstActionForAGoal(
         {
           while (true)
           {
-            if (_isMoreOptimalNextAction(potentialNextActionComparisonCacheOpt, pNextInPlanCanBeAnEvent, newPotRes, res, pProblem, pDomain, dataRelatedToOptimisation, pLength, pGoal, pGlobalHistorical))
+            if (_isMoreOptimalNextAction(potentialNextActionComparisonCacheOpt, pNextInPlanCanBeAnEvent, newPotRes, res, pProblem, pDomain, pSearchOptions, dataRelatedToOptimisation, pLength, pGoal, pGlobalHistorical))
             {
               assert(newPotRes.actionPtr != nullptr);
               res = newPotRes;
@@ -959,9 +1024,9 @@ ActionId _findFirstActionForAGoal(
 bool _goalToPlanRec(
     std::list<ActionInvocationWithGoal>& pActionInvocations,
     Problem& pProblem,
-    std::map<std::string, std::size_t>& pActionAlreadyInPlan,
+    ActionInvocationCounter& pActionAlreadyInPlan,
     const Domain& pDomain,
-    bool pTryToDoMoreOptimalSolution,
+    const SearchOptions& pSearchOptions,
     const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
     const Historical* pGlobalHistorical,
     const Goal& pGoal,
@@ -977,7 +1042,7 @@ bool _goalToPlanRec(
     std::map<Parameter, std::set<Entity>> parameters;
     auto actionId =
         _findFirstActionForAGoal(parameters, nextInPlanCanBeAnEvent, treeOfAlreadyDonePath, pGoal, pProblem,
-                                 pDomain, pTryToDoMoreOptimalSolution, 0,
+                                 pDomain, pSearchOptions, 0,
                                  pGlobalHistorical, pPreviousActionPtr);
     if (!actionId.empty())
       potentialRes = std::make_unique<ActionInvocationWithGoal>(actionId, parameters, pGoal.clone(), pPriority);
@@ -985,20 +1050,13 @@ bool _goalToPlanRec(
 
   if (potentialRes && potentialRes->fromGoal)
   {
-    const auto& actionToDoStr = potentialRes->actionInvocation.toStr();
-    auto itAlreadyFoundAction = pActionAlreadyInPlan.find(actionToDoStr);
-    if (itAlreadyFoundAction == pActionAlreadyInPlan.end())
-    {
-      pActionAlreadyInPlan[actionToDoStr] = 1;
-    }
-    else
-    {
-      if (itAlreadyFoundAction->second > 1)
-        return false;
-      ++itAlreadyFoundAction->second;
-    }
+    auto& nbOfOccurrences = pActionAlreadyInPlan[potentialRes->actionInvocation];
+    if (nbOfOccurrences > 1)
+      return false;
+    ++nbOfOccurrences;
 
     auto problemForPlanCost = pProblem;
+    ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfProblemCopies);
     bool goalChanged = false;
 
     auto* potActionPtr = pDomain.getActionPtr(potentialRes->actionInvocation.actionId);
@@ -1012,7 +1070,7 @@ bool _goalToPlanRec(
       auto* previousActionPtr = nextInPlanCanBeAnEvent ? nullptr : &previousAction;
       if (problemForPlanCost.worldState.isGoalSatisfied(pGoal, ontology.constants, problemForPlanCost.entities) ||
           _goalToPlanRec(pActionInvocations, problemForPlanCost, pActionAlreadyInPlan,
-                         pDomain, pTryToDoMoreOptimalSolution, pNow, nullptr, pGoal, pPriority, previousActionPtr))
+                         pDomain, pSearchOptions, pNow, nullptr, pGoal, pPriority, previousActionPtr))
       {
         potentialRes->fromGoal->notifyActivity();
         pActionInvocations.emplace_front(std::move(*potentialRes));
@@ -1029,7 +1087,7 @@ bool _goalToPlanRec(
 
 std::list<ActionInvocationWithGoal> _planForMoreImportantGoalPossible(Problem& pProblem,
                                                                      const Domain& pDomain,
-                                                                     bool pTryToDoMoreOptimalSolution,
+                                                                     const SearchOptions& pSearchOptions,
                                                                      const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
                                                                      const Historical* pGlobalHistorical,
                                                                      LookForAnActionOutputInfos* pLookForAnActionOutputInfosPtr,
@@ -1037,12 +1095,15 @@ std::list<ActionInvocationWithGoal> _planForMoreImportantGoalPossible(Problem& p
 {
   const auto& ontology = pDomain.getOntology();
   std::list<ActionInvocationWithGoal> res;
-  pProblem.goalStack.refreshIfNeeded(pDomain);
+  {
+    ORDEREDGOALSPLANNER_STATISTICS_PHASE_TIMER(goalRefreshDuration);
+    pProblem.goalStack.refreshIfNeeded(pDomain);
+  }
   pProblem.goalStack.iterateOnGoalsAndRemoveNonPersistent(
         [&](const Goal& pGoal, int pPriority){
-            std::map<std::string, std::size_t> actionAlreadyInPlan;
+            ActionInvocationCounter actionAlreadyInPlan;
             return _goalToPlanRec(res, pProblem, actionAlreadyInPlan,
-                                  pDomain, pTryToDoMoreOptimalSolution, pNow, pGlobalHistorical, pGoal, pPriority,
+                                  pDomain, pSearchOptions, pNow, pGlobalHistorical, pGoal, pPriority,
                                   pPreviousActionPtr);
           },
         pProblem.worldState, ontology.constants, pProblem.entities, pNow,
@@ -1050,6 +1111,209 @@ std::list<ActionInvocationWithGoal> _planForMoreImportantGoalPossible(Problem& p
   return res;
 }
 
+
+/**
+ * @brief Plan the goals one after the other and give each action to a callback as soon as it is added to the plan.
+ * @param[in] pOnAction Callback called for each action of the plan. The planning stops if it returns ContinueOrBreak::BREAK.
+ */
+void _streamPlanForEveryGoalsSequentially(
+    Problem& pProblem,
+    const Domain& pDomain,
+    FunctionRef<ContinueOrBreak (ActionInvocationWithGoal&&)> pOnAction,
+    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+    const PlannerOptions& pOptions,
+    const SearchOptions& pSearchOptions,
+    Historical* pGlobalHistorical,
+    std::list<Goal>* pGoalsDonePtr)
+{
+  ActionInvocationCounter actionAlreadyInPlan;
+  LookForAnActionOutputInfos lookForAnActionOutputInfos;
+  bool isStoppedByTheCallback = false;
+  while (!isStoppedByTheCallback &&
+         !pProblem.goalStack.goals().empty() &&
+         !pSearchOptions.isDeadlineReached())
+  {
+    auto subPlan = _planForMoreImportantGoalPossible(pProblem, pDomain, pSearchOptions,
+                                                     pNow, pGlobalHistorical, &lookForAnActionOutputInfos, nullptr);
+    if (subPlan.empty())
+      break;
+    for (auto& currActionInSubPlan : subPlan)
+    {
+      auto& nbOfOccurrences = actionAlreadyInPlan[currActionInSubPlan.actionInvocation];
+      if (nbOfOccurrences > pOptions.maxNbOfRepetitionsOfAnAction)
+        break;
+      ++nbOfOccurrences;
+      bool goalChanged = false;
+      updateProblemForNextPotentialPlannerResult(pProblem, goalChanged, currActionInSubPlan, pDomain, pNow, pGlobalHistorical,
+                                                 &lookForAnActionOutputInfos);
+      if (pOnAction(std::move(currActionInSubPlan)) == ContinueOrBreak::BREAK)
+      {
+        isStoppedByTheCallback = true;
+        break;
+      }
+      if (goalChanged)
+        break;
+    }
+  }
+  if (pGoalsDonePtr != nullptr)
+    lookForAnActionOutputInfos.moveGoalsDone(*pGoalsDonePtr);
+}
+
+
+std::list<ActionInvocationWithGoal> _planForEveryGoalsSequentially(
+    Problem& pProblem,
+    const Domain& pDomain,
+    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+    const PlannerOptions& pOptions,
+    const SearchOptions& pSearchOptions,
+    Historical* pGlobalHistorical,
+    std::list<Goal>* pGoalsDonePtr)
+{
+  std::list<ActionInvocationWithGoal> res;
+  _streamPlanForEveryGoalsSequentially(pProblem, pDomain, [&](ActionInvocationWithGoal&& pAction) {
+    res.emplace_back(std::move(pAction));
+    return ContinueOrBreak::CONTINUE;
+  }, pNow, pOptions, pSearchOptions, pGlobalHistorical, pGoalsDonePtr);
+  return res;
+}
+
+
+bool _canActionBeDone(const ActionInvocationWithGoal& pActionInvocationWithGoal,
+                      const Problem& pProblem,
+                      const Domain& pDomain)
+{
+  const auto* actionPtr = pDomain.getActionPtr(pActionInvocationWithGoal.actionInvocation.actionId);
+  if (actionPtr == nullptr)
+    return false;
+  const auto& parameters = pActionInvocationWithGoal.actionInvocation.parameters;
+  for (const auto* currConditionPtr : {actionPtr->precondition.get(), actionPtr->overAllCondition.get()})
+    if (currConditionPtr != nullptr &&
+        !currConditionPtr->clone(&parameters)->isTrue(pProblem.worldState, pDomain.getOntology().constants, pProblem.entities))
+      return false;
+  return true;
+}
+
+
+bool _isGoalPending(const Goal& pGoal,
+                    const GoalStack& pGoalStack)
+{
+  for (const auto& currPriorityToGoals : pGoalStack.goals())
+    for (const auto& currGoal : currPriorityToGoals.second)
+      if (currGoal == pGoal)
+        return true;
+  return false;
+}
+
+
+/// Number of actions at the beginning of a plan that can still be done from the current world state.
+std::size_t _nbOfActionsThatCanBeDone(const std::list<ActionInvocationWithGoal>& pPlan,
+                                      const Problem& pProblem,
+                                      const Domain& pDomain)
+{
+  // The goals are not copied because they are not needed to validate the actions
+  ParallelPan planWithoutGoals;
+  for (const auto& currAction : pPlan)
+  {
+    ActionsToDoInParallel step;
+    step.actions.emplace_back(currAction.actionInvocation.actionId, currAction.actionInvocation.parameters,
+                              std::unique_ptr<Goal>(), currAction.fromGoalPriority);
+    planWithoutGoals.actionsToDoInParallel.emplace_back(std::move(step));
+  }
+  auto validationResult = validatePlanSteps(planWithoutGoals, pProblem, pDomain, 0);
+  return validationResult.failingStepIndex ? *validationResult.failingStepIndex : pPlan.size();
+}
+
+
+/**
+ * @brief Plan in parallel the partitions of goals that cannot interfere, then merge their plans in the priority order.<br/>
+ * The actions are merged by priority of the goal that motivated them, and the actions of a partition keep their order.
+ * @return The merged plan, or nothing if the goals cannot be partitioned or if an action of the merged plan cannot be done.
+ */
+std::optional<std::list<ActionInvocationWithGoal>> _planGoalPartitionsInParallel(
+    Problem& pProblem,
+    const Domain& pDomain,
+    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+    const PlannerOptions& pOptions,
+    const SearchOptions& pSearchOptions,
+    Historical* pGlobalHistorical,
+    std::list<Goal>& pGoalsDone)
+{
+  pProblem.goalStack.refreshIfNeeded(pDomain);
+  auto partitions = partitionGoalsByFootprint(pProblem.goalStack.goals(), pDomain);
+  if (partitions.size() < 2)
+    return {};
+
+  struct PartitionResult
+  {
+    std::list<ActionInvocationWithGoal> plan;
+    PlannerStatistics statistics;
+  };
+  std::vector<PartitionResult> partitionResults(partitions.size());
+  auto partitionOptions = pOptions;
+  partitionOptions.planIndependentGoalsInParallel = false;
+  const auto& ontology = pDomain.getOntology();
+
+  // Each worker takes the next partition not planned yet, from a copy of the problem that only has the goals of the partition
+  std::atomic<std::size_t> nextPartitionIndex{0};
+  auto worker = [&]() {
+    for (auto i = nextPartitionIndex++; i < partitions.size(); i = nextPartitionIndex++)
+    {
+      auto& partitionResult = partitionResults[i];
+      ORDEREDGOALSPLANNER_STATISTICS_COLLECTOR(pOptions.statisticsPtr != nullptr ? &partitionResult.statistics : nullptr);
+      ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfGoalPartitionsPlannedInParallel);
+      auto partitionProblem = pProblem;
+      partitionProblem.goalStack.setGoals(partitions[i].goals, partitionProblem.worldState,
+                                          ontology.constants, partitionProblem.entities, pNow);
+      std::unique_ptr<Historical> globalHistoricalPtr;
+      if (pGlobalHistorical != nullptr)
+        globalHistoricalPtr = std::make_unique<Historical>(*pGlobalHistorical);
+      partitionResult.plan = _planForEveryGoalsSequentially(partitionProblem, pDomain, pNow, partitionOptions, pSearchOptions,
+                                                            globalHistoricalPtr.get(), nullptr);
+    }
+  };
+  std::vector<std::thread> threads;
+  auto nbOfThreads = std::min(pOptions.nbOfThreads, partitions.size());
+  for (std::size_t i = 0; i < nbOfThreads; ++i)
+    threads.emplace_back(worker);
+  for (auto& currThread : threads)
+    currThread.join();
+  if (pOptions.statisticsPtr != nullptr)
+    for (const auto& currPartitionResult : partitionResults)
+      pOptions.statisticsPtr->add(currPartitionResult.statistics);
+
+  // Apply the plans in the priority order to check that they do not interfere
+  auto mergedProblem = pProblem;
+  ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfProblemCopies);
+  LookForAnActionOutputInfos lookForAnActionOutputInfos;
+  std::list<ActionInvocationWithGoal> res;
+  while (true)
+  {
+    // Next action of the most important goal, the first partition wins in case of equality
+    std::list<ActionInvocationWithGoal>* nextPlanPtr = nullptr;
+    for (auto& currPartitionResult : partitionResults)
+      if (!currPartitionResult.plan.empty() &&
+          (nextPlanPtr == nullptr || currPartitionResult.plan.front().fromGoalPriority > nextPlanPtr->front().fromGoalPriority))
+        nextPlanPtr = &currPartitionResult.plan;
+    if (nextPlanPtr == nullptr)
+      break;
+
+    const auto& currActionInvocation = nextPlanPtr->front();
+    if (!_canActionBeDone(currActionInvocation, mergedProblem, pDomain))
+      return {};
+    bool goalChanged = false;
+    updateProblemForNextPotentialPlannerResult(mergedProblem, goalChanged, currActionInvocation, pDomain, pNow, nullptr,
+                                               &lookForAnActionOutputInfos);
+    res.splice(res.end(), *nextPlanPtr, nextPlanPtr->begin());
+  }
+
+  pProblem = mergedProblem;
+  if (pGlobalHistorical != nullptr)
+    for (const auto& currActionInvocation : res)
+      pGlobalHistorical->notifyActionDone(currActionInvocation.actionInvocation.actionId);
+  lookForAnActionOutputInfos.moveGoalsDone(pGoalsDone);
+  return res;
+}
+
 }
 
 
@@ -1060,7 +1324,23 @@ std::list<ActionInvocationWithGoal> planForMoreImportantGoalPossible(Problem& pP
                                                                      const Historical* pGlobalHistorical,
                                                                      LookForAnActionOutputInfos* pLookForAnActionOutputInfosPtr)
 {
-  return _planForMoreImportantGoalPossible(pProblem, pDomain, pTryToDoMoreOptimalSolution, pNow,
+  PlannerOptions options;
+  options.searchMode = pTryToDoMoreOptimalSolution ? PlannerSearchMode::ROLLOUT_OPTIMAL : PlannerSearchMode::GREEDY;
+  return planForMoreImportantGoalPossible(pProblem, pDomain, pNow, options,
+                                          pGlobalHistorical, pLookForAnActionOutputInfosPtr);
+}
+
+
+std::list<ActionInvocationWithGoal> planForMoreImportantGoalPossible(Problem& pProblem,
+                                                                     const Domain& pDomain,
+                                                                     const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+                                                                     const PlannerOptions& pOptions,
+                                                                     const Historical* pGlobalHistorical,
+                                                                     LookForAnActionOutputInfos* pLookForAnActionOutputInfosPtr)
+{
+  ORDEREDGOALSPLANNER_STATISTICS_COLLECTOR(pLookForAnActionOutputInfosPtr != nullptr && pLookForAnActionOutputInfosPtr->statisticsPtr() != nullptr ?
+                                          pLookForAnActionOutputInfosPtr->statisticsPtr() : pOptions.statisticsPtr);
+  return _planForMoreImportantGoalPossible(pProblem, pDomain, SearchOptions(pOptions), pNow,
                                            pGlobalHistorical, pLookForAnActionOutputInfosPtr, nullptr);
 }
 
@@ -1071,10 +1351,22 @@ ActionsToDoInParallel actionsToDoInParallelNow(
     const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
     Historical* pGlobalHistorical)
 {
+  return actionsToDoInParallelNow(pProblem, pDomain, pNow, PlannerOptions(), pGlobalHistorical);
+}
+
+
+ActionsToDoInParallel actionsToDoInParallelNow(
+    Problem& pProblem,
+    const Domain& pDomain,
+    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+    const PlannerOptions& pOptions,
+    Historical* pGlobalHistorical)
+{
+  ORDEREDGOALSPLANNER_STATISTICS_COLLECTOR(pOptions.statisticsPtr);
   pProblem.goalStack.refreshIfNeeded(pDomain);
   std::list<Goal> goalsDone;
   auto problemForPlanResolution = pProblem;
-  auto sequentialPlan = planForEveryGoals(problemForPlanResolution, pDomain, pNow, pGlobalHistorical, &goalsDone);
+  auto sequentialPlan = planForEveryGoals(problemForPlanResolution, pDomain, pNow, pOptions, pGlobalHistorical, &goalsDone);
   auto parallelPlan = toParallelPlan(sequentialPlan, true, pProblem, pDomain, goalsDone, pNow);
   if (!parallelPlan.actionsToDoInParallel.empty())
     return parallelPlan.actionsToDoInParallel.front();
@@ -1094,12 +1386,12 @@ void notifyActionStarted(Problem& pProblem,
   {
     if (itAction->second.effect.worldStateModificationAtStart)
     {
-      auto worldStateModificationAtStart = itAction->second.effect.worldStateModificationAtStart->clone(&pActionInvocationWithGoal.actionInvocation.parameters);
+      const auto& parameters = pActionInvocationWithGoal.actionInvocation.parameters;
       auto& setOfEvents = pDomain.getSetOfEvents();
       const auto& ontology = pDomain.getOntology();
-      if (worldStateModificationAtStart)
-        pProblem.worldState.modify(&*worldStateModificationAtStart, pProblem.goalStack, setOfEvents,
-                                   pCallbacks, ontology, pProblem.entities, pNow);
+      pProblem.worldState.modify(&*itAction->second.effect.worldStateModificationAtStart, pProblem.goalStack, setOfEvents,
+                                 pCallbacks, ontology, pProblem.entities, pNow, true,
+                                 parameters.empty() ? nullptr : &parameters);
     }
   }
 }
@@ -1112,6 +1404,8 @@ bool notifyActionDone(Problem& pProblem,
                       const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
                       LookForAnActionOutputInfos* pLookForAnActionOutputInfosPtr)
 {
+  ORDEREDGOALSPLANNER_STATISTICS_COLLECTOR(pLookForAnActionOutputInfosPtr != nullptr ?
+                                          pLookForAnActionOutputInfosPtr->statisticsPtr() : nullptr);
   const auto& actions = pDomain.actions();
   auto itAction = actions.find(pOnStepOfPlannerResult.actionInvocation.actionId);
   if (itAction != actions.end())
@@ -1137,41 +1431,55 @@ std::list<ActionInvocationWithGoal> planForEveryGoals(
     Historical* pGlobalHistorical,
     std::list<Goal>* pGoalsDonePtr)
 {
-  const bool tryToDoMoreOptimalSolution = true;
-  std::map<std::string, std::size_t> actionAlreadyInPlan;
-  std::list<ActionInvocationWithGoal> res;
-  LookForAnActionOutputInfos lookForAnActionOutputInfos;
-  while (!pProblem.goalStack.goals().empty())
+  return planForEveryGoals(pProblem, pDomain, pNow, PlannerOptions(), pGlobalHistorical, pGoalsDonePtr);
+}
+
+
+std::list<ActionInvocationWithGoal> planForEveryGoals(
+    Problem& pProblem,
+    const Domain& pDomain,
+    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+    const PlannerOptions& pOptions,
+    Historical* pGlobalHistorical,
+    std::list<Goal>* pGoalsDonePtr)
+{
+  ORDEREDGOALSPLANNER_STATISTICS_COLLECTOR(pOptions.statisticsPtr);
+  const SearchOptions searchOptions(pOptions);
+  if (pOptions.planIndependentGoalsInParallel && pOptions.nbOfThreads > 1)
   {
-    auto subPlan = _planForMoreImportantGoalPossible(pProblem, pDomain, tryToDoMoreOptimalSolution,
-                                                     pNow, pGlobalHistorical, &lookForAnActionOutputInfos, nullptr);
-    if (subPlan.empty())
-      break;
-    for (auto& currActionInSubPlan : subPlan)
+    std::list<Goal> goalsDone;
+    auto resOpt = _planGoalPartitionsInParallel(pProblem, pDomain, pNow, pOptions, searchOptions, pGlobalHistorical, goalsDone);
+    if (resOpt)
     {
-      const auto& actionToDoStr = currActionInSubPlan.actionInvocation.toStr();
-      auto itAlreadyFoundAction = actionAlreadyInPlan.find(actionToDoStr);
-      if (itAlreadyFoundAction == actionAlreadyInPlan.end())
+      // Plan sequentially what remains, like the goals added by the effects
+      std::list<Goal> remainingGoalsDone;
+      resOpt->splice(resOpt->end(), _planForEveryGoalsSequentially(pProblem, pDomain, pNow, pOptions, searchOptions,
+                                                                   pGlobalHistorical, &remainingGoalsDone));
+      if (pGoalsDonePtr != nullptr)
       {
-        actionAlreadyInPlan[actionToDoStr] = 1;
+        goalsDone.splice(goalsDone.end(), remainingGoalsDone);
+        *pGoalsDonePtr = std::move(goalsDone);
       }
-      else
-      {
-        if (itAlreadyFoundAction->second > 10)
-          break;
-        ++itAlreadyFoundAction->second;
-      }
-      bool goalChanged = false;
-      updateProblemForNextPotentialPlannerResult(pProblem, goalChanged, currActionInSubPlan, pDomain, pNow, pGlobalHistorical,
-                                                 &lookForAnActionOutputInfos);
-      res.emplace_back(std::move(currActionInSubPlan));
-      if (goalChanged)
-        break;
+      return std::move(*resOpt);
     }
   }
-  if (pGoalsDonePtr != nullptr)
-    lookForAnActionOutputInfos.moveGoalsDone(*pGoalsDonePtr);
-  return res;
+  return _planForEveryGoalsSequentially(pProblem, pDomain, pNow, pOptions, searchOptions, pGlobalHistorical, pGoalsDonePtr);
+}
+
+
+void planForEveryGoalsStreaming(
+    Problem& pProblem,
+    const Domain& pDomain,
+    FunctionRef<ContinueOrBreak (ActionInvocationWithGoal&&)> pOnAction,
+    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+    const PlannerOptions& pOptions,
+    Historical* pGlobalHistorical,
+    std::list<Goal>* pGoalsDonePtr)
+{
+  ORDEREDGOALSPLANNER_STATISTICS_COLLECTOR(pOptions.statisticsPtr);
+  const SearchOptions searchOptions(pOptions);
+  _streamPlanForEveryGoalsSequentially(pProblem, pDomain, pOnAction, pNow, pOptions, searchOptions,
+                                       pGlobalHistorical, pGoalsDonePtr);
 }
 
 
@@ -1181,15 +1489,92 @@ ParallelPan parallelPlanForEveryGoals(
     const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
     Historical* pGlobalHistorical)
 {
+  return parallelPlanForEveryGoals(pProblem, pDomain, pNow, PlannerOptions(), pGlobalHistorical);
+}
+
+
+ParallelPan parallelPlanForEveryGoals(
+    Problem& pProblem,
+    const Domain& pDomain,
+    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+    const PlannerOptions& pOptions,
+    Historical* pGlobalHistorical)
+{
+  ORDEREDGOALSPLANNER_STATISTICS_COLLECTOR(pOptions.statisticsPtr);
   pProblem.goalStack.refreshIfNeeded(pDomain);
 
   std::list<Goal> goalsDone;
   auto problemForPlanResolution = pProblem;
-  auto sequentialPlan = planForEveryGoals(problemForPlanResolution, pDomain, pNow, pGlobalHistorical, &goalsDone);
+  auto sequentialPlan = planForEveryGoals(problemForPlanResolution, pDomain, pNow, pOptions, pGlobalHistorical, &goalsDone);
   return toParallelPlan(sequentialPlan, false, pProblem, pDomain, goalsDone, pNow);
 }
 
 
+std::list<ActionInvocationWithGoal> repairPlan(
+    const std::list<ActionInvocationWithGoal>& pRemainingPlan,
+    Problem& pProblem,
+    const Domain& pDomain,
+    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+    const PlannerOptions& pOptions,
+    Historical* pGlobalHistorical,
+    std::size_t* pNbOfActionsKeptPtr)
+{
+  ORDEREDGOALSPLANNER_STATISTICS_COLLECTOR(pOptions.statisticsPtr);
+  const SearchOptions searchOptions(pOptions);
+  const auto& ontology = pDomain.getOntology();
+  pProblem.goalStack.refreshIfNeeded(pDomain);
+  pProblem.goalStack.removeFirstGoalsThatAreAlreadySatisfied(pProblem.worldState, ontology.constants, pProblem.entities, pNow);
+
+  std::list<ActionInvocationWithGoal> res;
+  auto remainingPlan = pRemainingPlan;
+  LookForAnActionOutputInfos lookForAnActionOutputInfos;
+  bool isFirstValidation = true;
+  while (!remainingPlan.empty() && !pProblem.goalStack.goals().empty())
+  {
+    // Keep the actions that can be done while their goal is not satisfied
+    std::size_t nbOfActionsThatCanBeDone = _nbOfActionsThatCanBeDone(remainingPlan, pProblem, pDomain);
+    std::size_t nbOfActionsKept = 0;
+    while (nbOfActionsKept < nbOfActionsThatCanBeDone)
+    {
+      const auto& currAction = remainingPlan.front();
+      if (currAction.fromGoal && !_isGoalPending(*currAction.fromGoal, pProblem.goalStack))
+        break;
+      bool goalChanged = false;
+      updateProblemForNextPotentialPlannerResult(pProblem, goalChanged, currAction, pDomain, pNow, pGlobalHistorical,
+                                                 &lookForAnActionOutputInfos);
+      res.splice(res.end(), remainingPlan, remainingPlan.begin());
+      ++nbOfActionsKept;
+    }
+    if (isFirstValidation && pNbOfActionsKeptPtr != nullptr)
+      *pNbOfActionsKeptPtr = nbOfActionsKept;
+    isFirstValidation = false;
+
+    // Without the goal of the broken action, everything that remains is planned again
+    if (remainingPlan.empty() || !remainingPlan.front().fromGoal)
+      break;
+    auto brokenGoalPtr = remainingPlan.front().fromGoal->clone();
+    remainingPlan.remove_if([&](const ActionInvocationWithGoal& pAction) {
+      return pAction.fromGoal && *pAction.fromGoal == *brokenGoalPtr;
+    });
+
+    // Plan again only until the broken goal is satisfied, the actions of the next goals are validated again after
+    if (_isGoalPending(*brokenGoalPtr, pProblem.goalStack))
+      _streamPlanForEveryGoalsSequentially(pProblem, pDomain, [&](ActionInvocationWithGoal&& pAction) {
+        res.emplace_back(std::move(pAction));
+        bool isBrokenGoalSatisfied = !_isGoalPending(*brokenGoalPtr, pProblem.goalStack) ||
+            pProblem.worldState.isGoalSatisfied(*brokenGoalPtr, ontology.constants, pProblem.entities);
+        return isBrokenGoalSatisfied ? ContinueOrBreak::BREAK : ContinueOrBreak::CONTINUE;
+      }, pNow, pOptions, searchOptions, pGlobalHistorical, nullptr);
+  }
+  if (isFirstValidation && pNbOfActionsKeptPtr != nullptr)
+    *pNbOfActionsKeptPtr = 0;
+
+  if (!pProblem.goalStack.goals().empty())
+    res.splice(res.end(), planForEveryGoals(pProblem, pDomain, pNow, pOptions, pGlobalHistorical));
+  return res;
+}
+
+
 
 std::string planToStr(const std::list<ActionInvocationWithGoal>& pPlan,
                       const std::string& pSep)
@@ -1232,14 +1617,15 @@ std::string planToPddl(const std::list<ActionInvocationWithGoal>& pPlan,
                        const Domain& pDomain)
 {
   std::size_t step = 0;
-  std::stringstream ss;
+  std::string res;
   for (const auto& currActionInvocationWithGoal : pPlan)
   {
-    ss << std::setw(2) << std::setfill('0') << step << ": ";
+    _appendPlanStep(res, step);
     ++step;
-    ss << currActionInvocationWithGoal.actionInvocation.toPddl(pDomain) << "\n";
+    currActionInvocationWithGoal.actionInvocation.toPddl(res, pDomain);
+    res += '\n';
   }
-  return ss.str();
+  return res;
 }
 
 
@@ -1250,11 +1636,13 @@ std::string parallelPlanToPddl(const ParallelPan& pPlan,
   std::string res;
   for (const auto& currActionsToDoInParallel : pPlan.actionsToDoInParallel)
   {
-    std::stringstream ssBeginOfStep;
-    ssBeginOfStep << std::setw(2) << std::setfill('0') << step << ": ";
-    ++step;
     for (const auto& currActionInvocationWithGoal : currActionsToDoInParallel.actions)
-      res += ssBeginOfStep.str() + currActionInvocationWithGoal.actionInvocation.toPddl(pDomain) + "\n";
+    {
+      _appendPlanStep(res, step);
+      currActionInvocationWithGoal.actionInvocation.toPddl(res, pDomain);
+      res += '\n';
+    }
+    ++step;
   }
   return res;
 }
@@ -1286,6 +1674,10 @@ bool evaluate
  Problem& pProblem,
  const Domain& pDomain)
 {
+  // Reject the plans that cannot be done before simulating their goals
+  if (!validatePlanSteps(pPlan, pProblem, pDomain, 0).isValid())
+    return false;
+
   std::list<std::list<ActionDataForParallelisation>> planWithCache;
   const auto& ontology = pDomain.getOntology();
   const auto& actions = pDomain.actions();
@@ -1309,10 +1701,21 @@ bool evaluate
   std::unique_ptr<std::chrono::steady_clock::time_point> now;
   pProblem.goalStack.refreshIfNeeded(pDomain);
   pProblem.goalStack.removeFirstGoalsThatAreAlreadySatisfied(pProblem.worldState, ontology.constants, pProblem.entities, now);
+  // The preconditions were checked by the validation, the simulation only extracts the satisfied goals
   auto itBegin = planWithCache.begin();
-  auto goals = extractSatisfiedGoals(pProblem, pDomain, itBegin, planWithCache, nullptr, now);
+  auto goals = extractSatisfiedGoals(pProblem, pDomain, itBegin, planWithCache, nullptr, now, false);
   return goals == expectedGoalsSatisfied;
 }
 
 
+PlanValidationResult validatePlan
+(const ParallelPan& pPlan,
+ const Problem& pProblem,
+ const Domain& pDomain,
+ std::size_t pFirstStepIndex)
+{
+  return validatePlanSteps(pPlan, pProblem, pDomain, pFirstStepIndex);
+}
+
+
 } // !ogp
@@ -1,4 +1,5 @@
 #include <orderedgoalsplanner/types/actioninvocation.hpp>
+#include <functional>
 #include <orderedgoalsplanner/types/domain.hpp>
 #include <orderedgoalsplanner/types/entity.hpp>
 #include <orderedgoalsplanner/types/parameter.hpp>
@@ -9,7 +10,8 @@ namespace ogp
 ActionInvocation::ActionInvocation(const std::string& pActionId,
                                    const std::map<Parameter, Entity>& pParameters)
   : actionId(pActionId),
-    parameters(pParameters)
+    parameters(pParameters),
+    _hash(_computeHash())
 {
 }
 
@@ -17,17 +19,50 @@ ActionInvocation::ActionInvocation(const std::string& pActionId,
 ActionInvocation::ActionInvocation(const std::string& pActionId,
                                    const std::map<Parameter, std::set<Entity>>& pParameters)
   : actionId(pActionId),
-    parameters()
+    parameters(),
+    _hash(0)
 {
   for (auto& currParam : pParameters)
     if (!currParam.second.empty())
       parameters.emplace(currParam.first, *currParam.second.begin());
+  _hash = _computeHash();
 }
 
 
 ActionInvocation::~ActionInvocation() {}
 
 
+bool ActionInvocation::operator==(const ActionInvocation& pOther) const
+{
+  if (_hash != pOther._hash || actionId != pOther.actionId || parameters.size() != pOther.parameters.size())
+    return false;
+  auto itOther = pOther.parameters.begin();
+  for (const auto& currParam : parameters)
+  {
+    if (currParam.first.name != itOther->first.name || currParam.second.value != itOther->second.value)
+      return false;
+    ++itOther;
+  }
+  return true;
+}
+
+
+std::size_t ActionInvocation::_computeHash() const
+{
+  const std::hash<std::string> stringHasher;
+  std::size_t res = stringHasher(actionId);
+  auto combine = [&](std::size_t pHash) {
+    res ^= pHash + 0x9e3779b97f4a7c15ULL + (res << 6) + (res >> 2);
+  };
+  for (const auto& currParam : parameters)
+  {
+    combine(stringHasher(currParam.first.name));
+    combine(stringHasher(currParam.second.value));
+  }
+  return res;
+}
+
+
 std::string ActionInvocation::toStr() const
 {
   std::string res = actionId;
@@ -51,25 +86,33 @@ std::string ActionInvocation::toStr() const
 
 std::string ActionInvocation::toPddl(const Domain& pDomain) const
 {
-  std::stringstream ss;
+  std::string res;
+  toPddl(res, pDomain);
+  return res;
+}
+
+
+void ActionInvocation::toPddl(std::string& pRes,
+                              const Domain& pDomain) const
+{
   auto* actionPtr = pDomain.getActionPtr(actionId);
   if (actionPtr == nullptr)
     throw std::runtime_error("Action " + actionId + " from a plan is not found in the domain");
   auto& action = *actionPtr;
 
-  ss << "(" << actionId;
-  if (!action.parameters.empty())
+  pRes += '(';
+  pRes += actionId;
+  for (const auto& currParam : action.parameters)
   {
-    for (const auto& currParam : action.parameters)
-    {
-      auto itParamToValues = parameters.find(currParam);
-      if (itParamToValues == parameters.end())
-        throw std::runtime_error("Parameter in action not found in action invocation");
-      ss << " " + itParamToValues->second.value;
-    }
+    auto itParamToValues = parameters.find(currParam);
+    if (itParamToValues == parameters.end())
+      throw std::runtime_error("Parameter in action not found in action invocation");
+    pRes += ' ';
+    pRes += itParamToValues->second.value;
   }
-  ss << ") [" << action.duration() << "]";
-  return ss.str();
+  pRes += ") [";
+  pRes += std::to_string(action.duration());
+  pRes += ']';
 }
 
 
@@ -0,0 +1,66 @@
+#include "actioninvocationcounter.hpp"
+
+namespace ogp
+{
+namespace
+{
+constexpr std::size_t _initialNbOfSlots = 16;
+}
+
+
+std::size_t& ActionInvocationCounter::operator[](const ActionInvocation& pActionInvocation)
+{
+  const auto hash = pActionInvocation.hash();
+  if (!_slots.empty())
+  {
+    auto index = _findSlotIndex(hash, pActionInvocation);
+    if (_slots[index].actionInvocation)
+      return _slots[index].nbOfOccurrences;
+  }
+
+  // Grow only when a new action invocation is inserted
+  if (2 * (_size + 1) > _slots.size())
+    _grow();
+  auto& slot = _slots[_findSlotIndex(hash, pActionInvocation)];
+  slot.hash = hash;
+  slot.actionInvocation.emplace(pActionInvocation);
+  ++_size;
+  return slot.nbOfOccurrences;
+}
+
+
+std::size_t ActionInvocationCounter::_findSlotIndex(std::size_t pHash,
+                                                     const ActionInvocation& pActionInvocation) const
+{
+  const auto mask = _slots.size() - 1;
+  auto index = pHash & mask;
+  while (_slots[index].actionInvocation)
+  {
+    const auto& slot = _slots[index];
+    if (slot.hash == pHash && *slot.actionInvocation == pActionInvocation)
+      return index;
+    index = (index + 1) & mask;
+  }
+  return index;
+}
+
+
+void ActionInvocationCounter::_grow()
+{
+  std::vector<Slot> oldSlots;
+  oldSlots.swap(_slots);
+  _slots.resize(oldSlots.empty() ? _initialNbOfSlots : 2 * oldSlots.size());
+  const auto mask = _slots.size() - 1;
+  for (auto& currOldSlot : oldSlots)
+  {
+    if (!currOldSlot.actionInvocation)
+      continue;
+    auto index = currOldSlot.hash & mask;
+    while (_slots[index].actionInvocation)
+      index = (index + 1) & mask;
+    _slots[index] = std::move(currOldSlot);
+  }
+}
+
+
+} // !ogp
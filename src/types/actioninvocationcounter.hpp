@@ -0,0 +1,45 @@
+#ifndef INCLUDE_ORDEREDGOALSPLANNER_ACTIONINVOCATIONCOUNTER_HPP
+#define INCLUDE_ORDEREDGOALSPLANNER_ACTIONINVOCATIONCOUNTER_HPP
+
+#include <optional>
+#include <vector>
+#include <orderedgoalsplanner/types/actioninvocation.hpp>
+#include <orderedgoalsplanner/types/entity.hpp>
+#include <orderedgoalsplanner/types/parameter.hpp>
+
+namespace ogp
+{
+
+/// Number of occurrences of each action invocation, stored in an open-addressing hash table.
+/// It is used to detect the loops in the plans without converting the action invocations to strings.
+struct ActionInvocationCounter
+{
+  /// Get the number of occurrences of an action invocation, 0 is inserted if the invocation is not already there.
+  std::size_t& operator[](const ActionInvocation& pActionInvocation);
+
+  std::size_t size() const { return _size; }
+
+  /// Number of slots of the hash table, the table is grown when it becomes half full.
+  std::size_t nbOfSlots() const { return _slots.size(); }
+
+private:
+  struct Slot
+  {
+    std::size_t hash = 0;
+    std::optional<ActionInvocation> actionInvocation;
+    std::size_t nbOfOccurrences = 0;
+  };
+  std::vector<Slot> _slots;
+  std::size_t _size = 0;
+
+  /// Index of the slot of an action invocation, or of the empty slot where it should be inserted.
+  std::size_t _findSlotIndex(std::size_t pHash,
+                             const ActionInvocation& pActionInvocation) const;
+  void _grow();
+};
+
+
+} // !ogp
+
+
+#endif // INCLUDE_ORDEREDGOALSPLANNER_ACTIONINVOCATIONCOUNTER_HPP
@@ -1,4 +1,5 @@
 #include <orderedgoalsplanner/types/condition.hpp>
+#include <algorithm>
 #include <optional>
 #include <orderedgoalsplanner/types/ontology.hpp>
 #include <orderedgoalsplanner/types/setofderivedpredicates.hpp>
@@ -12,7 +13,7 @@ namespace
 {
 
 
-bool _forEachValueUntil(const std::function<bool (const Entity&)>& pValueCallback,
+bool _forEachValueUntil(FunctionRef<bool (const Entity&)> pValueCallback,
                         bool pUntilValue,
                         const Condition& pCondition,
                         const WorldState& pWorldState,
@@ -54,7 +55,7 @@ bool _forEachValueUntil(const std::function<bool (const Entity&)>& pValueCallbac
 }
 
 
-void _forEach(const std::function<void (const Entity&, const Fact*)>& pValueCallback,
+void _forEach(FunctionRef<void (const Entity&, const Fact*)> pValueCallback,
               const Condition& pCondition,
               const WorldState& pWorldState,
               const std::map<Parameter, std::set<Entity>>* pParametersPtr)
@@ -106,6 +107,91 @@ bool _areEqual(
 }
 
 
+void _extractConjunctions(std::vector<const Condition*>& pConjunctions,
+                          const Condition& pCondition)
+{
+  auto* nodeOfConditionPtr = pCondition.fcNodePtr();
+  if (nodeOfConditionPtr != nullptr && nodeOfConditionPtr->nodeType == ConditionNodeType::AND &&
+      nodeOfConditionPtr->leftOperand && nodeOfConditionPtr->rightOperand)
+  {
+    _extractConjunctions(pConjunctions, *nodeOfConditionPtr->leftOperand);
+    _extractConjunctions(pConjunctions, *nodeOfConditionPtr->rightOperand);
+    return;
+  }
+  pConjunctions.emplace_back(&pCondition);
+}
+
+
+/// Evaluate a conjunction of positive facts starting by the one that has the less matching facts in the world.
+/// The first fact gives the candidate values of the local parameters and the next ones only check each candidate.
+/// Return an empty optional if the conjunction does not contain only positive facts.
+std::optional<bool> _existsIsTrueForConjunctionOfFacts(std::map<Parameter, std::set<Entity>>& pLocalParamToValue,
+                                                       const ConditionNode& pAndNode,
+                                                       const WorldState& pWorldState,
+                                                       const std::set<Fact>& pPunctualFacts,
+                                                       const std::set<Fact>& pRemovedFacts)
+{
+  std::vector<const Condition*> conjunctions;
+  _extractConjunctions(conjunctions, pAndNode);
+
+  const auto& setOfFacts = pWorldState.factsMapping();
+  std::vector<std::pair<std::size_t, const FactOptional*>> nbOfMatchesToFacts;
+  nbOfMatchesToFacts.reserve(conjunctions.size());
+  for (const auto* currConjunctionPtr : conjunctions)
+  {
+    auto* factOfConditionPtr = currConjunctionPtr->fcFactPtr();
+    if (factOfConditionPtr == nullptr ||
+        factOfConditionPtr->factOptional.isFactNegated ||
+        factOfConditionPtr->factOptional.fact.isPunctual())
+      return {};
+    nbOfMatchesToFacts.emplace_back(setOfFacts.estimateNbOfMatchingFacts(factOfConditionPtr->factOptional.fact),
+                                    &factOfConditionPtr->factOptional);
+  }
+
+  std::stable_sort(nbOfMatchesToFacts.begin(), nbOfMatchesToFacts.end(),
+                   [](const auto& pLeft, const auto& pRight) { return pLeft.first < pRight.first; });
+
+  // Collect all the values of the local parameters that satisfy the most selective fact
+  auto candidateParamToValues = pLocalParamToValue;
+  if (!pWorldState.isOptionalFactSatisfiedInASpecificContext(*nbOfMatchesToFacts.front().second, pPunctualFacts, pRemovedFacts, false,
+                                                             &candidateParamToValues, nullptr, nullptr))
+    return false;
+
+  std::map<Parameter, std::set<Entity>> boundParamToValues;
+  for (const auto& currParamToValues : candidateParamToValues)
+    if (!currParamToValues.second.empty())
+      boundParamToValues.emplace(currParamToValues);
+  std::list<std::map<Parameter, Entity>> candidates;
+  unfoldMapWithSet(candidates, boundParamToValues);
+  if (candidates.empty())
+    candidates.emplace_back();
+
+  // Check the other facts for each candidate
+  for (const auto& currCandidate : candidates)
+  {
+    auto localParamToValue = candidateParamToValues;
+    for (const auto& currParamToValue : currCandidate)
+      localParamToValue[currParamToValue.first] = {currParamToValue.second};
+    bool areOtherFactsSatisfied = true;
+    for (auto it = std::next(nbOfMatchesToFacts.begin()); it != nbOfMatchesToFacts.end(); ++it)
+    {
+      if (!pWorldState.isOptionalFactSatisfiedInASpecificContext(*it->second, pPunctualFacts, pRemovedFacts, false,
+                                                                 nullptr, &localParamToValue, nullptr))
+      {
+        areOtherFactsSatisfied = false;
+        break;
+      }
+    }
+    if (areOtherFactsSatisfied)
+    {
+      pLocalParamToValue = std::move(localParamToValue);
+      return true;
+    }
+  }
+  return false;
+}
+
+
 bool _existsIsTrueRec(std::map<Parameter, std::set<Entity>>& pLocalParamToValue,
                       std::map<Parameter, std::set<Entity>>* pConditionParametersToPossibleArguments,
                       const Condition& pCondition,
@@ -123,8 +209,17 @@ bool _existsIsTrueRec(std::map<Parameter, std::set<Entity>>& pLocalParamToValue,
       nodeOfConditionPtr->leftOperand && nodeOfConditionPtr->rightOperand)
   {
     if (nodeOfConditionPtr->nodeType == ConditionNodeType::AND)
+    {
+      // The order of evaluation only matters if the possible arguments of the condition parameters have to be extracted
+      if (pConditionParametersToPossibleArguments == nullptr)
+      {
+        auto resOpt = _existsIsTrueForConjunctionOfFacts(pLocalParamToValue, *nodeOfConditionPtr, pWorldState, pPunctualFacts, pRemovedFacts);
+        if (resOpt)
+          return *resOpt;
+      }
       return _existsIsTrueRec(pLocalParamToValue, pConditionParametersToPossibleArguments, *nodeOfConditionPtr->leftOperand, pWorldState, pPunctualFacts, pRemovedFacts) &&
           _existsIsTrueRec(pLocalParamToValue, pConditionParametersToPossibleArguments, *nodeOfConditionPtr->rightOperand, pWorldState, pPunctualFacts, pRemovedFacts);
+    }
     if (nodeOfConditionPtr->nodeType == ConditionNodeType::OR)
       return _existsIsTrueRec(pLocalParamToValue, pConditionParametersToPossibleArguments, *nodeOfConditionPtr->leftOperand, pWorldState, pPunctualFacts, pRemovedFacts) ||
           _existsIsTrueRec(pLocalParamToValue, pConditionParametersToPossibleArguments, *nodeOfConditionPtr->rightOperand, pWorldState, pPunctualFacts, pRemovedFacts);
@@ -248,7 +343,7 @@ void _existsExtractPossRec(std::map<Parameter, std::set<Entity>>& pLocalParamToV
 bool Condition::isOptFactMandatory(const FactOptional& pFactOptional,
                                    bool pIgnoreFluent) const
 {
-  bool res;
+  bool res = false;
   forAll([&](const FactOptional& pFactOptionalFromCond, bool pIgnoreFluentFromCond) {
     if (pFactOptional.isFactNegated == pFactOptionalFromCond.isFactNegated)
     {
@@ -348,7 +443,7 @@ bool ConditionNode::containsFactOpt(const FactOptional& pFactOptional,
 }
 
 
-ContinueOrBreak ConditionNode::forAll(const std::function<ContinueOrBreak (const FactOptional&, bool)>& pFactCallback,
+ContinueOrBreak ConditionNode::forAll(FunctionRef<ContinueOrBreak (const FactOptional&, bool)> pFactCallback,
                                       bool pIsWrappingExpressionNegated,
                                       bool pIgnoreFluent,
                                       bool pOnlyMandatoryFacts) const
@@ -367,7 +462,7 @@ ContinueOrBreak ConditionNode::forAll(const std::function<ContinueOrBreak (const
 
 
 bool ConditionNode::findConditionCandidateFromFactFromEffect(
-    const std::function<bool (const FactOptional&)>& pDoesConditionFactMatchFactFromEffect,
+    FunctionRef<bool (const FactOptional&)> pDoesConditionFactMatchFactFromEffect,
     const WorldState& pWorldState,
     const SetOfEntities& pConstants,
     const SetOfEntities& pObjects,
@@ -446,7 +541,7 @@ bool ConditionNode::findConditionCandidateFromFactFromEffect(
 
 
 
-bool ConditionNode::untilFalse(const std::function<bool (const FactOptional&)>& pFactCallback,
+bool ConditionNode::untilFalse(FunctionRef<bool (const FactOptional&)> pFactCallback,
                                const SetOfFacts& pSetOfFact) const
 {
   if (nodeType == ConditionNodeType::AND || nodeType == ConditionNodeType::OR|| nodeType == ConditionNodeType::IMPLY)
@@ -598,7 +693,7 @@ bool ConditionNode::isTrue(const WorldState& pWorldState,
             if (currWsFact.fluent() &&
                 leftFact.areEqualWithoutFluentConsideration(currWsFact))
             {
-              bool res = compIntNb(currWsFact.fluent()->value, rightNbPtr->nb,
+              bool res = compIntNb(*currWsFact.fluent(), rightNbPtr->nb,
                                    canBeSuperior(nodeType), canBeEqual(nodeType));
               if (!pIsWrappingExpressionNegated)
                 return res;
@@ -786,7 +881,7 @@ bool ConditionExists::containsFactOpt(const FactOptional& pFactOptional,
   return condition && condition->containsFactOpt(pFactOptional, pFactParameters, pOtherFactParametersPtr, pConditionParameters, pIsWrappingExpressionNegated);
 }
 
-ContinueOrBreak ConditionExists::forAll(const std::function<ContinueOrBreak (const FactOptional&, bool)>& pFactCallback,
+ContinueOrBreak ConditionExists::forAll(FunctionRef<ContinueOrBreak (const FactOptional&, bool)> pFactCallback,
                                         bool pIsWrappingExpressionNegated,
                                         bool pIgnoreFluent,
                                         bool pOnlyMandatoryFacts) const
@@ -799,7 +894,7 @@ ContinueOrBreak ConditionExists::forAll(const std::function<ContinueOrBreak (con
 
 
 bool ConditionExists::findConditionCandidateFromFactFromEffect(
-    const std::function<bool (const FactOptional&)>& pDoesConditionFactMatchFactFromEffect,
+    FunctionRef<bool (const FactOptional&)> pDoesConditionFactMatchFactFromEffect,
     const WorldState& pWorldState,
     const SetOfEntities& pConstants,
     const SetOfEntities& pObjects,
@@ -864,10 +959,24 @@ bool ConditionExists::canBecomeTrue(const WorldState& pWorldState,
       const auto& setOfFacts = pWorldState.factsMapping();
       setOfFacts.extractPotentialArgumentsOfAFactParameter(potentialArgumentsOfTheParameter,
                                                            factToOfCondition, parameter.name);
+      if (potentialArgumentsOfTheParameter.empty())
+        return pIsWrappingExpressionNegated;
+
+      // Only the positions of the parameter are updated for each potential argument
+      std::vector<std::size_t> parameterIndexes;
+      const auto& arguments = factToOfCondition.arguments();
+      for (std::size_t i = 0; i < arguments.size(); ++i)
+        if (arguments[i].value == parameter.name)
+          parameterIndexes.emplace_back(i);
+      const bool isParameterTheFluent = factToOfCondition.fluent() && factToOfCondition.fluent()->value == parameter.name;
+
+      auto factToCheck = factToOfCondition;
       for (auto& currPot : potentialArgumentsOfTheParameter)
       {
-        auto factToCheck = factToOfCondition;
-        factToCheck.replaceArguments({{parameter, currPot}});
+        for (auto currIndex : parameterIndexes)
+          factToCheck.setArgument(currIndex, currPot);
+        if (isParameterTheFluent)
+          factToCheck.setFluent(currPot);
         if (pWorldState.canFactBecomeTrue(factToCheck, pParameters))
           return true;
       }
@@ -970,7 +1079,7 @@ bool ConditionNot::containsFactOpt(const FactOptional& pFactOptional,
 }
 
 
-ContinueOrBreak ConditionNot::forAll(const std::function<ContinueOrBreak (const FactOptional&, bool)>& pFactCallback,
+ContinueOrBreak ConditionNot::forAll(FunctionRef<ContinueOrBreak (const FactOptional&, bool)> pFactCallback,
                                      bool pIsWrappingExpressionNegated,
                                      bool pIgnoreFluent,
                                      bool pOnlyMandatoryFacts) const
@@ -983,7 +1092,7 @@ ContinueOrBreak ConditionNot::forAll(const std::function<ContinueOrBreak (const
 
 
 bool ConditionNot::findConditionCandidateFromFactFromEffect(
-    const std::function<bool (const FactOptional&)>& pDoesConditionFactMatchFactFromEffect,
+    FunctionRef<bool (const FactOptional&)> pDoesConditionFactMatchFactFromEffect,
     const WorldState& pWorldState,
     const SetOfEntities& pConstants,
     const SetOfEntities& pObjects,
@@ -1073,7 +1182,7 @@ bool ConditionFact::containsFactOpt(const FactOptional& pFactOptional,
   return false;
 }
 
-ContinueOrBreak ConditionFact::forAll(const std::function<ContinueOrBreak (const FactOptional&, bool)>& pFactCallback,
+ContinueOrBreak ConditionFact::forAll(FunctionRef<ContinueOrBreak (const FactOptional&, bool)> pFactCallback,
                                       bool pIsWrappingExpressionNegated,
                                       bool pIgnoreFluent,
                                       bool) const
@@ -1088,7 +1197,7 @@ ContinueOrBreak ConditionFact::forAll(const std::function<ContinueOrBreak (const
 
 
 bool ConditionFact::findConditionCandidateFromFactFromEffect(
-    const std::function<bool (const FactOptional&)>& pDoesConditionFactMatchFactFromEffect,
+    FunctionRef<bool (const FactOptional&)> pDoesConditionFactMatchFactFromEffect,
     const WorldState&,
     const SetOfEntities&,
     const SetOfEntities&,
@@ -1190,7 +1299,7 @@ bool ConditionNumber::operator==(const Condition& pOther) const
 
 std::optional<Entity> ConditionNumber::getFluent(const SetOfFacts&) const
 {
-  return Entity::createNumberEntity(toStr(nullptr, true));
+  return Entity::createNumberEntity(nb);
 }
 
 std::unique_ptr<Condition> ConditionNumber::clone(const std::map<Parameter, Entity>*,
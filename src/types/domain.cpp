@@ -233,6 +233,37 @@ Domain::Domain(const std::map<ActionId, Action>& pActions,
 }
 
 
+std::unique_ptr<Domain> Domain::fromPreparedContent(std::map<ActionId, Action>&& pActions,
+                                                    Ontology&& pOntology,
+                                                    std::map<SetOfEventsId, SetOfEvents>&& pIdToSetOfEvents,
+                                                    SetOfConstFacts&& pTimelessFacts,
+                                                    const std::string& pName,
+                                                    const std::set<std::string>& pRequirements)
+{
+  auto res = std::make_unique<Domain>();
+  res->_uuid = generateUuid();
+  res->_name = pName;
+  res->_ontology = std::move(pOntology);
+  res->_timelessFacts = std::move(pTimelessFacts);
+  res->_actions = std::move(pActions);
+  res->_setOfEvents = std::move(pIdToSetOfEvents);
+  res->_requirements = pRequirements;
+
+  for (const auto& currAction : res->_actions)
+  {
+    const Action& action = currAction.second;
+    if (!action.canThisActionBeUsedByThePlanner)
+      continue;
+    bool hasAddedAFact = false;
+    if (action.precondition)
+      hasAddedAFact = res->_conditionsToActions.add(*action.precondition, currAction.first);
+    if (!hasAddedAFact)
+      res->_actionsWithoutFactToAddInPrecondition.addValueWithoutFact(currAction.first);
+  }
+  return res;
+}
+
+
 void Domain::addAction(const ActionId& pActionId,
                        const Action& pAction)
 {
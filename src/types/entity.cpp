@@ -17,19 +17,30 @@ const std::string _anyValue = "*";
 Entity::Entity(const std::string& pValue,
                const std::shared_ptr<Type>& pType)
  : value(pValue),
-   type(pType)
+   type(pType),
+   _number(pType && pType == SetOfTypes::numberType() ? tryStringToNumber(pValue) : std::optional<Number>())
+{
+}
+
+Entity::Entity(const Number& pNumber,
+               const std::shared_ptr<Type>& pType)
+ : value(numberToString(pNumber)),
+   type(pType),
+   _number(pNumber)
 {
 }
 
 Entity::Entity(Entity&& pOther) noexcept
   : value(std::move(pOther.value)),
-    type(pOther.type) {
+    type(pOther.type),
+    _number(pOther._number) {
 }
 
 
 Entity& Entity::operator=(Entity&& pOther) noexcept {
     value = std::move(pOther.value);
     type = pOther.type;
+    _number = pOther._number;
     return *this;
 }
 
@@ -70,6 +81,12 @@ Entity Entity::createNumberEntity(const std::string& pNumber)
 }
 
 
+Entity Entity::createNumberEntity(const Number& pNumber)
+{
+  return Entity(pNumber, SetOfTypes::numberType());
+}
+
+
 Entity Entity::fromDeclaration(const std::string& pStr,
                                const SetOfTypes& pSetOfTypes)
 {
@@ -175,5 +192,23 @@ bool Entity::isValidParameterAccordingToPossiblities(const std::vector<Parameter
 }
 
 
+std::optional<Number> Entity::toNumber() const
+{
+  if (_number)
+    return _number;
+  return tryStringToNumber(value);
+}
+
+
+void Entity::setValue(const std::string& pValue)
+{
+  value = pValue;
+  if (type && type == SetOfTypes::numberType())
+    _number = tryStringToNumber(pValue);
+  else
+    _number.reset();
+}
+
+
 
 } // !ogp
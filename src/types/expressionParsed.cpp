@@ -25,11 +25,18 @@ bool _isASeparator(char pChar)
 
 
 ExpressionParsed ExpressionParsed::clone() const
+{
+  std::list<ExpressionParsed> clonedArguments;
+  for (const auto& arg : arguments)
+     clonedArguments.emplace_back(arg.clone());
+  return cloneWithArguments(std::move(clonedArguments));
+}
+
+ExpressionParsed ExpressionParsed::cloneWithArguments(std::list<ExpressionParsed>&& pArguments) const
 {
   ExpressionParsed res;
   res.name = name;
-  for (const auto& arg : arguments)
-     res.arguments.emplace_back(arg.clone());
+  res.arguments = std::move(pArguments);
   res.value = value;
   res.isValueNegated = isValueNegated;
   res.isAFunction = isAFunction;
@@ -39,6 +46,15 @@ ExpressionParsed ExpressionParsed::clone() const
   return res;
 }
 
+void ExpressionParsed::replaceByItsOnlyArgument()
+{
+  if (arguments.size() != 1)
+    throw std::runtime_error("\"" + name + "\" expression should have exactly one argument");
+  // Move the argument out before the assignment because the assignment destroys the current arguments
+  auto onlyArgument = std::move(arguments.front());
+  *this = std::move(onlyArgument);
+}
+
 std::string ExpressionParsed::toStr() const
 {
   std::string res = name + "(";
@@ -80,7 +96,7 @@ FactOptional ExpressionParsed::toFact(const Ontology& pOntology,
 }
 
 
-ExpressionParsed ExpressionParsed::fromStr(const std::string& pStr,
+ExpressionParsed ExpressionParsed::fromStr(std::string_view pStr,
                                            std::size_t& pPos)
 {
   ExpressionParsed res;
@@ -113,7 +129,7 @@ ExpressionParsed ExpressionParsed::fromStr(const std::string& pStr,
   if (res.name.empty())
   {
     if (beginOfNamePos == pPos)
-      throw std::runtime_error("Predicate is missing in expression: \"" + pStr + "\"");
+      throw std::runtime_error("Predicate is missing in expression: \"" + std::string(pStr) + "\"");
     res.name = pStr.substr(beginOfNamePos, pPos - beginOfNamePos);
   }
 
@@ -140,7 +156,7 @@ ExpressionParsed ExpressionParsed::fromStr(const std::string& pStr,
       if (pStr[pPos] == ')')
         ++pPos;
       else
-        throw std::runtime_error("Arguments parenthesis is not closed: \"" + pStr + "\"");
+        throw std::runtime_error("Arguments parenthesis is not closed: \"" + std::string(pStr) + "\"");
     }
   }
 
@@ -196,7 +212,7 @@ ExpressionParsed ExpressionParsed::fromStr(const std::string& pStr,
 }
 
 
-ExpressionParsed ExpressionParsed::fromPddl(const std::string& pStr,
+ExpressionParsed ExpressionParsed::fromPddl(std::string_view pStr,
                                             std::size_t& pPos,
                                             bool pCanHaveFollowingExpression)
 {
@@ -282,7 +298,7 @@ ExpressionParsed ExpressionParsed::fromPddl(const std::string& pStr,
   return res;
 }
 
-void ExpressionParsed::skipSpaces(const std::string& pStr,
+void ExpressionParsed::skipSpaces(std::string_view pStr,
                                   std::size_t& pPos)
 {
   auto strSize = pStr.size();
@@ -296,7 +312,7 @@ void ExpressionParsed::skipSpaces(const std::string& pStr,
   }
 }
 
-void ExpressionParsed::skipSpacesWithTagExtraction(const std::string& pStr,
+void ExpressionParsed::skipSpacesWithTagExtraction(std::string_view pStr,
                                                    std::size_t& pPos)
 {
   auto strSize = pStr.size();
@@ -311,7 +327,7 @@ void ExpressionParsed::skipSpacesWithTagExtraction(const std::string& pStr,
 }
 
 
-void ExpressionParsed::moveUntilEndOfLine(const std::string& pStr,
+void ExpressionParsed::moveUntilEndOfLine(std::string_view pStr,
                                           std::size_t& pPos)
 {
   auto strSize = pStr.size();
@@ -324,7 +340,7 @@ void ExpressionParsed::moveUntilEndOfLine(const std::string& pStr,
 }
 
 
-void ExpressionParsed::moveUntilEndOfLineWithTagExtraction(const std::string& pStr,
+void ExpressionParsed::moveUntilEndOfLineWithTagExtraction(std::string_view pStr,
                                                            std::size_t& pPos)
 {
   auto strSize = pStr.size();
@@ -341,7 +357,7 @@ void ExpressionParsed::moveUntilEndOfLineWithTagExtraction(const std::string& pS
     {
       if (beginPos)
       {
-        tags.insert(pStr.substr(*beginPos, pPos - *beginPos));
+        tags.emplace(pStr.substr(*beginPos, pPos - *beginPos));
         beginPos.reset();
       }
     }
@@ -349,7 +365,7 @@ void ExpressionParsed::moveUntilEndOfLineWithTagExtraction(const std::string& pS
     {
       if (beginPos)
       {
-        tags.insert(pStr.substr(*beginPos, pPos - *beginPos));
+        tags.emplace(pStr.substr(*beginPos, pPos - *beginPos));
         beginPos.reset();
       }
       break;
@@ -358,11 +374,11 @@ void ExpressionParsed::moveUntilEndOfLineWithTagExtraction(const std::string& pS
   }
 
   if (beginPos)
-    tags.insert(pStr.substr(*beginPos, strSize - *beginPos));
+    tags.emplace(pStr.substr(*beginPos, strSize - *beginPos));
 }
 
 
-void ExpressionParsed::moveUntilClosingParenthesis(const std::string& pStr,
+void ExpressionParsed::moveUntilClosingParenthesis(std::string_view pStr,
                                                    std::size_t& pPos)
 {
   auto strSize = pStr.size();
@@ -375,49 +391,48 @@ void ExpressionParsed::moveUntilClosingParenthesis(const std::string& pStr,
 }
 
 
-std::string ExpressionParsed::parseToken(const std::string& pStr,
+std::string ExpressionParsed::parseToken(std::string_view pStr,
                                          std::size_t& pPos)
 {
   std::size_t beginOfTokenPos = pPos;
-  auto res = parseTokenThatCanBeEmpty(pStr, pPos);
+  auto res = parseTokenViewThatCanBeEmpty(pStr, pPos);
   if (res.empty())
   {
     auto strSize = pStr.size();
-    throw std::runtime_error("Empty token in str " + pStr.substr(beginOfTokenPos, strSize - beginOfTokenPos));
+    throw std::runtime_error("Empty token in str " + std::string(pStr.substr(beginOfTokenPos, strSize - beginOfTokenPos)));
   }
-  return res;
+  return std::string(res);
 }
 
 
-std::string ExpressionParsed::parseTokenThatCanBeEmpty(const std::string& pStr,
+std::string ExpressionParsed::parseTokenThatCanBeEmpty(std::string_view pStr,
                                                        std::size_t& pPos)
+{
+  return std::string(parseTokenViewThatCanBeEmpty(pStr, pPos));
+}
+
+
+std::string_view ExpressionParsed::parseTokenViewThatCanBeEmpty(std::string_view pStr,
+                                                                std::size_t& pPos)
 {
   auto strSize = pStr.size();
   skipSpaces(pStr, pPos);
-  std::string res = "";
   std::size_t beginOfTokenPos = pPos;
   while (pPos < strSize)
   {
     if (pStr[pPos] == ';')
     {
-      res = pStr.substr(beginOfTokenPos, pPos - beginOfTokenPos);
+      auto res = pStr.substr(beginOfTokenPos, pPos - beginOfTokenPos);
       ExpressionParsed::moveUntilEndOfLine(pStr, pPos);
       ++pPos;
       return res;
     }
 
     if (isEndOfTokenSeparator(pStr[pPos]))
-    {
-      res = pStr.substr(beginOfTokenPos, pPos - beginOfTokenPos);
       break;
-    }
     ++pPos;
   }
-  if (res.empty())
-  {
-    res = pStr.substr(beginOfTokenPos, pPos - beginOfTokenPos);
-  }
-  return res;
+  return pStr.substr(beginOfTokenPos, pPos - beginOfTokenPos);
 }
 
 
@@ -5,6 +5,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace ogp
@@ -31,6 +32,9 @@ struct ExpressionParsed
 
   ExpressionParsed clone() const;
 
+  /// Copy this expression with other arguments, without cloning the current arguments.
+  ExpressionParsed cloneWithArguments(std::list<ExpressionParsed>&& pArguments) const;
+
   std::string toStr() const;
 
   FactOptional toFact(const Ontology& pOntology,
@@ -38,34 +42,42 @@ struct ExpressionParsed
                       const std::vector<Parameter>& pParameters,
                       bool pIsOkIfFluentIsMissing) const;
 
-  static ExpressionParsed fromStr(const std::string& pStr,
+  /// Move the only argument of this expression in place of this expression.
+  /// It is used to unwrap expressions like "(not ...)" without cloning the sub-expression.
+  void replaceByItsOnlyArgument();
+
+  static ExpressionParsed fromStr(std::string_view pStr,
                                   std::size_t& pPos);
 
-  static ExpressionParsed fromPddl(const std::string& pStr,
+  static ExpressionParsed fromPddl(std::string_view pStr,
                                    std::size_t& pPos,
                                    bool pCanHaveFollowingExpression);
 
-  static void skipSpaces(const std::string& pStr,
+  static void skipSpaces(std::string_view pStr,
                          std::size_t& pPos);
 
-  void skipSpacesWithTagExtraction(const std::string& pStr,
+  void skipSpacesWithTagExtraction(std::string_view pStr,
                                    std::size_t& pPos);
 
-  static void moveUntilEndOfLine(const std::string& pStr,
+  static void moveUntilEndOfLine(std::string_view pStr,
                                  std::size_t& pPos);
 
-  void moveUntilEndOfLineWithTagExtraction(const std::string& pStr,
+  void moveUntilEndOfLineWithTagExtraction(std::string_view pStr,
                                            std::size_t& pPos);
 
-  static void moveUntilClosingParenthesis(const std::string& pStr,
+  static void moveUntilClosingParenthesis(std::string_view pStr,
                                           std::size_t& pPos);
 
-  static std::string parseToken(const std::string& pStr,
+  static std::string parseToken(std::string_view pStr,
                                 std::size_t& pPos);
 
-  static std::string parseTokenThatCanBeEmpty(const std::string& pStr,
+  static std::string parseTokenThatCanBeEmpty(std::string_view pStr,
                                               std::size_t& pPos);
 
+  /// Same as parseTokenThatCanBeEmpty but the token is a view on the input string, so nothing is copied.
+  static std::string_view parseTokenViewThatCanBeEmpty(std::string_view pStr,
+                                                       std::size_t& pPos);
+
   static bool isEndOfTokenSeparator(char pChar);
 };
 
@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <optional>
 #include <stdexcept>
+#include <string_view>
 #include <orderedgoalsplanner/types/factoptional.hpp>
 #include <orderedgoalsplanner/types/ontology.hpp>
 #include <orderedgoalsplanner/types/parameter.hpp>
@@ -15,17 +16,178 @@ namespace ogp
 {
 namespace {
 
-void _entitiesToStr(std::string& pStr,
-                    const std::vector<Entity>& pParameters)
+/// Placeholder predicate of the facts under construction, parsed only once.
+const Predicate& _notSetPredicate()
 {
-  bool firstIteration = true;
-  for (auto& param : pParameters)
+  static const Predicate res("_not_set", true, SetOfTypes());
+  return res;
+}
+
+/// Types of the arguments and of the fluent of a fact, to generate signatures without copying the fact.
+struct SignatureTypes
+{
+  std::vector<const Type*> arguments;
+  const Type* fluent;
+};
+
+SignatureTypes _extractSignatureTypes(const std::vector<Entity>& pArguments,
+                                      const std::optional<Entity>& pFluent)
+{
+  SignatureTypes res{{}, nullptr};
+  res.arguments.reserve(pArguments.size());
+  for (const auto& currArg : pArguments)
+    res.arguments.emplace_back(currArg.type.get());
+  if (pFluent)
+    res.fluent = pFluent->type.get();
+  return res;
+}
+
+std::string _signatureToStr(const std::string& pFactName,
+                            const SignatureTypes& pSignatureTypes)
+{
+  auto res = pFactName;
+  res += "(";
+  bool firstArg = true;
+  for (const auto* currArgTypePtr : pSignatureTypes.arguments)
   {
-    if (firstIteration)
-      firstIteration = false;
-    else
-      pStr += ", ";
-    pStr += param.toStr();
+    if (currArgTypePtr != nullptr)
+    {
+      if (firstArg)
+        firstArg = false;
+      else
+        res += ", ";
+      res += currArgTypePtr->name;
+    }
+  }
+  res += ")";
+
+  if (pSignatureTypes.fluent != nullptr)
+    res += "=" + pSignatureTypes.fluent->name;
+  return res;
+}
+
+void _generateSignatureForAllSubTypes(std::list<std::string>& pRes,
+                                      const std::string& pFactName,
+                                      SignatureTypes& pSignatureTypes,
+                                      const std::vector<Entity>& pArguments,
+                                      const std::optional<Entity>& pFluent)
+{
+  pRes.emplace_back(_signatureToStr(pFactName, pSignatureTypes));
+
+  // Generate parameters sub-types
+  for (std::size_t i = 0; i < pArguments.size(); ++i)
+  {
+    const auto* argTypePtr = pSignatureTypes.arguments[i];
+    if (argTypePtr != nullptr && pArguments[i].isAParameterToFill())
+    {
+      for (const auto& currSubType : argTypePtr->subTypes)
+      {
+        pSignatureTypes.arguments[i] = &*currSubType;
+        _generateSignatureForAllSubTypes(pRes, pFactName, pSignatureTypes, pArguments, pFluent);
+      }
+      pSignatureTypes.arguments[i] = argTypePtr;
+    }
+  }
+
+  // Generate fluent sub-types
+  const auto* fluentTypePtr = pSignatureTypes.fluent;
+  if (fluentTypePtr != nullptr && pFluent->isAParameterToFill())
+  {
+    for (const auto& currSubType : fluentTypePtr->subTypes)
+    {
+      pSignatureTypes.fluent = &*currSubType;
+      _generateSignatureForAllSubTypes(pRes, pFactName, pSignatureTypes, pArguments, pFluent);
+    }
+    pSignatureTypes.fluent = fluentTypePtr;
+  }
+}
+
+void _generateSignatureForUpperTypesOfAnArgument(std::list<std::string>& pRes,
+                                                 const std::string& pFactName,
+                                                 SignatureTypes& pSignatureTypes,
+                                                 const Type*& pTypeToVary)
+{
+  const auto* initialTypePtr = pTypeToVary;
+  for (const auto* parentTypePtr = initialTypePtr->parent.get(); parentTypePtr != nullptr;
+       parentTypePtr = parentTypePtr->parent.get())
+  {
+    pTypeToVary = parentTypePtr;
+    pRes.emplace_back(_signatureToStr(pFactName, pSignatureTypes));
+  }
+  pTypeToVary = initialTypePtr;
+}
+
+/// Read character by character the string of the entities separated by ", ", without building it.
+class EntitiesStrReader
+{
+public:
+  EntitiesStrReader(const std::vector<Entity>& pEntities)
+    : _entities(pEntities),
+      _entityIndex(0),
+      _part(0),
+      _charIndex(0)
+  {
+  }
+
+  bool next(char& pChar)
+  {
+    while (_entityIndex < _entities.size())
+    {
+      auto partStr = _currentPart();
+      if (_charIndex < partStr.size())
+      {
+        pChar = partStr[_charIndex++];
+        return true;
+      }
+      _charIndex = 0;
+      if (++_part == 4)
+      {
+        _part = 0;
+        ++_entityIndex;
+      }
+    }
+    return false;
+  }
+
+private:
+  const std::vector<Entity>& _entities;
+  std::size_t _entityIndex;
+  std::size_t _part;
+  std::size_t _charIndex;
+
+  std::string_view _currentPart() const
+  {
+    const auto& entity = _entities[_entityIndex];
+    switch (_part)
+    {
+    case 0:
+      return _entityIndex == 0 ? std::string_view() : std::string_view(", ");
+    case 1:
+      return entity.value;
+    case 2:
+      return entity.type ? std::string_view(" - ") : std::string_view();
+    default:
+      return entity.type ? std::string_view(entity.type->name) : std::string_view();
+    }
+  }
+};
+
+/// Same result as comparing the strings of the entities separated by ", ", but without allocating them.
+bool _entitiesStrLess(const std::vector<Entity>& pEntities1,
+                      const std::vector<Entity>& pEntities2)
+{
+  EntitiesStrReader reader1(pEntities1);
+  EntitiesStrReader reader2(pEntities2);
+  char char1 = 0;
+  char char2 = 0;
+  while (true)
+  {
+    bool hasChar1 = reader1.next(char1);
+    bool hasChar2 = reader2.next(char2);
+    if (!hasChar1 || !hasChar2)
+      return !hasChar1 && hasChar2;
+    if (char1 != char2)
+      return std::char_traits<char>::lt(char1, char2);
   }
 }
 
@@ -82,7 +244,7 @@ Fact::Fact(const std::string& pStr,
            std::size_t pBeginPos,
            std::size_t* pResPos,
            bool pIsOkIfFluentIsMissing)
-  : predicate("_not_set", pStrPddlFormated, pOntology.types),
+  : predicate(_notSetPredicate()),
     _name(),
     _arguments(),
     _fluent(),
@@ -114,7 +276,7 @@ Fact::Fact(const std::string& pStr,
       {
         if (pIsFactNegatedPtr != nullptr)
            *pIsFactNegatedPtr = true;
-        expressionParsed = expressionParsed.arguments.back().clone();
+        expressionParsed.replaceByItsOnlyArgument();
       }
       _name = expressionParsed.name;
     }
@@ -171,7 +333,7 @@ Fact::Fact(const std::string& pName,
            const SetOfEntities& pEntities,
            const std::vector<Parameter>& pParameters,
            bool pIsOkIfFluentIsMissing)
-  : predicate("_not_set", true, pOntology.types),
+  : predicate(_notSetPredicate()),
     _name(pName),
     _arguments(),
     _fluent(),
@@ -197,6 +359,21 @@ Fact::Fact(const std::string& pName,
 }
 
 
+Fact::Fact(const Predicate& pPredicate,
+           std::vector<Entity>&& pArguments,
+           std::optional<Entity>&& pFluent,
+           bool pIsFluentNegated)
+  : predicate(pPredicate),
+    _name(pPredicate.name),
+    _arguments(std::move(pArguments)),
+    _fluent(std::move(pFluent)),
+    _isFluentNegated(pIsFluentNegated),
+    _factSignature()
+{
+  _resetFactSignatureCache();
+}
+
+
 Fact::~Fact()
 {
 }
@@ -250,11 +427,7 @@ bool Fact::operator<(const Fact& pOther) const
     return _fluent < pOther._fluent;
   if (_isFluentNegated != pOther._isFluentNegated)
     return _isFluentNegated < pOther._isFluentNegated;
-  std::string paramStr;
-  _entitiesToStr(paramStr, _arguments);
-  std::string otherParamStr;
-  _entitiesToStr(otherParamStr, pOther._arguments);
-  return paramStr < otherParamStr;
+  return _entitiesStrLess(_arguments, pOther._arguments);
 }
 
 bool Fact::operator==(const Fact& pOther) const
@@ -562,26 +735,43 @@ void Fact::replaceArguments(const std::map<Parameter, std::set<Entity>>& pCurren
 std::string Fact::toPddl(bool pInEffectContext,
                          bool pPrintAnyFluent) const
 {
-  std::string res = "(" + _name;
+  std::string res;
+  toPddl(res, pInEffectContext, pPrintAnyFluent);
+  return res;
+}
+
+void Fact::toPddl(std::string& pRes,
+                  bool pInEffectContext,
+                  bool pPrintAnyFluent) const
+{
+  bool printFluent = _fluent && (pPrintAnyFluent || !_fluent->isAnyValue());
+  if (printFluent && _isFluentNegated && pInEffectContext)
+    throw std::runtime_error("Fluent should not be negated in effect: " + toStr(pPrintAnyFluent));
+
+  auto beginPos = pRes.size();
+  if (printFluent)
+    pRes += pInEffectContext ? "(assign " : "(= ";
+  pRes += '(';
+  pRes += _name;
   if (!_arguments.empty())
   {
-    res += " ";
-    _entitiesToValueStr(res, _arguments, " ");
+    pRes += ' ';
+    _entitiesToValueStr(pRes, _arguments, " ");
   }
-  res += ")";
-  if (_fluent)
+  pRes += ')';
+  if (printFluent)
   {
-    if (!pPrintAnyFluent && _fluent->isAnyValue())
-      return res;
-    res = (pInEffectContext ? "(assign " : "(= ") + res + " " + _fluent->value + ")";
+    pRes += ' ';
+    pRes += _fluent->value;
+    pRes += ')';
     if (_isFluentNegated)
     {
-      if (pInEffectContext)
-        throw std::runtime_error("Fluent should not be negated in effect: " + toStr(pPrintAnyFluent));
-      res += "(not " + res + ")";
+      auto factStr = pRes.substr(beginPos);
+      pRes += "(not ";
+      pRes += factStr;
+      pRes += ')';
     }
   }
-  return res;
 }
 
 std::string Fact::toStr(bool pPrintAnyFluent) const
@@ -637,13 +827,13 @@ bool Fact::replaceSomeArgumentsByAny(const std::vector<Parameter>& pArgumentsToR
     {
       if (currFactParam.value == currParam.name)
       {
-        currFactParam.value = Entity::anyEntityValue();
+        currFactParam.setValue(Entity::anyEntityValue());
         res = true;
       }
     }
     if (_fluent && _fluent->value == currParam.name)
     {
-      _fluent->value = Entity::anyEntityValue();
+      _fluent->setValue(Entity::anyEntityValue());
       res = true;
     }
   }
@@ -916,130 +1106,79 @@ std::string Fact::generateFactSignature() const
 
 void Fact::generateSignatureForAllSubTypes(std::list<std::string>& pRes) const
 {
-  pRes.emplace_back(factSignature());
-
-  // Generate parameters sub-types
-  for (std::size_t i = 0; i < _arguments.size(); ++i)
-  {
-    const auto& currArg = _arguments[i];
-    if (currArg.type && currArg.isAParameterToFill())
-    {
-      for (const auto& currSubType : currArg.type->subTypes)
-      {
-        auto fact = *this;
-        fact.setArgumentType(i, currSubType);
-        fact.generateSignatureForAllSubTypes(pRes);
-      }
-    }
-  }
-
-  // Generate fluent sub-types
-  if (_fluent && _fluent->type && _fluent->isAParameterToFill())
-  {
-    for (const auto& currSubType : _fluent->type->subTypes)
-    {
-      auto fact = *this;
-      fact.setFluentType(currSubType);
-      fact.generateSignatureForAllSubTypes(pRes);
-    }
-  }
+  auto signatureTypes = _extractSignatureTypes(_arguments, _fluent);
+  _generateSignatureForAllSubTypes(pRes, _name, signatureTypes, _arguments, _fluent);
 }
 
 
 void Fact::generateSignatureForAllUpperTypes(std::list<std::string>& pRes) const
 {
   pRes.emplace_back(factSignature());
+  auto signatureTypes = _extractSignatureTypes(_arguments, _fluent);
 
   // Generate parameters upper-types
-  for (std::size_t i = 0; i < _arguments.size(); ++i)
-  {
-    const auto& currArg = _arguments[i];
-    if (currArg.type)
-    {
-      auto parentType = currArg.type->parent;
-      while (parentType)
-      {
-        auto fact = *this;
-        fact.setArgumentType(i, parentType);
-        pRes.emplace_back(fact.factSignature());
-        parentType = parentType->parent;
-      }
-    }
-  }
+  for (auto& currArgTypePtr : signatureTypes.arguments)
+    if (currArgTypePtr != nullptr)
+      _generateSignatureForUpperTypesOfAnArgument(pRes, _name, signatureTypes, currArgTypePtr);
 
   // Generate fluent upper-types
-  if (_fluent && _fluent->type)
-  {
-    auto parentType = _fluent->type->parent;
-    while (parentType)
-    {
-      auto fact = *this;
-      fact.setFluentType(parentType);
-      pRes.emplace_back(fact.factSignature());
-      parentType = parentType->parent;
-    }
-  }
+  if (signatureTypes.fluent != nullptr)
+    _generateSignatureForUpperTypesOfAnArgument(pRes, _name, signatureTypes, signatureTypes.fluent);
 }
 
 
 void Fact::generateSignatureForSubAndUpperTypes(std::list<std::string>& pRes) const
 {
   pRes.emplace_back(factSignature());
+  auto signatureTypes = _extractSignatureTypes(_arguments, _fluent);
 
   // Generate parameters sub and upper types
   for (std::size_t i = 0; i < _arguments.size(); ++i)
   {
-    const auto& currArg = _arguments[i];
-    if (currArg.type)
+    const auto* argTypePtr = signatureTypes.arguments[i];
+    if (argTypePtr != nullptr)
     {
-      if (currArg.isAParameterToFill())
+      if (_arguments[i].isAParameterToFill())
       {
-        for (const auto& currSubType : currArg.type->subTypes)
+        for (const auto& currSubType : argTypePtr->subTypes)
         {
-          auto fact = *this;
-          fact.setArgumentType(i, currSubType);
-          fact.generateSignatureForAllSubTypes(pRes);
+          signatureTypes.arguments[i] = &*currSubType;
+          _generateSignatureForAllSubTypes(pRes, _name, signatureTypes, _arguments, _fluent);
         }
+        signatureTypes.arguments[i] = argTypePtr;
       }
 
-      auto parentType = currArg.type->parent;
-      while (parentType)
-      {
-        auto fact = *this;
-        fact.setArgumentType(i, parentType);
-        pRes.emplace_back(fact.factSignature());
-        parentType = parentType->parent;
-      }
+      _generateSignatureForUpperTypesOfAnArgument(pRes, _name, signatureTypes, signatureTypes.arguments[i]);
     }
   }
 
   // Generate fluent sub and upper types
-  if (_fluent && _fluent->type)
+  const auto* fluentTypePtr = signatureTypes.fluent;
+  if (fluentTypePtr != nullptr)
   {
     if (_fluent->isAParameterToFill())
     {
-      for (const auto& currSubType : _fluent->type->subTypes)
+      for (const auto& currSubType : fluentTypePtr->subTypes)
       {
-        auto fact = *this;
-        fact.setFluentType(currSubType);
-        fact.generateSignatureForAllSubTypes(pRes);
+        signatureTypes.fluent = &*currSubType;
+        _generateSignatureForAllSubTypes(pRes, _name, signatureTypes, _arguments, _fluent);
       }
+      signatureTypes.fluent = fluentTypePtr;
     }
 
-    auto parentType = _fluent->type->parent;
-    while (parentType)
-    {
-      auto fact = *this;
-      fact.setFluentType(parentType);
-      pRes.emplace_back(fact.factSignature());
-      parentType = parentType->parent;
-    }
+    _generateSignatureForUpperTypesOfAnArgument(pRes, _name, signatureTypes, signatureTypes.fluent);
   }
 }
 
 
 
 
+void Fact::setArgument(std::size_t pIndex, const Entity& pArgument)
+{
+  _arguments[pIndex] = pArgument;
+  _resetFactSignatureCache();
+}
+
 void Fact::setArgumentType(std::size_t pIndex, const std::shared_ptr<Type>& pType)
 {
   _arguments[pIndex].type = pType;
@@ -1065,7 +1204,7 @@ void Fact::setFluent(const std::optional<Entity>& pFluent)
 void Fact::setFluentValue(const std::string& pFluentStr)
 {
   if (_fluent)
-    _fluent->value = pFluentStr;
+    _fluent->setValue(pFluentStr);
   else
     _fluent = Entity(pFluentStr, predicate.fluent);
   _resetFactSignatureCache();
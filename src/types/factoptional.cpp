@@ -80,14 +80,30 @@ std::string FactOptional::toStr(const std::function<std::string (const Fact&)>*
 std::string FactOptional::toPddl(bool pInEffectContext,
                                  bool pPrintAnyFluent) const
 {
-  auto res = fact.toPddl(pInEffectContext, pPrintAnyFluent);
+  std::string res;
+  toPddl(res, pInEffectContext, pPrintAnyFluent);
+  return res;
+}
+
+void FactOptional::toPddl(std::string& pRes,
+                          bool pInEffectContext,
+                          bool pPrintAnyFluent) const
+{
   if (isFactNegated)
   {
     if (fact.fluent() && fact.fluent()->isAnyValue())
-      return (pInEffectContext ? "(assign " : "(= ") + res + " undefined)";
-    return "(not " + res + ")";
+    {
+      pRes += pInEffectContext ? "(assign " : "(= ";
+      fact.toPddl(pRes, pInEffectContext, pPrintAnyFluent);
+      pRes += " undefined)";
+      return;
+    }
+    pRes += "(not ";
+    fact.toPddl(pRes, pInEffectContext, pPrintAnyFluent);
+    pRes += ')';
+    return;
   }
-  return res;
+  fact.toPddl(pRes, pInEffectContext, pPrintAnyFluent);
 }
 
 bool FactOptional::doesFactEffectOfSuccessorGiveAnInterestForSuccessor(const FactOptional& pOptFact) const
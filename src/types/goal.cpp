@@ -4,6 +4,7 @@
 #include <orderedgoalsplanner/types/domain.hpp>
 #include <orderedgoalsplanner/util/serializer/deserializefrompddl.hpp>
 #include <orderedgoalsplanner/util/serializer/serializeinpddl.hpp>
+#include "../util/plannerstatisticscollector.hpp"
 
 namespace ogp
 {
@@ -19,11 +20,8 @@ Goal::Goal(std::unique_ptr<Condition> pObjective,
     _isPersistentIfSkipped(pIsPersistentIfSkipped),
     _oneStepTowards(pOneStepTowards),
     _goalGroupId(pGoalGroupId),
-    _uuidOfLastDomainUsedForCache(),
-    _cacheOfActionsThatCanSatisfyThisGoal(),
-    _cacheOfEventsIdThatCanSatisfyThisGoal(),
-    _cacheOfActionsPredecessors(),
-    _cacheOfEventsPredecessors()
+    _caches(),
+    _satisfactionCache()
 {
   assert(_objective);
 }
@@ -32,17 +30,14 @@ Goal::Goal(std::unique_ptr<Condition> pObjective,
 Goal::Goal(const Goal& pOther,
            const std::map<Parameter, Entity>* pParametersPtr,
            const std::string* pGoalGroupIdPtr)
-  : _objective(pOther._objective->clone(pParametersPtr)),
+  : _objective(pParametersPtr != nullptr ? std::shared_ptr<Condition>(pOther._objective->clone(pParametersPtr)) : pOther._objective),
     _maxTimeToKeepInactive(pOther._maxTimeToKeepInactive),
     _inactiveSince(pOther._inactiveSince ? std::make_unique<std::chrono::steady_clock::time_point>(*pOther._inactiveSince) : std::unique_ptr<std::chrono::steady_clock::time_point>()),
     _isPersistentIfSkipped(pOther._isPersistentIfSkipped),
     _oneStepTowards(pOther._oneStepTowards),
     _goalGroupId(pGoalGroupIdPtr != nullptr ? *pGoalGroupIdPtr : pOther._goalGroupId),
-    _uuidOfLastDomainUsedForCache(pOther._uuidOfLastDomainUsedForCache),
-    _cacheOfActionsThatCanSatisfyThisGoal(pOther._cacheOfActionsThatCanSatisfyThisGoal),
-    _cacheOfEventsIdThatCanSatisfyThisGoal(pOther._cacheOfEventsIdThatCanSatisfyThisGoal),
-    _cacheOfActionsPredecessors(pOther._cacheOfActionsPredecessors),
-    _cacheOfEventsPredecessors(pOther._cacheOfEventsPredecessors)
+    _caches(pOther._caches),
+    _satisfactionCache(pParametersPtr == nullptr ? pOther._satisfactionCache : std::nullopt)
 {
 }
 
@@ -62,7 +57,7 @@ Goal Goal::fromStr(const std::string& pStr,
 
 void Goal::operator=(const Goal& pOther)
 {
-  _objective = pOther._objective->clone();
+  _objective = pOther._objective;
   _maxTimeToKeepInactive = pOther._maxTimeToKeepInactive;
   if (pOther._inactiveSince)
     _inactiveSince = std::make_unique<std::chrono::steady_clock::time_point>(*pOther._inactiveSince);
@@ -71,25 +66,27 @@ void Goal::operator=(const Goal& pOther)
   _isPersistentIfSkipped = pOther._isPersistentIfSkipped;
   _oneStepTowards = pOther._oneStepTowards;
   _goalGroupId = pOther._goalGroupId;
-  _uuidOfLastDomainUsedForCache = pOther._uuidOfLastDomainUsedForCache;
-  _cacheOfActionsThatCanSatisfyThisGoal = pOther._cacheOfActionsThatCanSatisfyThisGoal;
-  _cacheOfEventsIdThatCanSatisfyThisGoal = pOther._cacheOfEventsIdThatCanSatisfyThisGoal;
-  _cacheOfActionsPredecessors = pOther._cacheOfActionsPredecessors;
-  _cacheOfEventsPredecessors = pOther._cacheOfEventsPredecessors;
+  _caches = pOther._caches;
+  _satisfactionCache = pOther._satisfactionCache;
 }
 
 bool Goal::operator==(const Goal& pOther) const
 {
-  return *_objective == *pOther._objective &&
+  return hasSameObjectiveAs(pOther) &&
       _maxTimeToKeepInactive == pOther._maxTimeToKeepInactive &&
       _isPersistentIfSkipped == pOther._isPersistentIfSkipped &&
       _oneStepTowards == pOther._oneStepTowards &&
       _goalGroupId == pOther._goalGroupId &&
-      _uuidOfLastDomainUsedForCache == pOther._uuidOfLastDomainUsedForCache &&
-      _cacheOfActionsThatCanSatisfyThisGoal == pOther._cacheOfActionsThatCanSatisfyThisGoal &&
-      _cacheOfEventsIdThatCanSatisfyThisGoal == pOther._cacheOfEventsIdThatCanSatisfyThisGoal &&
-      _cacheOfActionsPredecessors == pOther._cacheOfActionsPredecessors &&
-      _cacheOfEventsPredecessors == pOther._cacheOfEventsPredecessors;
+      (_caches == pOther._caches || _getCaches() == pOther._getCaches());
+}
+
+bool Goal::Caches::operator==(const Caches& pOther) const
+{
+  return uuidOfLastDomainUsed == pOther.uuidOfLastDomainUsed &&
+      actionsThatCanSatisfyThisGoal == pOther.actionsThatCanSatisfyThisGoal &&
+      eventsIdThatCanSatisfyThisGoal == pOther.eventsIdThatCanSatisfyThisGoal &&
+      actionsPredecessors == pOther.actionsPredecessors &&
+      eventsPredecessors == pOther.eventsPredecessors;
 }
 
 std::unique_ptr<Goal> Goal::clone() const
@@ -97,6 +94,19 @@ std::unique_ptr<Goal> Goal::clone() const
   return std::make_unique<Goal>(*this);
 }
 
+bool Goal::hasSameObjectiveAs(const Goal& pOther) const
+{
+  return _objective == pOther._objective || *_objective == *pOther._objective;
+}
+
+Condition& Goal::objective()
+{
+  _satisfactionCache.reset();
+  if (_objective.use_count() > 1)
+    _objective = std::shared_ptr<Condition>(_objective->clone());
+  return *_objective;
+}
+
 void Goal::setInactiveSinceIfNotAlreadySet(const std::unique_ptr<std::chrono::steady_clock::time_point>& pInactiveSince)
 {
   if (!_inactiveSince && pInactiveSince)
@@ -148,14 +158,18 @@ bool Goal::isASimpleFactObjective() const
 
 void Goal::refreshIfNeeded(const Domain& pDomain)
 {
-  if (_uuidOfLastDomainUsedForCache == pDomain.getUuid())
+  if (_caches && _caches->uuidOfLastDomainUsed == pDomain.getUuid())
+  {
+    ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfCacheHits);
     return;
-  _uuidOfLastDomainUsedForCache = pDomain.getUuid();
+  }
+  ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfCacheMisses);
+  // The previous caches can be shared with other goals so new ones are built
+  auto caches = std::make_shared<Caches>();
+  caches->uuidOfLastDomainUsed = pDomain.getUuid();
 
   ConditionsToValue conditionsToValue;
   conditionsToValue.add(*_objective, "goal");
-  _cacheOfActionsPredecessors.clear();
-  _cacheOfEventsPredecessors.clear();
 
   auto optFactIteration = [&](const FactOptional& pFactOptional,
                               const std::unique_ptr<Condition>& pPreCondition,
@@ -183,7 +197,6 @@ void Goal::refreshIfNeeded(const Domain& pDomain)
   };
 
   // Update actions cache
-  _cacheOfActionsThatCanSatisfyThisGoal.clear();
   for (const auto& currIdToAction : pDomain.getActions())
   {
     auto search = ContinueOrBreak::CONTINUE;
@@ -205,17 +218,16 @@ void Goal::refreshIfNeeded(const Domain& pDomain)
     }
     if (search == ContinueOrBreak::BREAK)
     {
-      _cacheOfActionsThatCanSatisfyThisGoal.insert(currIdToAction.first);
-      _cacheOfActionsPredecessors.insert(currIdToAction.first);
-      _cacheOfActionsPredecessors.insert(currAction.actionsPredecessorsCache.begin(),
-                                         currAction.actionsPredecessorsCache.end());
-      _cacheOfEventsPredecessors.insert(currAction.eventsPredecessorsCache.begin(),
+      caches->actionsThatCanSatisfyThisGoal.insert(currIdToAction.first);
+      caches->actionsPredecessors.insert(currIdToAction.first);
+      caches->actionsPredecessors.insert(currAction.actionsPredecessorsCache.begin(),
+                                                currAction.actionsPredecessorsCache.end());
+      caches->eventsPredecessors.insert(currAction.eventsPredecessorsCache.begin(),
                                         currAction.eventsPredecessorsCache.end());
     }
   }
 
   // Update events cache
-  _cacheOfEventsIdThatCanSatisfyThisGoal.clear();
   for (const auto& currIdToSetOfEvents : pDomain.getSetOfEvents())
   {
     for (const auto& currSetOfEvents : currIdToSetOfEvents.second.events())
@@ -229,16 +241,17 @@ void Goal::refreshIfNeeded(const Domain& pDomain)
         });
         if (search == ContinueOrBreak::BREAK)
         {
-          _cacheOfEventsIdThatCanSatisfyThisGoal.insert(fullEventId);
-          _cacheOfEventsPredecessors.insert(fullEventId);
-          _cacheOfActionsPredecessors.insert(currEvent.actionsPredecessorsCache.begin(),
-                                             currEvent.actionsPredecessorsCache.end());
-          _cacheOfEventsPredecessors.insert(currEvent.eventsPredecessorsCache.begin(),
+          caches->eventsIdThatCanSatisfyThisGoal.insert(fullEventId);
+          caches->eventsPredecessors.insert(fullEventId);
+          caches->actionsPredecessors.insert(currEvent.actionsPredecessorsCache.begin(),
+                                                    currEvent.actionsPredecessorsCache.end());
+          caches->eventsPredecessors.insert(currEvent.eventsPredecessorsCache.begin(),
                                             currEvent.eventsPredecessorsCache.end());
         }
       }
     }
   }
+  _caches = std::move(caches);
 }
 
 
@@ -248,7 +261,8 @@ std::string Goal::printActionsThatCanSatisfyThisGoal() const
 
   // Print actions cache
   bool firstIteration = true;
-  for (const auto& currId : _cacheOfActionsThatCanSatisfyThisGoal)
+  const auto& caches = _getCaches();
+  for (const auto& currId : caches.actionsThatCanSatisfyThisGoal)
   {
     if (firstIteration)
     {
@@ -264,7 +278,7 @@ std::string Goal::printActionsThatCanSatisfyThisGoal() const
 
   // Print events cache
   firstIteration = true;
-  for (const auto& currId : _cacheOfEventsIdThatCanSatisfyThisGoal)
+  for (const auto& currId : caches.eventsIdThatCanSatisfyThisGoal)
   {
     if (firstIteration)
     {
@@ -286,12 +300,12 @@ std::string Goal::printActionsThatCanSatisfyThisGoal() const
 
 bool Goal::canActionSatisfyThisGoal(const ActionId& pActionId) const
 {
-  return _cacheOfActionsThatCanSatisfyThisGoal.count(pActionId) > 0;
+  return _getCaches().actionsThatCanSatisfyThisGoal.count(pActionId) > 0;
 }
 
 bool Goal::canEventSatisfyThisGoal(const ActionId& pFullEventId) const
 {
-  return _cacheOfEventsIdThatCanSatisfyThisGoal.count(pFullEventId) > 0;
+  return _getCaches().eventsIdThatCanSatisfyThisGoal.count(pFullEventId) > 0;
 }
 
 bool Goal::canDeductionSatisfyThisGoal(const ActionId& pDeductionId) const
@@ -300,6 +314,13 @@ bool Goal::canDeductionSatisfyThisGoal(const ActionId& pDeductionId) const
 }
 
 
+const Goal::Caches& Goal::_getCaches() const
+{
+  static const Caches emptyCaches;
+  return _caches ? *_caches : emptyCaches;
+}
+
+
 const std::string& Goal::getPersistFunctionName()
 {
   static const std::string persistFunctionName = "persist";
@@ -51,6 +51,16 @@ std::size_t Historical::getNbOfTimeAnActionHasAlreadyBeenDone(const ActionId& pA
   return _getNbOfTimeAnActionHasAlreadyBeenDone(pActionId);
 }
 
+std::map<ActionId, std::size_t> Historical::getActionToNumberOfTimeAlreadyDone() const
+{
+  if (_mutexPtr)
+  {
+    std::lock_guard<std::mutex> lock(*_mutexPtr);
+    return _actionToNumberOfTimeAleardyDone;
+  }
+  return _actionToNumberOfTimeAleardyDone;
+}
+
 bool Historical::_hasActionAlreadyBeenDone(const ActionId& pActionId) const
 {
   return _actionToNumberOfTimeAleardyDone.count(pActionId) > 0;
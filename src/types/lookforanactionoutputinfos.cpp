@@ -9,7 +9,8 @@ LookForAnActionOutputInfos::LookForAnActionOutputInfos()
    _nbOfNonPersistentGoalsNotSatisfied(0),
    _goalsSatisfied(),
    _persistentGoalsSatisfied(),
-   _firstGoalInSuccess()
+   _firstGoalInSuccess(),
+   _statistics()
 {
 }
 
@@ -38,5 +39,14 @@ void LookForAnActionOutputInfos::notifyNotSatisfiedGoal(const Goal& pGoal)
     ++_nbOfNonPersistentGoalsNotSatisfied;
 }
 
+
+void LookForAnActionOutputInfos::enableStatistics()
+{
+#ifdef ORDEREDGOALSPLANNER_STATISTICS
+  if (!_statistics)
+    _statistics.emplace();
+#endif
+}
+
 } // !ogp
 
@@ -0,0 +1,30 @@
+#include <orderedgoalsplanner/types/planneroptions.hpp>
+#include <stdexcept>
+
+
+namespace ogp
+{
+
+std::string plannerSearchModeToStr(PlannerSearchMode pSearchMode)
+{
+  switch (pSearchMode)
+  {
+  case PlannerSearchMode::GREEDY:
+    return "greedy";
+  case PlannerSearchMode::ROLLOUT_OPTIMAL:
+    return "rollout-optimal";
+  }
+  return "";
+}
+
+
+PlannerSearchMode plannerSearchModeFromStr(const std::string& pStr)
+{
+  if (pStr == "greedy")
+    return PlannerSearchMode::GREEDY;
+  if (pStr == "rollout-optimal")
+    return PlannerSearchMode::ROLLOUT_OPTIMAL;
+  throw std::runtime_error("\"" + pStr + "\" is not a search mode, the search modes are greedy and rollout-optimal");
+}
+
+} // !ogp
@@ -0,0 +1,71 @@
+#include <orderedgoalsplanner/types/plannerstatistics.hpp>
+
+
+namespace ogp
+{
+namespace
+{
+
+void _addLine(std::string& pRes,
+              const std::string& pName,
+              std::size_t pValue)
+{
+  pRes += pName + ": " + std::to_string(pValue) + "\n";
+}
+
+void _addLine(std::string& pRes,
+              const std::string& pName,
+              const std::chrono::nanoseconds& pDuration)
+{
+  _addLine(pRes, pName + "_us",
+           static_cast<std::size_t>(std::chrono::duration_cast<std::chrono::microseconds>(pDuration).count()));
+}
+
+}
+
+
+void PlannerStatistics::add(const PlannerStatistics& pOther)
+{
+  nbOfCandidateActionsEvaluated += pOther.nbOfCandidateActionsEvaluated;
+  nbOfLookForAPossibleEffectCalls += pOther.nbOfLookForAPossibleEffectCalls;
+  nbOfRollouts += pOther.nbOfRollouts;
+  nbOfTruncatedRollouts += pOther.nbOfTruncatedRollouts;
+  nbOfGoalPartitionsPlannedInParallel += pOther.nbOfGoalPartitionsPlannedInParallel;
+  nbOfProblemCopies += pOther.nbOfProblemCopies;
+  nbOfEventPropagationRounds += pOther.nbOfEventPropagationRounds;
+  nbOfCacheHits += pOther.nbOfCacheHits;
+  nbOfCacheMisses += pOther.nbOfCacheMisses;
+  nbOfGoalSatisfactionCacheHits += pOther.nbOfGoalSatisfactionCacheHits;
+  nbOfGoalSatisfactionCacheMisses += pOther.nbOfGoalSatisfactionCacheMisses;
+  goalRefreshDuration += pOther.goalRefreshDuration;
+  cacheRefreshDuration += pOther.cacheRefreshDuration;
+  candidateSearchDuration += pOther.candidateSearchDuration;
+  rolloutDuration += pOther.rolloutDuration;
+  effectApplicationDuration += pOther.effectApplicationDuration;
+}
+
+
+std::string PlannerStatistics::toStr() const
+{
+  std::string res;
+  _addLine(res, "candidate_actions_evaluated", nbOfCandidateActionsEvaluated);
+  _addLine(res, "look_for_a_possible_effect_calls", nbOfLookForAPossibleEffectCalls);
+  _addLine(res, "rollouts", nbOfRollouts);
+  _addLine(res, "truncated_rollouts", nbOfTruncatedRollouts);
+  _addLine(res, "goal_partitions_planned_in_parallel", nbOfGoalPartitionsPlannedInParallel);
+  _addLine(res, "problem_copies", nbOfProblemCopies);
+  _addLine(res, "event_propagation_rounds", nbOfEventPropagationRounds);
+  _addLine(res, "cache_hits", nbOfCacheHits);
+  _addLine(res, "cache_misses", nbOfCacheMisses);
+  _addLine(res, "goal_satisfaction_cache_hits", nbOfGoalSatisfactionCacheHits);
+  _addLine(res, "goal_satisfaction_cache_misses", nbOfGoalSatisfactionCacheMisses);
+  _addLine(res, "goal_refresh", goalRefreshDuration);
+  _addLine(res, "cache_refresh", cacheRefreshDuration);
+  _addLine(res, "candidate_search", candidateSearchDuration);
+  _addLine(res, "rollout", rolloutDuration);
+  _addLine(res, "effect_application", effectApplicationDuration);
+  return res;
+}
+
+
+} // !ogp
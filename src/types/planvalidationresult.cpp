@@ -0,0 +1,19 @@
+#include <orderedgoalsplanner/types/planvalidationresult.hpp>
+
+namespace ogp
+{
+
+std::string PlanValidationResult::toStr() const
+{
+  if (!failingStepIndex)
+    return "valid";
+  std::string res = "invalid at step " + std::to_string(*failingStepIndex);
+  if (!failingActionId.empty())
+    res += " (" + failingActionId + ")";
+  if (!reason.empty())
+    res += ": " + reason;
+  return res;
+}
+
+
+} // !ogp
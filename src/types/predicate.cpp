@@ -59,6 +59,16 @@ Predicate::Predicate(const std::string& pStr,
 }
 
 
+Predicate::Predicate(const std::string& pName,
+                     const std::vector<Parameter>& pParameters,
+                     const std::shared_ptr<Type>& pFluent)
+  : name(pName),
+    parameters(pParameters),
+    fluent(pFluent)
+{
+}
+
+
 std::string Predicate::toPddl() const
 {
   std::string res = "(" + name;
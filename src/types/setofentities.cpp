@@ -1,14 +1,21 @@
 #include <orderedgoalsplanner/types/setofentities.hpp>
+#include <atomic>
 #include <vector>
 #include <orderedgoalsplanner/util/util.hpp>
 #include <orderedgoalsplanner/types/setoftypes.hpp>
 #include <orderedgoalsplanner/types/type.hpp>
 namespace ogp
 {
+namespace
+{
+/// Next modification stamp, shared by all the sets of entities so that a stamp identifies a modification.
+std::atomic<std::uint64_t> _nextModificationStamp{1};
+}
 
 SetOfEntities::SetOfEntities()
     : _valueToEntity(),
-      _typeNameToEntities()
+      _typeNameToEntities(),
+      _modificationStamp(_nextModificationStamp++)
 {
 }
 
@@ -28,6 +35,7 @@ void SetOfEntities::add(const Entity& pEntity)
 
   if (pEntity.type)
     _typeNameToEntities[pEntity.type->name].insert(pEntity);
+  _modificationStamp = _nextModificationStamp++;
 }
 
 void SetOfEntities::addAllFromPddl(const std::string& pStr,
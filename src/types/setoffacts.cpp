@@ -80,6 +80,13 @@ SetOfFacts SetOfFacts::fromPddl(const std::string& pStr,
 std::string SetOfFacts::toPddl(std::size_t pIdentation, bool pPrintTimeLessFactsToo) const
 {
   std::string res;
+  toPddl(res, pIdentation, pPrintTimeLessFactsToo);
+  return res;
+}
+
+
+void SetOfFacts::toPddl(std::string& pRes, std::size_t pIdentation, bool pPrintTimeLessFactsToo) const
+{
   bool firstIteration = true;
   for (auto& currFact : _facts)
   {
@@ -88,10 +95,10 @@ std::string SetOfFacts::toPddl(std::size_t pIdentation, bool pPrintTimeLessFacts
     if (firstIteration)
       firstIteration = false;
     else
-      res += "\n";
-    res += std::string(pIdentation, ' ') + currFact.first.toPddl(false, true);
+      pRes += '\n';
+    pRes.append(pIdentation, ' ');
+    currFact.first.toPddl(pRes, false, true);
   }
-  return res;
 }
 
 
@@ -409,6 +416,30 @@ bool SetOfFacts::hasFact(const Fact& pFact) const
 }
 
 
+std::size_t SetOfFacts::estimateNbOfMatchingFacts(const Fact& pFact) const
+{
+  auto itParameterToValues = _signatureToLists.find(pFact.factSignature());
+  if (itParameterToValues == _signatureToLists.end())
+    return 0;
+
+  const ParameterToValues& parameterToValues = itParameterToValues->second;
+  std::size_t res = parameterToValues.all.size();
+  auto& factArguments = pFact.arguments();
+  for (std::size_t i = 0; i < factArguments.size(); ++i)
+  {
+    if (!factArguments[i].isAParameterToFill())
+    {
+      const auto& argValueToValues = parameterToValues.argIdToArgValueToValues[i];
+      auto itForThisValue = argValueToValues.find(factArguments[i].value);
+      if (itForThisValue == argValueToValues.end())
+        return 0;
+      res = std::min(res, itForThisValue->second.size());
+    }
+  }
+  return res;
+}
+
+
 void SetOfFacts::_removeAValueForList(std::list<Fact>& pList,
                                      const Fact& pValue) const
 {
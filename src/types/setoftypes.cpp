@@ -1,5 +1,6 @@
 #include <orderedgoalsplanner/types/setoftypes.hpp>
 #include <stdexcept>
+#include <set>
 #include <sstream>
 #include <vector>
 #include <orderedgoalsplanner/util/util.hpp>
@@ -12,6 +13,42 @@ namespace
 const std::string _numberTypeName = "number";
 const std::shared_ptr<Type> _numberType = std::make_shared<Type>(_numberTypeName);
 
+bool _collectTypeNames(std::set<std::string>& pNames,
+                       const Type& pType)
+{
+  if (!pNames.insert(pType.name).second)
+    return false;
+  for (const auto& currSubType : pType.subTypes)
+    if (!_collectTypeNames(pNames, *currSubType))
+      return false;
+  return true;
+}
+
+void _setHierarchyIndexes(Type& pType,
+                          const Type* pRootPtr,
+                          std::size_t& pCounter)
+{
+  pType.hierarchyRootPtr = pRootPtr;
+  pType.preOrderIndex = pCounter++;
+  for (auto& currSubType : pType.subTypes)
+    _setHierarchyIndexes(*currSubType, pRootPtr, pCounter);
+  pType.postOrderIndex = pCounter++;
+}
+
+/// Recompute the interval encoding of the hierarchy containing the given type.
+/// If a name is present twice in the hierarchy the encoding is disabled, so that Type::isA keeps comparing the names.
+void _updateHierarchyIndexes(Type& pType)
+{
+  Type* rootPtr = &pType;
+  while (rootPtr->parent)
+    rootPtr = rootPtr->parent.get();
+
+  std::set<std::string> names;
+  const Type* hierarchyRootPtr = _collectTypeNames(names, *rootPtr) ? rootPtr : nullptr;
+  std::size_t counter = 0;
+  _setHierarchyIndexes(*rootPtr, hierarchyRootPtr, counter);
+}
+
 void _removeAfterSemicolon(std::string& str) {
     size_t pos = str.find(';');
     if (pos != std::string::npos) {
@@ -43,6 +80,7 @@ void SetOfTypes::addType(const std::string& pTypeToAdd,
   {
     _types.push_back(std::make_shared<Type>(pTypeToAdd));
     _nameToType[pTypeToAdd] = _types.back();
+    _updateHierarchyIndexes(*_types.back());
     return;
   }
 
@@ -56,6 +94,7 @@ void SetOfTypes::addType(const std::string& pTypeToAdd,
   auto type = std::make_shared<Type>(pTypeToAdd, it->second);
   it->second->subTypes.push_back(type);
   _nameToType[pTypeToAdd] = it->second->subTypes.back();
+  _updateHierarchyIndexes(*type);
 }
 
 
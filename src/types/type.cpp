@@ -8,7 +8,10 @@ Type::Type(const std::string& pName,
            const std::shared_ptr<Type>& pParent)
     : name(pName),
       parent(pParent),
-      subTypes()
+      subTypes(),
+      preOrderIndex(0),
+      postOrderIndex(0),
+      hierarchyRootPtr(nullptr)
 {
 }
 
@@ -40,6 +43,11 @@ void Type::toStrs(std::list<std::string>& pStrs) const
 
 bool Type::isA(const Type& pOtherType) const
 {
+  if (this == &pOtherType)
+    return true;
+  if (hierarchyRootPtr != nullptr && hierarchyRootPtr == pOtherType.hierarchyRootPtr)
+    return pOtherType.preOrderIndex <= preOrderIndex && postOrderIndex <= pOtherType.postOrderIndex;
+
   if (name == pOtherType.name)
     return true;
   if (parent)
@@ -1,4 +1,5 @@
 #include <orderedgoalsplanner/types/worldstate.hpp>
+#include <atomic>
 #include <list>
 #include <orderedgoalsplanner/types/goalstack.hpp>
 #include <orderedgoalsplanner/types/actioninvocationwithgoal.hpp>
@@ -11,12 +12,21 @@
 #include <orderedgoalsplanner/util/serializer/deserializefrompddl.hpp>
 #include "expressionParsed.hpp"
 #include "worldstatecache.hpp"
+#include "../util/plannerstatisticscollector.hpp"
 
 namespace ogp
 {
 
 namespace
 {
+/// Next modification stamp, shared by all the world states so that a stamp identifies a modification.
+std::atomic<std::uint64_t> _nextModificationStamp{1};
+
+std::uint64_t _newModificationStamp()
+{
+  return _nextModificationStamp++;
+}
+
 
 bool _isNegatedFactCompatibleWithFacts(
     const Fact& pNegatedFact,
@@ -39,7 +49,9 @@ WorldState::WorldState(const SetOfFacts* pFactsPtr)
     onFactsAdded(),
     onFactsRemoved(),
     _factsMapping(pFactsPtr != nullptr ? *pFactsPtr : SetOfFacts()),
-    _cache(std::make_unique<WorldStateCache>(*this))
+    _cache(std::make_unique<WorldStateCache>(*this)),
+    _initialModificationStamp(_newModificationStamp()),
+    _factNameToModificationStamp()
 {
 }
 
@@ -50,7 +62,9 @@ WorldState::WorldState(const WorldState& pOther)
     onFactsAdded(),
     onFactsRemoved(),
     _factsMapping(pOther._factsMapping),
-    _cache(std::make_unique<WorldStateCache>(*this, *pOther._cache))
+    _cache(std::make_unique<WorldStateCache>(*this, *pOther._cache)),
+    _initialModificationStamp(pOther._initialModificationStamp),
+    _factNameToModificationStamp(pOther._factNameToModificationStamp)
 {
 }
 
@@ -64,6 +78,8 @@ void WorldState::operator=(const WorldState& pOther)
 {
   _factsMapping = pOther._factsMapping;
   _cache = std::make_unique<WorldStateCache>(*this, *pOther._cache);
+  _initialModificationStamp = pOther._initialModificationStamp;
+  _factNameToModificationStamp = pOther._factNameToModificationStamp;
 }
 
 
@@ -113,17 +129,8 @@ void WorldState::applyEffect(const std::map<Parameter, Entity>& pParameters,
   const bool canFactsBeRemoved = true;
   WhatChanged whatChanged;
   if (pEffect)
-  {
-    if (pParameters.empty())
-    {
-      _modify(whatChanged, &*pEffect, pGoalStack, pSetOfEvents, pCallbacks, pOntology, pEntities, pNow, canFactsBeRemoved);
-    }
-    else
-    {
-      auto effect = pEffect->clone(&pParameters);
-      _modify(whatChanged, &*effect, pGoalStack, pSetOfEvents, pCallbacks, pOntology, pEntities, pNow, canFactsBeRemoved);
-    }
-  }
+    _modify(whatChanged, &*pEffect, pGoalStack, pSetOfEvents, pCallbacks, pOntology, pEntities, pNow, canFactsBeRemoved,
+            pParameters.empty() ? nullptr : &pParameters);
 
   _notifyWhatChanged(whatChanged, pGoalChanged, pGoalStack, pSetOfEvents,
                      pCallbacks, pOntology, pEntities, pNow);
@@ -198,6 +205,36 @@ bool WorldState::removeFacts(const FACTS& pFacts,
   return whatChanged.hasFactsToModifyInTheWorldForSure();
 }
 
+template bool WorldState::removeFacts<std::set<Fact>>(const std::set<Fact>&, GoalStack&, const std::map<SetOfEventsId, SetOfEvents>&, const SetOfCallbacks&, const Ontology&, const SetOfEntities&, const std::unique_ptr<std::chrono::steady_clock::time_point>&);
+template bool WorldState::removeFacts<std::vector<Fact>>(const std::vector<Fact>&, GoalStack&, const std::map<SetOfEventsId, SetOfEvents>&, const SetOfCallbacks&, const Ontology&, const SetOfEntities&, const std::unique_ptr<std::chrono::steady_clock::time_point>&);
+
+
+bool WorldState::replicateModifications(const std::vector<Fact>& pFactsToAdd,
+                                        const std::vector<Fact>& pFactsToRemove)
+{
+  WhatChanged whatChanged;
+  for (const auto& currFact : pFactsToAdd)
+  {
+    if (_factsMapping.facts().count(currFact) > 0)
+      continue;
+    whatChanged.addedFacts.insert(currFact);
+    _factsMapping.add(currFact);
+    _notifyFactModified(currFact);
+    _cache->notifyAboutANewFact(currFact);
+  }
+  for (const auto& currFact : pFactsToRemove)
+    if (_factsMapping.facts().count(currFact) > 0)
+      _removeAFact(whatChanged, currFact);
+
+  if (!whatChanged.addedFacts.empty())
+    onFactsAdded(whatChanged.addedFacts);
+  if (!whatChanged.removedFacts.empty())
+    onFactsRemoved(whatChanged.removedFacts);
+  if (whatChanged.hasFactsToModifyInTheWorldForSure())
+    onFactsChanged(_factsMapping.facts());
+  return whatChanged.hasFactsToModifyInTheWorldForSure();
+}
+
 
 template<typename FACTS>
 void WorldState::_addFacts(WhatChanged& pWhatChanged,
@@ -278,6 +315,7 @@ void WorldState::_addAFact(WhatChanged& pWhatChanged,
   {
     pWhatChanged.addedFacts.insert(pFact);
     _factsMapping.add(pFact, pCanFactsBeRemoved);
+    _notifyFactModified(pFact);
     _cache->notifyAboutANewFact(pFact);
   }
 }
@@ -296,6 +334,7 @@ void WorldState::_removeAFact(WhatChanged& pWhatChanged,
 {
   pWhatChanged.removedFacts.insert(pFact);
   _factsMapping.erase(pFact);
+  _notifyFactModified(pFact);
   _cache->clear();
 }
 
@@ -307,11 +346,14 @@ void WorldState::_modify(WhatChanged& pWhatChanged,
                          const Ontology& pOntology,
                          const SetOfEntities& pEntities,
                          const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
-                         bool pCanFactsBeRemoved)
+                         bool pCanFactsBeRemoved,
+                         const std::map<Parameter, Entity>* pParametersPtr)
 {
   if (pWsModifPtr == nullptr)
     return;
 
+  // The buffers used to substitute the parameters are kept from one effect application to the next
+  thread_local WorldStateModificationScratch scratch;
   std::list<Fact> factsToAdd;
   std::list<Fact> factsToRemove;
   pWsModifPtr->forAll(
@@ -321,7 +363,7 @@ void WorldState::_modify(WhatChanged& pWhatChanged,
       factsToRemove.emplace_back(pFactOptional.fact);
     else
       factsToAdd.emplace_back(pFactOptional.fact);
-  }, _factsMapping);
+  }, _factsMapping, pParametersPtr, &scratch);
 
   _addFacts(pWhatChanged, factsToAdd, pGoalStack, pSetOfEvents, pCallbacks, pOntology, pEntities, pNow, pCanFactsBeRemoved);
   _removeFacts(pWhatChanged, factsToRemove);
@@ -336,10 +378,11 @@ bool WorldState::modify(const WorldStateModification* pWsModifPtr,
                         const Ontology& pOntology,
                         const SetOfEntities& pEntities,
                         const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
-                        bool pCanFactsBeRemoved)
+                        bool pCanFactsBeRemoved,
+                        const std::map<Parameter, Entity>* pParametersPtr)
 {
   WhatChanged whatChanged;
-  _modify(whatChanged, pWsModifPtr, pGoalStack, pSetOfEvents, pCallbacks, pOntology, pEntities, pNow, pCanFactsBeRemoved);
+  _modify(whatChanged, pWsModifPtr, pGoalStack, pSetOfEvents, pCallbacks, pOntology, pEntities, pNow, pCanFactsBeRemoved, pParametersPtr);
   bool goalChanged = false;
   _notifyWhatChanged(whatChanged, goalChanged, pGoalStack, pSetOfEvents, pCallbacks,
                      pOntology, pEntities, pNow);
@@ -358,6 +401,8 @@ void WorldState::setFacts(const std::set<Fact>& pFacts,
   _factsMapping.clear();
   for (const auto& currFact : pFacts)
     _factsMapping.add(currFact);
+  _initialModificationStamp = _newModificationStamp();
+  _factNameToModificationStamp.clear();
   _cache->clear();
   WhatChanged whatChanged;
   pGoalStack._removeNoStackableGoalsAndNotifyGoalsChanged(*this, pOntology.constants, pEntities, pNow);
@@ -524,12 +569,50 @@ bool WorldState::isGoalSatisfied(const Goal& pGoal,
                                  const SetOfEntities& pConstants,
                                  const SetOfEntities& pObjects) const
 {
-  return pGoal.objective().isTrue(*this, pConstants, pObjects);
+  auto& satisfactionCacheOpt = pGoal._satisfactionCache;
+  if (!satisfactionCacheOpt)
+  {
+    std::set<std::string> watchedFactNames;
+    pGoal.objective().forAll([&](const FactOptional& pFactOptional, bool) {
+      watchedFactNames.insert(pFactOptional.fact.name());
+      return ContinueOrBreak::CONTINUE;
+    });
+    satisfactionCacheOpt.emplace();
+    satisfactionCacheOpt->watchedFactNames.assign(watchedFactNames.begin(), watchedFactNames.end());
+  }
+  else if (satisfactionCacheOpt->constantsStamp == pConstants.modificationStamp() &&
+           satisfactionCacheOpt->objectsStamp == pObjects.modificationStamp() &&
+           satisfactionCacheOpt->watchedFactStamps.size() == satisfactionCacheOpt->watchedFactNames.size())
+  {
+    bool aWatchedFactChanged = false;
+    for (std::size_t i = 0; i < satisfactionCacheOpt->watchedFactNames.size(); ++i)
+    {
+      if (_getModificationStamp(satisfactionCacheOpt->watchedFactNames[i]) != satisfactionCacheOpt->watchedFactStamps[i])
+      {
+        aWatchedFactChanged = true;
+        break;
+      }
+    }
+    if (!aWatchedFactChanged)
+    {
+      ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfGoalSatisfactionCacheHits);
+      return satisfactionCacheOpt->isSatisfied;
+    }
+  }
+
+  ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfGoalSatisfactionCacheMisses);
+  satisfactionCacheOpt->isSatisfied = pGoal.objective().isTrue(*this, pConstants, pObjects);
+  satisfactionCacheOpt->constantsStamp = pConstants.modificationStamp();
+  satisfactionCacheOpt->objectsStamp = pObjects.modificationStamp();
+  satisfactionCacheOpt->watchedFactStamps.clear();
+  for (const auto& currFactName : satisfactionCacheOpt->watchedFactNames)
+    satisfactionCacheOpt->watchedFactStamps.push_back(_getModificationStamp(currFactName));
+  return satisfactionCacheOpt->isSatisfied;
 }
 
 
 void WorldState::iterateOnMatchingFactsWithoutFluentConsideration
-(const std::function<bool (const Fact&)>& pValueCallback,
+(FunctionRef<bool (const Fact&)> pValueCallback,
  const Fact& pFact,
  const std::map<Parameter, std::set<Entity>>& pParametersToConsiderAsAnyValue,
  const std::map<Parameter, std::set<Entity>>* pParametersToConsiderAsAnyValuePtr) const
@@ -543,7 +626,7 @@ void WorldState::iterateOnMatchingFactsWithoutFluentConsideration
 
 
 void WorldState::iterateOnMatchingFacts
-(const std::function<bool (const Fact&)>& pValueCallback,
+(FunctionRef<bool (const Fact&)> pValueCallback,
  const Fact& pFact,
  const std::map<Parameter, std::set<Entity>>& pParametersToConsiderAsAnyValue,
  const std::map<Parameter, std::set<Entity>>* pParametersToConsiderAsAnyValuePtr) const
@@ -563,6 +646,21 @@ void WorldState::refreshCacheIfNeeded(const Domain& pDomain)
 }
 
 
+std::uint64_t WorldState::_getModificationStamp(const std::string& pFactName) const
+{
+  auto it = _factNameToModificationStamp.find(pFactName);
+  if (it != _factNameToModificationStamp.end())
+    return it->second;
+  return _initialModificationStamp;
+}
+
+
+void WorldState::_notifyFactModified(const Fact& pFact)
+{
+  _factNameToModificationStamp[pFact.name()] = _newModificationStamp();
+}
+
+
 const SetOfFacts& WorldState::removableFacts() const
 {
   return _cache->removableFacts();
@@ -609,10 +707,8 @@ bool WorldState::_tryToApplyEvent(std::set<EventId>& pEventsAlreadyApplied,
               if (!parametersToValuePoss.empty())
               {
                 for (const auto& currParamsPoss : parametersToValuePoss)
-                {
-                  auto factsToModify = currEvent.factsToModify->clone(&currParamsPoss);
-                  _modify(pWhatChanged, &*factsToModify, pGoalStack, pSetOfEvents, pCallbacks, pOntology, pEntities, pNow, canFactsBeRemoved);
-                }
+                  _modify(pWhatChanged, &*currEvent.factsToModify, pGoalStack, pSetOfEvents, pCallbacks, pOntology, pEntities, pNow, canFactsBeRemoved,
+                          &currParamsPoss);
               }
               else
               {
@@ -696,6 +792,7 @@ void WorldState::_notifyWhatChanged(WhatChanged& pWhatChanged,
     bool needAnotherLoop = true;
     while (needAnotherLoop)
     {
+      ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfEventPropagationRounds);
       needAnotherLoop = false;
       for (auto& currSetOfEvents : pSetOfEvents)
       {
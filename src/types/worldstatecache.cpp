@@ -2,6 +2,7 @@
 #include <orderedgoalsplanner/types/domain.hpp>
 #include <orderedgoalsplanner/types/worldstate.hpp>
 #include "factsalreadychecked.hpp"
+#include "../util/plannerstatisticscollector.hpp"
 
 
 namespace ogp
@@ -66,7 +67,12 @@ void WorldStateCache::refreshIfNeeded(const Domain& pDomain,
                                       const std::map<Fact, bool>& pFacts)
 {
   if (_uuidOfLastDomainUsed == pDomain.getUuid())
+  {
+    ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfCacheHits);
     return;
+  }
+  ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfCacheMisses);
+  ORDEREDGOALSPLANNER_STATISTICS_PHASE_TIMER(cacheRefreshDuration);
   _uuidOfLastDomainUsed = pDomain.getUuid();
 
   for (int i = 0; i < 2; ++i) // 2 times to have all the accessible facts
@@ -60,6 +60,31 @@ bool _isOkWithLocalParameters(const std::map<Parameter, std::set<Entity>>& pLoca
   return true;
 }
 
+
+FactOptional _factOptionalWithParameters(const FactOptional& pFactOptional,
+                                         const std::map<Parameter, Entity>* pParametersPtr)
+{
+  auto res = pFactOptional;
+  if (pParametersPtr != nullptr)
+    res.fact.replaceArguments(*pParametersPtr);
+  return res;
+}
+
+
+/// Same as above but the fact is written in the scratch, to reuse its buffers instead of allocating a new fact.
+FactOptional& _factOptionalWithParameters(WorldStateModificationScratch& pScratch,
+                                          const FactOptional& pFactOptional,
+                                          const std::map<Parameter, Entity>* pParametersPtr)
+{
+  if (pScratch.factOptional)
+    *pScratch.factOptional = pFactOptional;
+  else
+    pScratch.factOptional.emplace(pFactOptional);
+  if (pParametersPtr != nullptr)
+    pScratch.factOptional->fact.replaceArguments(*pParametersPtr);
+  return *pScratch.factOptional;
+}
+
 }
 
 
@@ -116,41 +141,76 @@ std::string WorldStateModificationNode::toStr(bool pPrintAnyFluent) const
 }
 
 
-void WorldStateModificationNode::forAll(const std::function<void (const FactOptional&)>& pFactCallback,
-                                        const SetOfFacts& pSetOfFact) const
+void WorldStateModificationNode::forAll(FunctionRef<void (const FactOptional&)> pFactCallback,
+                                        const SetOfFacts& pSetOfFact,
+                                        const std::map<Parameter, Entity>* pParametersPtr,
+                                        WorldStateModificationScratch* pScratchPtr) const
 {
+  if (pScratchPtr == nullptr)
+  {
+    WorldStateModificationScratch scratch;
+    return forAll(pFactCallback, pSetOfFact, pParametersPtr, &scratch);
+  }
+
   if (nodeType == WorldStateModificationNodeType::AND)
   {
     if (leftOperand)
-      leftOperand->forAll(pFactCallback, pSetOfFact);
+      leftOperand->forAll(pFactCallback, pSetOfFact, pParametersPtr, pScratchPtr);
     if (rightOperand)
-      rightOperand->forAll(pFactCallback, pSetOfFact);
+      rightOperand->forAll(pFactCallback, pSetOfFact, pParametersPtr, pScratchPtr);
   }
   else if (nodeType == WorldStateModificationNodeType::ASSIGN && leftOperand && rightOperand)
   {
     auto* leftFactPtr = toWmFact(*leftOperand);
     if (leftFactPtr != nullptr)
     {
-      auto factToCheck = leftFactPtr->factOptional;
-      factToCheck.fact.setFluent(rightOperand->getFluent(pSetOfFact));
+      auto& factToCheck = _factOptionalWithParameters(*pScratchPtr, leftFactPtr->factOptional, pParametersPtr);
+      factToCheck.fact.setFluent(rightOperand->getFluent(pSetOfFact, pParametersPtr));
       return pFactCallback(factToCheck);
     }
   }
-  else if (nodeType == WorldStateModificationNodeType::FOR_ALL)
+  else if (nodeType == WorldStateModificationNodeType::FOR_ALL && leftOperand && rightOperand && parameterOpt)
   {
-    _forAllInstruction(
-          [&](const WorldStateModification& pWsModification)
+    auto* leftFactPtr = toWmFact(*leftOperand);
+    if (leftFactPtr != nullptr)
     {
-      pWsModification.forAll(pFactCallback, pSetOfFact);
-    }, pSetOfFact);
+      std::set<Entity> parameterValues;
+      pSetOfFact.extractPotentialArgumentsOfAFactParameter(parameterValues,
+                                                           _factOptionalWithParameters(*pScratchPtr, leftFactPtr->factOptional, pParametersPtr).fact,
+                                                           parameterOpt->name);
+      if (!parameterValues.empty())
+      {
+        // Bind the for all parameter in the scratch map instead of cloning the sub-effect for each value.
+        // Only the outermost for all copies the effect parameters there, the nested ones bind their parameter in place.
+        auto& parameters = pScratchPtr->parameters;
+        if (pParametersPtr != &parameters)
+        {
+          if (pParametersPtr != nullptr)
+            parameters = *pParametersPtr;
+          else
+            parameters.clear();
+        }
+        std::optional<Entity> shadowedValue;
+        auto itShadowedParameter = parameters.find(*parameterOpt);
+        if (itShadowedParameter != parameters.end())
+          shadowedValue = itShadowedParameter->second;
+        for (const auto& paramValue : parameterValues)
+        {
+          parameters.insert_or_assign(*parameterOpt, paramValue);
+          rightOperand->forAll(pFactCallback, pSetOfFact, &parameters, pScratchPtr);
+        }
+        if (shadowedValue)
+          parameters.insert_or_assign(*parameterOpt, *shadowedValue);
+      }
+    }
   }
   else if (nodeType == WorldStateModificationNodeType::INCREASE && leftOperand && rightOperand)
   {
     auto* leftFactPtr = toWmFact(*leftOperand);
     if (leftFactPtr != nullptr)
     {
-      auto factToCheck = leftFactPtr->factOptional;
-      factToCheck.fact.setFluent(plusIntOrStr(leftOperand->getFluent(pSetOfFact), rightOperand->getFluent(pSetOfFact)));
+      auto& factToCheck = _factOptionalWithParameters(*pScratchPtr, leftFactPtr->factOptional, pParametersPtr);
+      factToCheck.fact.setFluent(plusIntOrStr(leftOperand->getFluent(pSetOfFact, pParametersPtr), rightOperand->getFluent(pSetOfFact, pParametersPtr)));
       return pFactCallback(factToCheck);
     }
   }
@@ -159,8 +219,8 @@ void WorldStateModificationNode::forAll(const std::function<void (const FactOpti
     auto* leftFactPtr = toWmFact(*leftOperand);
     if (leftFactPtr != nullptr)
     {
-      auto factToCheck = leftFactPtr->factOptional;
-      factToCheck.fact.setFluent(minusIntOrStr(leftOperand->getFluent(pSetOfFact), rightOperand->getFluent(pSetOfFact)));
+      auto& factToCheck = _factOptionalWithParameters(*pScratchPtr, leftFactPtr->factOptional, pParametersPtr);
+      factToCheck.fact.setFluent(minusIntOrStr(leftOperand->getFluent(pSetOfFact, pParametersPtr), rightOperand->getFluent(pSetOfFact, pParametersPtr)));
       return pFactCallback(factToCheck);
     }
   }
@@ -169,8 +229,8 @@ void WorldStateModificationNode::forAll(const std::function<void (const FactOpti
     auto* leftFactPtr = toWmFact(*leftOperand);
     if (leftFactPtr != nullptr)
     {
-      auto factToCheck = leftFactPtr->factOptional;
-      factToCheck.fact.setFluent(multiplyNbOrStr(leftOperand->getFluent(pSetOfFact), rightOperand->getFluent(pSetOfFact)));
+      auto& factToCheck = _factOptionalWithParameters(*pScratchPtr, leftFactPtr->factOptional, pParametersPtr);
+      factToCheck.fact.setFluent(multiplyNbOrStr(leftOperand->getFluent(pSetOfFact, pParametersPtr), rightOperand->getFluent(pSetOfFact, pParametersPtr)));
       return pFactCallback(factToCheck);
     }
   }
@@ -179,15 +239,14 @@ void WorldStateModificationNode::forAll(const std::function<void (const FactOpti
     auto* leftFactPtr = toWmFact(*leftOperand);
     if (leftFactPtr != nullptr)
     {
-      auto factToCheck = leftFactPtr->factOptional;
-      if (pSetOfFact.hasFact(factToCheck.fact))
-        rightOperand->forAll(pFactCallback, pSetOfFact);
+      if (pSetOfFact.hasFact(_factOptionalWithParameters(*pScratchPtr, leftFactPtr->factOptional, pParametersPtr).fact))
+        rightOperand->forAll(pFactCallback, pSetOfFact, pParametersPtr, pScratchPtr);
     }
   }
 }
 
 
-ContinueOrBreak WorldStateModificationNode::forAllThatCanBeModified(const std::function<ContinueOrBreak (const FactOptional&)>& pFactCallback) const
+ContinueOrBreak WorldStateModificationNode::forAllThatCanBeModified(FunctionRef<ContinueOrBreak (const FactOptional&)> pFactCallback) const
 {
   ContinueOrBreak res = ContinueOrBreak::CONTINUE;
   if (nodeType == WorldStateModificationNodeType::AND)
@@ -224,7 +283,7 @@ ContinueOrBreak WorldStateModificationNode::forAllThatCanBeModified(const std::f
 
 
 void WorldStateModificationNode::iterateOverAllAccessibleFacts(
-    const std::function<void (const FactOptional&)>& pFactCallback,
+    FunctionRef<void (const FactOptional&)> pFactCallback,
     const SetOfFacts& pSetOfFact) const
 {
   if (nodeType == WorldStateModificationNodeType::AND)
@@ -291,7 +350,7 @@ void WorldStateModificationNode::iterateOverAllAccessibleFacts(
 }
 
 
-bool WorldStateModificationNode::forAllUntilTrue(const std::function<bool (const FactOptional&)>& pFactCallback,
+bool WorldStateModificationNode::forAllUntilTrue(FunctionRef<bool (const FactOptional&)> pFactCallback,
                                                  const SetOfFacts& pSetOfFact) const
 {
   if (nodeType == WorldStateModificationNodeType::AND)
@@ -361,7 +420,7 @@ bool WorldStateModificationNode::forAllUntilTrue(const std::function<bool (const
 }
 
 
-bool WorldStateModificationNode::canSatisfyObjective(const std::function<bool (const FactOptional&, std::map<Parameter, std::set<Entity>>*, const std::function<bool (const std::map<Parameter, std::set<Entity>>&)>&)>& pFactCallback,
+bool WorldStateModificationNode::canSatisfyObjective(FunctionRef<bool (const FactOptional&, std::map<Parameter, std::set<Entity>>*, FunctionRef<bool (const std::map<Parameter, std::set<Entity>>&)>)> pFactCallback,
                                                      std::map<Parameter, std::set<Entity>>& pParameters,
                                                      const WorldState& pWorldState,
                                                      const std::string& pFromDeductionId) const
@@ -445,7 +504,7 @@ bool WorldStateModificationNode::canSatisfyObjective(const std::function<bool (c
 }
 
 
-bool WorldStateModificationNode::iterateOnSuccessions(const std::function<bool (const Successions&, const FactOptional&, std::map<Parameter, std::set<Entity>>*, const std::function<bool (const std::map<Parameter, std::set<Entity>>&)>&)>& pCallback,
+bool WorldStateModificationNode::iterateOnSuccessions(FunctionRef<bool (const Successions&, const FactOptional&, std::map<Parameter, std::set<Entity>>*, FunctionRef<bool (const std::map<Parameter, std::set<Entity>>&)>)> pCallback,
                                                       std::map<Parameter, std::set<Entity>>& pParameters,
                                                       const WorldState& pWorldState,
                                                       bool pCanSatisfyThisGoal,
@@ -659,25 +718,26 @@ bool WorldStateModificationNode::operator==(const WorldStateModification& pOther
 }
 
 
-std::optional<Entity> WorldStateModificationNode::getFluent(const SetOfFacts& pSetOfFact) const
+std::optional<Entity> WorldStateModificationNode::getFluent(const SetOfFacts& pSetOfFact,
+                                                            const std::map<Parameter, Entity>* pParametersPtr) const
 {
   if (nodeType == WorldStateModificationNodeType::PLUS)
   {
-    auto leftValue = leftOperand->getFluent(pSetOfFact);
-    auto rightValue = rightOperand->getFluent(pSetOfFact);
+    auto leftValue = leftOperand->getFluent(pSetOfFact, pParametersPtr);
+    auto rightValue = rightOperand->getFluent(pSetOfFact, pParametersPtr);
     return plusIntOrStr(leftValue, rightValue);
   }
   if (nodeType == WorldStateModificationNodeType::MINUS)
   {
-    auto leftValue = leftOperand->getFluent(pSetOfFact);
-    auto rightValue = rightOperand->getFluent(pSetOfFact);
+    auto leftValue = leftOperand->getFluent(pSetOfFact, pParametersPtr);
+    auto rightValue = rightOperand->getFluent(pSetOfFact, pParametersPtr);
     return minusIntOrStr(leftValue, rightValue);
   }
   return {};
 }
 
 
-void WorldStateModificationNode::_forAllInstruction(const std::function<void (const WorldStateModification &)>& pCallback,
+void WorldStateModificationNode::_forAllInstruction(FunctionRef<void (const WorldStateModification &)> pCallback,
                                                     const SetOfFacts& pSetOfFact) const
 {
   if (leftOperand && rightOperand && parameterOpt)
@@ -742,9 +802,24 @@ bool WorldStateModificationFact::operator==(const WorldStateModification& pOther
       factOptional == otherFactPtr->factOptional;
 }
 
-std::optional<Entity> WorldStateModificationFact::getFluent(const SetOfFacts& pSetOfFact) const
+void WorldStateModificationFact::forAll(FunctionRef<void (const FactOptional&)> pFactCallback,
+                                        const SetOfFacts&,
+                                        const std::map<Parameter, Entity>* pParametersPtr,
+                                        WorldStateModificationScratch* pScratchPtr) const
+{
+  if (pParametersPtr == nullptr || pParametersPtr->empty())
+    return pFactCallback(factOptional);
+  if (pScratchPtr != nullptr)
+    return pFactCallback(_factOptionalWithParameters(*pScratchPtr, factOptional, pParametersPtr));
+  pFactCallback(_factOptionalWithParameters(factOptional, pParametersPtr));
+}
+
+std::optional<Entity> WorldStateModificationFact::getFluent(const SetOfFacts& pSetOfFact,
+                                                            const std::map<Parameter, Entity>* pParametersPtr) const
 {
-  return pSetOfFact.getFactFluent(factOptional.fact);
+  if (pParametersPtr == nullptr || pParametersPtr->empty())
+    return pSetOfFact.getFactFluent(factOptional.fact);
+  return pSetOfFact.getFactFluent(_factOptionalWithParameters(factOptional, pParametersPtr).fact);
 }
 
 bool WorldStateModificationFact::hasAContradictionWith(const std::set<FactOptional>& pFactsOpt,
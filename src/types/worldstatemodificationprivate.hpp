@@ -82,20 +82,22 @@ struct WorldStateModificationNode : public WorldStateModification
       rightOperand->replaceArgument(pOldFact, pNewFact);
   }
 
-  void forAll(const std::function<void (const FactOptional&)>& pFactCallback,
-              const SetOfFacts& pSetOfFact) const override;
+  void forAll(FunctionRef<void (const FactOptional&)> pFactCallback,
+              const SetOfFacts& pSetOfFact,
+              const std::map<Parameter, Entity>* pParametersPtr,
+              WorldStateModificationScratch* pScratchPtr) const override;
 
-  ContinueOrBreak forAllThatCanBeModified(const std::function<ContinueOrBreak (const FactOptional&)>& pFactCallback) const override;
+  ContinueOrBreak forAllThatCanBeModified(FunctionRef<ContinueOrBreak (const FactOptional&)> pFactCallback) const override;
 
-  void iterateOverAllAccessibleFacts(const std::function<void (const FactOptional&)>& pFactCallback,
+  void iterateOverAllAccessibleFacts(FunctionRef<void (const FactOptional&)> pFactCallback,
                                      const SetOfFacts& pSetOfFact) const;
-  bool forAllUntilTrue(const std::function<bool (const FactOptional&)>& pFactCallback,
+  bool forAllUntilTrue(FunctionRef<bool (const FactOptional&)> pFactCallback,
                        const SetOfFacts& pSetOfFact) const override;
-  bool canSatisfyObjective(const std::function<bool (const FactOptional&, std::map<Parameter, std::set<Entity>>*, const std::function<bool (const std::map<Parameter, std::set<Entity>>&)>&)>& pFactCallback,
+  bool canSatisfyObjective(FunctionRef<bool (const FactOptional&, std::map<Parameter, std::set<Entity>>*, FunctionRef<bool (const std::map<Parameter, std::set<Entity>>&)>)> pFactCallback,
                            std::map<Parameter, std::set<Entity>>& pParameters,
                            const WorldState& pWorldState,
                            const std::string& pFromDeductionId) const override;
-  bool iterateOnSuccessions(const std::function<bool (const Successions&, const FactOptional&, std::map<Parameter, std::set<Entity>>*, const std::function<bool (const std::map<Parameter, std::set<Entity>>&)>&)>& pCallback,
+  bool iterateOnSuccessions(FunctionRef<bool (const Successions&, const FactOptional&, std::map<Parameter, std::set<Entity>>*, FunctionRef<bool (const std::map<Parameter, std::set<Entity>>&)>)> pCallback,
                             std::map<Parameter, std::set<Entity>>& pParameters,
                             const WorldState& pWorldState,
                             bool pCanSatisfyThisGoal,
@@ -109,7 +111,8 @@ struct WorldStateModificationNode : public WorldStateModification
 
   bool operator==(const WorldStateModification& pOther) const override;
 
-  std::optional<Entity> getFluent(const SetOfFacts& pSetOfFact) const override;
+  std::optional<Entity> getFluent(const SetOfFacts& pSetOfFact,
+                                  const std::map<Parameter, Entity>* pParametersPtr) const override;
 
   const FactOptional* getOptionalFact() const override
   {
@@ -136,10 +139,14 @@ struct WorldStateModificationNode : public WorldStateModification
   std::unique_ptr<WorldStateModification> rightOperand;
   std::optional<Parameter> parameterOpt;
 
+  /// Successions cache of this modification, for example to write it in a binary snapshot.
+  const Successions& successions() const { return _successions; }
+  void setSuccessions(const Successions& pSuccessions) { _successions = pSuccessions; }
+
 private:
   Successions _successions;
 
-  void _forAllInstruction(const std::function<void (const WorldStateModification&)>& pCallback,
+  void _forAllInstruction(FunctionRef<void (const WorldStateModification&)> pCallback,
                           const SetOfFacts& pSetOfFact) const;
 };
 
@@ -172,21 +179,23 @@ struct WorldStateModificationFact : public WorldStateModification
     factOptional.fact.replaceArgument(pOld, pNew);
   }
 
-  void forAll(const std::function<void (const FactOptional&)>& pFactCallback,
-              const SetOfFacts&) const override { pFactCallback(factOptional); }
+  void forAll(FunctionRef<void (const FactOptional&)> pFactCallback,
+              const SetOfFacts&,
+              const std::map<Parameter, Entity>* pParametersPtr,
+              WorldStateModificationScratch* pScratchPtr) const override;
 
-  ContinueOrBreak forAllThatCanBeModified(const std::function<ContinueOrBreak (const FactOptional&)>& pFactCallback) const override { return pFactCallback(factOptional); }
+  ContinueOrBreak forAllThatCanBeModified(FunctionRef<ContinueOrBreak (const FactOptional&)> pFactCallback) const override { return pFactCallback(factOptional); }
 
-  void iterateOverAllAccessibleFacts(const std::function<void (const FactOptional&)>& pFactCallback,
+  void iterateOverAllAccessibleFacts(FunctionRef<void (const FactOptional&)> pFactCallback,
                                      const SetOfFacts&) const override { pFactCallback(factOptional); }
 
 
-  bool forAllUntilTrue(const std::function<bool (const FactOptional&)>& pFactCallback, const SetOfFacts&) const override
+  bool forAllUntilTrue(FunctionRef<bool (const FactOptional&)> pFactCallback, const SetOfFacts&) const override
   {
     return pFactCallback(factOptional);
   }
 
-  bool canSatisfyObjective(const std::function<bool (const FactOptional&, std::map<Parameter, std::set<Entity>>*, const std::function<bool (const std::map<Parameter, std::set<Entity>>&)>&)>& pFactCallback,
+  bool canSatisfyObjective(FunctionRef<bool (const FactOptional&, std::map<Parameter, std::set<Entity>>*, FunctionRef<bool (const std::map<Parameter, std::set<Entity>>&)>)> pFactCallback,
                            std::map<Parameter, std::set<Entity>>&,
                            const WorldState&,
                            const std::string&) const override
@@ -194,7 +203,7 @@ struct WorldStateModificationFact : public WorldStateModification
     return pFactCallback(factOptional, nullptr, [](const std::map<Parameter, std::set<Entity>>&){ return true; });
   }
 
-  bool iterateOnSuccessions(const std::function<bool (const Successions&, const FactOptional&, std::map<Parameter, std::set<Entity>>*, const std::function<bool (const std::map<Parameter, std::set<Entity>>&)>&)>& pCallback,
+  bool iterateOnSuccessions(FunctionRef<bool (const Successions&, const FactOptional&, std::map<Parameter, std::set<Entity>>*, FunctionRef<bool (const std::map<Parameter, std::set<Entity>>&)>)> pCallback,
                             std::map<Parameter, std::set<Entity>>&,
                             const WorldState&,
                             bool pCanSatisfyThisGoal,
@@ -230,7 +239,8 @@ struct WorldStateModificationFact : public WorldStateModification
 
   bool operator==(const WorldStateModification& pOther) const override;
 
-  std::optional<Entity> getFluent(const SetOfFacts& pSetOfFact) const override;
+  std::optional<Entity> getFluent(const SetOfFacts& pSetOfFact,
+                                  const std::map<Parameter, Entity>* pParametersPtr) const override;
 
   const FactOptional* getOptionalFact() const override
   {
@@ -243,7 +253,7 @@ struct WorldStateModificationFact : public WorldStateModification
     if (pParametersToArgumentPtr != nullptr)
       res->factOptional.fact.replaceArguments(*pParametersToArgumentPtr);
     res->_successions = _successions;
-    return res;    return res;
+    return res;
   }
 
   bool hasAContradictionWith(const std::set<FactOptional>& pFactsOpt,
@@ -251,6 +261,10 @@ struct WorldStateModificationFact : public WorldStateModification
 
   FactOptional factOptional;
 
+  /// Successions cache of this modification, for example to write it in a binary snapshot.
+  const Successions& successions() const { return _successions; }
+  void setSuccessions(const Successions& pSuccessions) { _successions = pSuccessions; }
+
 private:
   Successions _successions;
 };
@@ -275,18 +289,20 @@ struct WorldStateModificationNumber : public WorldStateModification
 
   void replaceArgument(const Entity&,
                        const Entity&) override {}
-  void forAll(const std::function<void (const FactOptional&)>&,
-              const SetOfFacts&) const override {}
-  ContinueOrBreak forAllThatCanBeModified(const std::function<ContinueOrBreak (const FactOptional&)>&) const override { return ContinueOrBreak::CONTINUE; }
-  void iterateOverAllAccessibleFacts(const std::function<void (const FactOptional&)>&,
+  void forAll(FunctionRef<void (const FactOptional&)>,
+              const SetOfFacts&,
+              const std::map<Parameter, Entity>*,
+              WorldStateModificationScratch*) const override {}
+  ContinueOrBreak forAllThatCanBeModified(FunctionRef<ContinueOrBreak (const FactOptional&)>) const override { return ContinueOrBreak::CONTINUE; }
+  void iterateOverAllAccessibleFacts(FunctionRef<void (const FactOptional&)>,
                                      const SetOfFacts&) const override {}
-  bool forAllUntilTrue(const std::function<bool (const FactOptional&)>&,
+  bool forAllUntilTrue(FunctionRef<bool (const FactOptional&)>,
                        const SetOfFacts&) const override { return false; }
-  bool canSatisfyObjective(const std::function<bool (const FactOptional&, std::map<Parameter, std::set<Entity>>*, const std::function<bool (const std::map<Parameter, std::set<Entity>>&)>&)>&,
+  bool canSatisfyObjective(FunctionRef<bool (const FactOptional&, std::map<Parameter, std::set<Entity>>*, FunctionRef<bool (const std::map<Parameter, std::set<Entity>>&)>)>,
                            std::map<Parameter, std::set<Entity>>&,
                            const WorldState&,
                            const std::string&) const override { return false; }
-  bool iterateOnSuccessions(const std::function<bool (const Successions&, const FactOptional&, std::map<Parameter, std::set<Entity>>*, const std::function<bool (const std::map<Parameter, std::set<Entity>>&)>&)>&,
+  bool iterateOnSuccessions(FunctionRef<bool (const Successions&, const FactOptional&, std::map<Parameter, std::set<Entity>>*, FunctionRef<bool (const std::map<Parameter, std::set<Entity>>&)>)>,
                             std::map<Parameter, std::set<Entity>>&,
                             const WorldState&,
                             bool,
@@ -300,9 +316,10 @@ struct WorldStateModificationNumber : public WorldStateModification
 
   bool operator==(const WorldStateModification& pOther) const override;
 
-  std::optional<Entity> getFluent(const SetOfFacts&) const override
+  std::optional<Entity> getFluent(const SetOfFacts&,
+                                  const std::map<Parameter, Entity>*) const override
   {
-    return Entity::createNumberEntity(toStr(true));
+    return Entity::createNumberEntity(_nb);
   }
 
   const FactOptional* getOptionalFact() const override
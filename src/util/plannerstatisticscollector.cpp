@@ -0,0 +1,75 @@
+#include "plannerstatisticscollector.hpp"
+#include <algorithm>
+
+namespace ogp
+{
+namespace
+{
+thread_local PlannerStatistics* _currentStatisticsPtr = nullptr;
+/// Phases currently measured, to not count twice the time of the recursive calls.
+thread_local std::vector<std::chrono::nanoseconds PlannerStatistics::*> _activePhases;
+}
+
+
+PlannerStatisticsCollector::PlannerStatisticsCollector(PlannerStatistics* pStatisticsPtr)
+  : _statisticsPtr(pStatisticsPtr),
+    _previousStatisticsPtr(_currentStatisticsPtr),
+    _nestedStatistics()
+{
+  if (_statisticsPtr == nullptr)
+    return;
+  // When nested, collect from zero so that what pStatisticsPtr already held is not added again to the previous collector
+  if (_previousStatisticsPtr != nullptr && _previousStatisticsPtr != _statisticsPtr)
+    _currentStatisticsPtr = &_nestedStatistics;
+  else
+    _currentStatisticsPtr = _statisticsPtr;
+}
+
+
+PlannerStatisticsCollector::~PlannerStatisticsCollector()
+{
+  if (_statisticsPtr == nullptr)
+    return;
+  _currentStatisticsPtr = _previousStatisticsPtr;
+  if (_previousStatisticsPtr != nullptr && _previousStatisticsPtr != _statisticsPtr)
+  {
+    _statisticsPtr->add(_nestedStatistics);
+    _previousStatisticsPtr->add(_nestedStatistics);
+  }
+}
+
+
+PlannerStatistics* PlannerStatisticsCollector::current()
+{
+  return _currentStatisticsPtr;
+}
+
+
+
+PlannerPhaseTimer::PlannerPhaseTimer(std::chrono::nanoseconds PlannerStatistics::* pDurationMember)
+  : _statisticsPtr(_currentStatisticsPtr),
+    _durationMember(pDurationMember),
+    _begin()
+{
+  if (_statisticsPtr == nullptr)
+    return;
+  if (std::find(_activePhases.begin(), _activePhases.end(), pDurationMember) != _activePhases.end())
+  {
+    _statisticsPtr = nullptr;
+    return;
+  }
+  _activePhases.push_back(pDurationMember);
+  _begin = std::chrono::steady_clock::now();
+}
+
+
+PlannerPhaseTimer::~PlannerPhaseTimer()
+{
+  if (_statisticsPtr == nullptr)
+    return;
+  _statisticsPtr->*_durationMember += std::chrono::steady_clock::now() - _begin;
+  _activePhases.erase(std::find(_activePhases.begin(), _activePhases.end(), _durationMember));
+}
+
+
+} // End of namespace ogp
@@ -0,0 +1,81 @@
+#ifndef ORDEREDGOALSPLANNER_SRC_UTIL_PLANNERSTATISTICSCOLLECTOR_HPP
+#define ORDEREDGOALSPLANNER_SRC_UTIL_PLANNERSTATISTICSCOLLECTOR_HPP
+
+#include <chrono>
+#include <vector>
+#include <orderedgoalsplanner/types/plannerstatistics.hpp>
+
+namespace ogp
+{
+
+/**
+ * @brief Make the planner functions of the current thread fill some statistics until this object is destroyed.<br/>
+ * If a collector was already active, it is restored at destruction and only the statistics collected during the life
+ * of this object are added to it, not the ones that pStatisticsPtr already held.
+ */
+class PlannerStatisticsCollector
+{
+public:
+  /**
+   * @brief Construct a collector.
+   * @param[in, out] pStatisticsPtr Statistics to fill. Nothing is collected if it is null.
+   */
+  PlannerStatisticsCollector(PlannerStatistics* pStatisticsPtr);
+  ~PlannerStatisticsCollector();
+  PlannerStatisticsCollector(const PlannerStatisticsCollector&) = delete;
+  PlannerStatisticsCollector& operator=(const PlannerStatisticsCollector&) = delete;
+
+  /// Get the statistics to fill in the current thread or null if nothing is collected.
+  static PlannerStatistics* current();
+
+private:
+  PlannerStatistics* _statisticsPtr;
+  PlannerStatistics* _previousStatisticsPtr;
+  /// Statistics collected while another collector is active, added to both collectors at destruction.
+  PlannerStatistics _nestedStatistics;
+};
+
+
+/// Add the time spent in the current scope to a duration of the current statistics.
+class PlannerPhaseTimer
+{
+public:
+  PlannerPhaseTimer(std::chrono::nanoseconds PlannerStatistics::* pDurationMember);
+  ~PlannerPhaseTimer();
+  PlannerPhaseTimer(const PlannerPhaseTimer&) = delete;
+  PlannerPhaseTimer& operator=(const PlannerPhaseTimer&) = delete;
+
+private:
+  /// Null if the phase is not measured by this object (no collector or phase already measured by a caller).
+  PlannerStatistics* _statisticsPtr;
+  std::chrono::nanoseconds PlannerStatistics::* _durationMember;
+  std::chrono::steady_clock::time_point _begin;
+};
+
+} // End of namespace ogp
+
+
+#define ORDEREDGOALSPLANNER_STATISTICS_CONCAT_IMPL(pA, pB) pA##pB
+#define ORDEREDGOALSPLANNER_STATISTICS_CONCAT(pA, pB) ORDEREDGOALSPLANNER_STATISTICS_CONCAT_IMPL(pA, pB)
+
+#ifdef ORDEREDGOALSPLANNER_STATISTICS
+/// Increment a counter of the current statistics.
+# define ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(pCounter)                      \
+  do {                                                                           \
+    if (auto* ogpStatisticsPtr = ::ogp::PlannerStatisticsCollector::current())   \
+      ++ogpStatisticsPtr->pCounter;                                              \
+  } while (false)
+/// Measure the time spent until the end of the current scope.
+# define ORDEREDGOALSPLANNER_STATISTICS_PHASE_TIMER(pDuration)                   \
+  ::ogp::PlannerPhaseTimer ORDEREDGOALSPLANNER_STATISTICS_CONCAT(ogpPhaseTimer, __LINE__)(&::ogp::PlannerStatistics::pDuration)
+/// Collect the statistics in pStatisticsPtr until the end of the current scope.
+# define ORDEREDGOALSPLANNER_STATISTICS_COLLECTOR(pStatisticsPtr)               \
+  ::ogp::PlannerStatisticsCollector ORDEREDGOALSPLANNER_STATISTICS_CONCAT(ogpStatisticsCollector, __LINE__)(pStatisticsPtr)
+#else
+# define ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(pCounter) do {} while (false)
+# define ORDEREDGOALSPLANNER_STATISTICS_PHASE_TIMER(pDuration) do {} while (false)
+# define ORDEREDGOALSPLANNER_STATISTICS_COLLECTOR(pStatisticsPtr) do {} while (false)
+#endif
+
+
+#endif // ORDEREDGOALSPLANNER_SRC_UTIL_PLANNERSTATISTICSCOLLECTOR_HPP
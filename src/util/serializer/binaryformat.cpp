@@ -0,0 +1,245 @@
+#include "binaryformat.hpp"
+#include <cstring>
+#include <stdexcept>
+#include <orderedgoalsplanner/types/fact.hpp>
+#include <orderedgoalsplanner/types/goal.hpp>
+#include <orderedgoalsplanner/types/ontology.hpp>
+#include <orderedgoalsplanner/util/serializer/deserializefrompddl.hpp>
+#include <orderedgoalsplanner/util/serializer/serializeinpddl.hpp>
+
+namespace ogp
+{
+
+const std::string binarySnapshotMagic = "OGPB";
+const std::uint32_t binarySnapshotVersion = 1;
+const std::string binaryDomainSnapshotMagic = "OGPM";
+const std::uint32_t binaryDomainSnapshotVersion = 1;
+
+
+BinaryWriter::BinaryWriter(std::string& pOutput)
+  : _output(pOutput)
+{
+}
+
+void BinaryWriter::writeUint8(std::uint8_t pValue)
+{
+  _output += static_cast<char>(pValue);
+}
+
+void BinaryWriter::writeUint32(std::uint32_t pValue)
+{
+  for (std::size_t i = 0; i < 4; ++i)
+    _output += static_cast<char>((pValue >> (8 * i)) & 0xFF);
+}
+
+void BinaryWriter::writeInt32(std::int32_t pValue)
+{
+  writeUint32(static_cast<std::uint32_t>(pValue));
+}
+
+void BinaryWriter::writeInt64(std::int64_t pValue)
+{
+  auto value = static_cast<std::uint64_t>(pValue);
+  writeUint32(static_cast<std::uint32_t>(value & 0xFFFFFFFF));
+  writeUint32(static_cast<std::uint32_t>(value >> 32));
+}
+
+void BinaryWriter::writeBool(bool pValue)
+{
+  _output += pValue ? '\1' : '\0';
+}
+
+void BinaryWriter::writeFloat(float pValue)
+{
+  static_assert(sizeof(float) == sizeof(std::uint32_t), "The floats are written as 32 bits integers");
+  std::uint32_t value = 0;
+  std::memcpy(&value, &pValue, sizeof(value));
+  writeUint32(value);
+}
+
+void BinaryWriter::writeString(const std::string& pValue)
+{
+  writeUint32(static_cast<std::uint32_t>(pValue.size()));
+  _output += pValue;
+}
+
+
+BinaryReader::BinaryReader(const std::string& pInput,
+                           std::size_t pBeginPos)
+  : _input(pInput),
+    _pos(pBeginPos)
+{
+}
+
+std::uint8_t BinaryReader::readUint8()
+{
+  _checkRemainingSize(1);
+  return static_cast<std::uint8_t>(_input[_pos++]);
+}
+
+std::uint32_t BinaryReader::readUint32()
+{
+  _checkRemainingSize(4);
+  std::uint32_t res = 0;
+  for (std::size_t i = 0; i < 4; ++i)
+    res |= static_cast<std::uint32_t>(static_cast<unsigned char>(_input[_pos++])) << (8 * i);
+  return res;
+}
+
+std::int32_t BinaryReader::readInt32()
+{
+  return static_cast<std::int32_t>(readUint32());
+}
+
+std::int64_t BinaryReader::readInt64()
+{
+  std::uint64_t res = readUint32();
+  res |= static_cast<std::uint64_t>(readUint32()) << 32;
+  return static_cast<std::int64_t>(res);
+}
+
+bool BinaryReader::readBool()
+{
+  _checkRemainingSize(1);
+  return _input[_pos++] != '\0';
+}
+
+float BinaryReader::readFloat()
+{
+  auto value = readUint32();
+  float res = 0;
+  std::memcpy(&res, &value, sizeof(res));
+  return res;
+}
+
+std::string BinaryReader::readString()
+{
+  auto size = readUint32();
+  _checkRemainingSize(size);
+  auto res = _input.substr(_pos, size);
+  _pos += size;
+  return res;
+}
+
+std::uint32_t BinaryReader::readCount(std::size_t pMinNbOfBytesPerElement)
+{
+  auto res = readUint32();
+  _checkRemainingSize(static_cast<std::size_t>(res) * pMinNbOfBytesPerElement);
+  return res;
+}
+
+void BinaryReader::_checkRemainingSize(std::size_t pSize) const
+{
+  if (_pos + pSize > _input.size())
+    throw std::runtime_error("The binary snapshot is truncated");
+}
+
+
+std::uint32_t SymbolTableWriter::getId(const std::string& pSymbol)
+{
+  auto it = _symbolToId.find(pSymbol);
+  if (it != _symbolToId.end())
+    return it->second;
+  auto res = static_cast<std::uint32_t>(_symbols.size());
+  _symbols.emplace_back(pSymbol);
+  _symbolToId.emplace(pSymbol, res);
+  return res;
+}
+
+
+void writeFactsInBinary(BinaryWriter& pWriter,
+                        const std::vector<const Fact*>& pFacts)
+{
+  pWriter.writeUint32(static_cast<std::uint32_t>(pFacts.size()));
+  for (const auto* currFactPtr : pFacts)
+  {
+    const Fact& fact = *currFactPtr;
+    pWriter.writeString(fact.name());
+    pWriter.writeUint32(static_cast<std::uint32_t>(fact.arguments().size()));
+    for (const auto& currArg : fact.arguments())
+      pWriter.writeString(currArg.value);
+    pWriter.writeBool(fact.fluent().has_value());
+    if (fact.fluent())
+      pWriter.writeString(fact.fluent()->value);
+    pWriter.writeBool(fact.isValueNegated());
+  }
+}
+
+
+std::vector<Fact> readFactsFromBinary(BinaryReader& pReader,
+                                      const Ontology& pOntology,
+                                      const SetOfEntities& pEntities)
+{
+  std::vector<Fact> res;
+  // A fact has at least its name, its number of arguments and two booleans
+  auto nbOfFacts = pReader.readCount(10);
+  res.reserve(nbOfFacts);
+  std::vector<std::string> argumentStrs;
+  for (std::uint32_t i = 0; i < nbOfFacts; ++i)
+  {
+    auto name = pReader.readString();
+    auto nbOfArguments = pReader.readUint32();
+    argumentStrs.clear();
+    for (std::uint32_t j = 0; j < nbOfArguments; ++j)
+      argumentStrs.emplace_back(pReader.readString());
+    std::string fluentStr;
+    if (pReader.readBool())
+      fluentStr = pReader.readString();
+    bool isFluentNegated = pReader.readBool();
+    res.emplace_back(name, argumentStrs, fluentStr, isFluentNegated, pOntology, pEntities, std::vector<Parameter>());
+  }
+  return res;
+}
+
+
+void writeGoalsInBinary(BinaryWriter& pWriter,
+                        const std::map<int, std::vector<Goal>>& pGoals)
+{
+  pWriter.writeUint32(static_cast<std::uint32_t>(pGoals.size()));
+  for (const auto& currPriorityToGoals : pGoals)
+  {
+    pWriter.writeInt32(currPriorityToGoals.first);
+    pWriter.writeUint32(static_cast<std::uint32_t>(currPriorityToGoals.second.size()));
+    for (const auto& currGoal : currPriorityToGoals.second)
+    {
+      pWriter.writeString(conditionToPddl(currGoal.objective(), 0));
+      pWriter.writeBool(currGoal.isPersistent());
+      pWriter.writeBool(currGoal.isOneStepTowards());
+      pWriter.writeInt32(currGoal.getMaxTimeToKeepInactive());
+      pWriter.writeString(currGoal.getGoalGroupId());
+    }
+  }
+}
+
+
+std::map<int, std::vector<Goal>> readGoalsFromBinary(BinaryReader& pReader,
+                                                     const Ontology& pOntology,
+                                                     const SetOfEntities& pEntities)
+{
+  std::map<int, std::vector<Goal>> res;
+  auto nbOfPriorities = pReader.readUint32();
+  for (std::uint32_t i = 0; i < nbOfPriorities; ++i)
+  {
+    auto priority = pReader.readInt32();
+    auto& goals = res[priority];
+    auto nbOfGoals = pReader.readUint32();
+    for (std::uint32_t j = 0; j < nbOfGoals; ++j)
+    {
+      auto objectiveStr = pReader.readString();
+      bool isPersistent = pReader.readBool();
+      bool oneStepTowards = pReader.readBool();
+      auto maxTimeToKeepInactive = pReader.readInt32();
+      auto goalGroupId = pReader.readString();
+
+      std::size_t pos = 0;
+      auto objective = pddlToCondition(objectiveStr, pos, pOntology, pEntities, {});
+      if (!objective)
+        throw std::runtime_error("Failed to load a goal objective from binary");
+      goals.emplace_back(std::move(objective), isPersistent, oneStepTowards, maxTimeToKeepInactive, goalGroupId);
+    }
+  }
+  return res;
+}
+
+
+} // !ogp
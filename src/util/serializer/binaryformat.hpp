@@ -0,0 +1,136 @@
+#ifndef INCLUDE_ORDEREDGOALSPLANNER_SRC_UTIL_SERIALIZER_BINARYFORMAT_HPP
+#define INCLUDE_ORDEREDGOALSPLANNER_SRC_UTIL_SERIALIZER_BINARYFORMAT_HPP
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ogp
+{
+struct Fact;
+struct Goal;
+struct Ontology;
+struct SetOfEntities;
+
+/// Bytes at the beginning of every binary snapshot.
+extern const std::string binarySnapshotMagic;
+/// Version of the binary snapshot format. It has to be incremented each time the format changes.
+extern const std::uint32_t binarySnapshotVersion;
+/// Bytes at the beginning of every binary snapshot of a domain.
+extern const std::string binaryDomainSnapshotMagic;
+/// Version of the binary snapshot format of a domain. It has to be incremented each time the format changes.
+extern const std::uint32_t binaryDomainSnapshotVersion;
+
+
+/// Kind of condition written in a binary snapshot of a domain.
+enum class BinaryConditionTag : std::uint8_t
+{
+  NONE,
+  NODE,
+  EXISTS,
+  NOT,
+  FACT,
+  NUMBER
+};
+
+/// Kind of world state modification written in a binary snapshot of a domain.
+enum class BinaryWsModificationTag : std::uint8_t
+{
+  NONE,
+  NODE,
+  FACT,
+  NUMBER
+};
+
+
+/// Append values to a binary snapshot. The integers are written in little endian whatever the platform.
+class BinaryWriter
+{
+public:
+  BinaryWriter(std::string& pOutput);
+
+  void writeUint8(std::uint8_t pValue);
+  void writeUint32(std::uint32_t pValue);
+  void writeInt32(std::int32_t pValue);
+  void writeInt64(std::int64_t pValue);
+  void writeBool(bool pValue);
+  void writeFloat(float pValue);
+  void writeString(const std::string& pValue);
+
+private:
+  std::string& _output;
+};
+
+
+/// Read values of a binary snapshot. It throws a std::runtime_error if the snapshot is truncated.
+class BinaryReader
+{
+public:
+  BinaryReader(const std::string& pInput,
+               std::size_t pBeginPos = 0);
+
+  std::uint8_t readUint8();
+  std::uint32_t readUint32();
+  std::int32_t readInt32();
+  std::int64_t readInt64();
+  bool readBool();
+  float readFloat();
+  std::string readString();
+  /**
+   * @brief Read a number of elements that follow in the snapshot.<br/>
+   * The number is checked against the remaining size, so that a corrupted number cannot make allocate a huge buffer.
+   * @param[in] pMinNbOfBytesPerElement Minimal size of each element in the snapshot.
+   */
+  std::uint32_t readCount(std::size_t pMinNbOfBytesPerElement);
+  bool isAtEnd() const { return _pos >= _input.size(); }
+
+private:
+  const std::string& _input;
+  std::size_t _pos;
+
+  void _checkRemainingSize(std::size_t pSize) const;
+};
+
+
+/// Store each string once and refer to it by its index.
+class SymbolTableWriter
+{
+public:
+  std::uint32_t getId(const std::string& pSymbol);
+
+  const std::vector<std::string>& symbols() const { return _symbols; }
+
+private:
+  std::vector<std::string> _symbols;
+  std::map<std::string, std::uint32_t> _symbolToId;
+};
+
+
+/// Write facts in binary with their name, their arguments and their fluent.
+void writeFactsInBinary(BinaryWriter& pWriter,
+                        const std::vector<const Fact*>& pFacts);
+
+/// Read facts written by writeFactsInBinary.
+std::vector<Fact> readFactsFromBinary(BinaryReader& pReader,
+                                      const Ontology& pOntology,
+                                      const SetOfEntities& pEntities);
+
+
+/**
+ * @brief Write goals in binary.<br/>
+ * The goal objectives are written in PDDL because they are few and small compared to the facts.
+ */
+void writeGoalsInBinary(BinaryWriter& pWriter,
+                        const std::map<int, std::vector<Goal>>& pGoals);
+
+/// Read goals written by writeGoalsInBinary.
+std::map<int, std::vector<Goal>> readGoalsFromBinary(BinaryReader& pReader,
+                                                     const Ontology& pOntology,
+                                                     const SetOfEntities& pEntities);
+
+
+} // !ogp
+
+
+#endif // INCLUDE_ORDEREDGOALSPLANNER_SRC_UTIL_SERIALIZER_BINARYFORMAT_HPP
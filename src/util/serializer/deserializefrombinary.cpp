@@ -0,0 +1,464 @@
+#include <orderedgoalsplanner/util/serializer/deserializefrombinary.hpp>
+#include <stdexcept>
+#include <orderedgoalsplanner/types/domain.hpp>
+#include <orderedgoalsplanner/types/goal.hpp>
+#include <orderedgoalsplanner/types/problem.hpp>
+#include <orderedgoalsplanner/types/setofcallbacks.hpp>
+#include "../../types/worldstatemodificationprivate.hpp"
+#include "binaryformat.hpp"
+
+
+namespace ogp
+{
+namespace
+{
+
+const std::string& _readSymbol(BinaryReader& pReader,
+                               const std::vector<std::string>& pSymbols)
+{
+  auto id = pReader.readUint32();
+  if (id >= pSymbols.size())
+    throw std::runtime_error("Invalid symbol index in the binary snapshot");
+  return pSymbols[id];
+}
+
+
+void _readEntities(BinaryReader& pReader,
+                   const std::vector<std::string>& pSymbols,
+                   const Ontology& pOntology,
+                   SetOfEntities& pEntities)
+{
+  auto nbOfEntities = pReader.readUint32();
+  for (std::uint32_t i = 0; i < nbOfEntities; ++i)
+  {
+    const auto& value = _readSymbol(pReader, pSymbols);
+    const auto& typeName = _readSymbol(pReader, pSymbols);
+    pEntities.add(Entity(value, typeName.empty() ? std::shared_ptr<Type>() : pOntology.types.nameToType(typeName)));
+  }
+}
+
+
+std::vector<Fact> _readFacts(BinaryReader& pReader,
+                             const std::vector<std::string>& pSymbols,
+                             const Ontology& pOntology,
+                             const SetOfEntities& pEntities)
+{
+  std::vector<Fact> res;
+  // A fact has at least its name symbol, its number of arguments and two booleans
+  auto nbOfFacts = pReader.readCount(10);
+  res.reserve(nbOfFacts);
+  std::vector<std::string> argumentStrs;
+  for (std::uint32_t i = 0; i < nbOfFacts; ++i)
+  {
+    const auto& name = _readSymbol(pReader, pSymbols);
+    auto nbOfArguments = pReader.readUint32();
+    argumentStrs.clear();
+    for (std::uint32_t j = 0; j < nbOfArguments; ++j)
+      argumentStrs.emplace_back(_readSymbol(pReader, pSymbols));
+    std::string fluentStr;
+    if (pReader.readBool())
+      fluentStr = _readSymbol(pReader, pSymbols);
+    bool isFluentNegated = pReader.readBool();
+    res.emplace_back(name, argumentStrs, fluentStr, isFluentNegated, pOntology, pEntities, std::vector<Parameter>());
+  }
+  return res;
+}
+
+
+std::vector<std::string> _readSymbols(BinaryReader& pReader)
+{
+  std::vector<std::string> res;
+  auto nbOfSymbols = pReader.readCount(4);
+  res.reserve(nbOfSymbols);
+  for (std::uint32_t i = 0; i < nbOfSymbols; ++i)
+    res.emplace_back(pReader.readString());
+  return res;
+}
+
+
+/// Data needed to read the content of a domain snapshot.
+struct DomainSnapshotReader
+{
+  DomainSnapshotReader(BinaryReader& pReader,
+                       const std::vector<std::string>& pSymbols,
+                       const Ontology& pOntology)
+    : reader(pReader),
+      symbols(pSymbols),
+      ontology(pOntology),
+      nameToPredicate()
+  {
+  }
+
+  const std::string& readSymbol() { return _readSymbol(reader, symbols); }
+  std::shared_ptr<Type> readType();
+  Entity readEntity();
+  std::vector<Parameter> readParameters();
+  Predicate readPredicate();
+  Fact readFact();
+  Number readNumber();
+  std::unique_ptr<Condition> readCondition();
+  Successions readSuccessions();
+  std::unique_ptr<WorldStateModification> readWsModification();
+  Goal readGoal();
+  std::map<int, std::vector<Goal>> readGoals();
+  std::set<std::string> readIds();
+
+  BinaryReader& reader;
+  const std::vector<std::string>& symbols;
+  const Ontology& ontology;
+  /// Predicates and predicates of the derived predicates to resolve the facts without looking in the ontology each time.
+  std::map<std::string, Predicate> nameToPredicate;
+};
+
+
+void _readTypes(DomainSnapshotReader& pSnapshotReader,
+                SetOfTypes& pTypes,
+                const std::string& pParentName)
+{
+  auto nbOfTypes = pSnapshotReader.reader.readUint32();
+  for (std::uint32_t i = 0; i < nbOfTypes; ++i)
+  {
+    const auto& name = pSnapshotReader.readSymbol();
+    pTypes.addType(name, pParentName);
+    _readTypes(pSnapshotReader, pTypes, name);
+  }
+}
+
+std::shared_ptr<Type> DomainSnapshotReader::readType()
+{
+  const auto& typeName = readSymbol();
+  return typeName.empty() ? std::shared_ptr<Type>() : ontology.types.nameToType(typeName);
+}
+
+Entity DomainSnapshotReader::readEntity()
+{
+  const auto& value = readSymbol();
+  return Entity(value, readType());
+}
+
+std::vector<Parameter> DomainSnapshotReader::readParameters()
+{
+  std::vector<Parameter> res;
+  // A parameter has a name symbol and a type symbol
+  auto nbOfParameters = reader.readCount(8);
+  res.reserve(nbOfParameters);
+  for (std::uint32_t i = 0; i < nbOfParameters; ++i)
+  {
+    const auto& name = readSymbol();
+    res.emplace_back(name, readType());
+  }
+  return res;
+}
+
+Predicate DomainSnapshotReader::readPredicate()
+{
+  const auto& name = readSymbol();
+  auto parameters = readParameters();
+  return Predicate(name, parameters, readType());
+}
+
+Fact DomainSnapshotReader::readFact()
+{
+  const auto& name = readSymbol();
+  auto itPredicate = nameToPredicate.find(name);
+  if (itPredicate == nameToPredicate.end())
+    throw std::runtime_error("\"" + name + "\" is not a predicate name");
+  std::vector<Entity> arguments;
+  // An entity has a value symbol and a type symbol
+  auto nbOfArguments = reader.readCount(8);
+  arguments.reserve(nbOfArguments);
+  for (std::uint32_t i = 0; i < nbOfArguments; ++i)
+    arguments.emplace_back(readEntity());
+  std::optional<Entity> fluent;
+  if (reader.readBool())
+    fluent.emplace(readEntity());
+  bool isFluentNegated = reader.readBool();
+  return Fact(itPredicate->second, std::move(arguments), std::move(fluent), isFluentNegated);
+}
+
+Number DomainSnapshotReader::readNumber()
+{
+  if (reader.readUint8() == 0)
+    return Number(reader.readInt32());
+  return Number(reader.readFloat());
+}
+
+std::unique_ptr<Condition> DomainSnapshotReader::readCondition()
+{
+  auto tag = static_cast<BinaryConditionTag>(reader.readUint8());
+  switch (tag)
+  {
+  case BinaryConditionTag::NONE:
+    return {};
+  case BinaryConditionTag::NODE:
+  {
+    auto nodeType = static_cast<ConditionNodeType>(reader.readUint8());
+    auto leftOperand = readCondition();
+    auto rightOperand = readCondition();
+    return std::make_unique<ConditionNode>(nodeType, std::move(leftOperand), std::move(rightOperand));
+  }
+  case BinaryConditionTag::EXISTS:
+  {
+    auto parameters = readParameters();
+    if (parameters.size() != 1)
+      throw std::runtime_error("An exists condition of a binary snapshot should have one parameter");
+    return std::make_unique<ConditionExists>(parameters.front(), readCondition());
+  }
+  case BinaryConditionTag::NOT:
+    return std::make_unique<ConditionNot>(readCondition());
+  case BinaryConditionTag::FACT:
+  {
+    bool isFactNegated = reader.readBool();
+    return std::make_unique<ConditionFact>(FactOptional(readFact(), isFactNegated));
+  }
+  case BinaryConditionTag::NUMBER:
+    return std::make_unique<ConditionNumber>(readNumber());
+  }
+  throw std::runtime_error("Invalid condition in the binary snapshot");
+}
+
+Successions DomainSnapshotReader::readSuccessions()
+{
+  Successions res;
+  res.actions = readIds();
+  auto nbOfSetOfEvents = reader.readUint32();
+  for (std::uint32_t i = 0; i < nbOfSetOfEvents; ++i)
+  {
+    const auto& setOfEventsId = readSymbol();
+    res.events[setOfEventsId] = readIds();
+  }
+  return res;
+}
+
+std::unique_ptr<WorldStateModification> DomainSnapshotReader::readWsModification()
+{
+  auto tag = static_cast<BinaryWsModificationTag>(reader.readUint8());
+  switch (tag)
+  {
+  case BinaryWsModificationTag::NONE:
+    return {};
+  case BinaryWsModificationTag::NODE:
+  {
+    auto nodeType = static_cast<WorldStateModificationNodeType>(reader.readUint8());
+    auto leftOperand = readWsModification();
+    auto rightOperand = readWsModification();
+    std::optional<Parameter> parameterOpt;
+    if (reader.readBool())
+    {
+      auto parameters = readParameters();
+      if (parameters.size() != 1)
+        throw std::runtime_error("A world state modification of a binary snapshot should have one parameter");
+      parameterOpt.emplace(parameters.front());
+    }
+    auto res = std::make_unique<WorldStateModificationNode>(nodeType, std::move(leftOperand), std::move(rightOperand), parameterOpt);
+    res->setSuccessions(readSuccessions());
+    return res;
+  }
+  case BinaryWsModificationTag::FACT:
+  {
+    bool isFactNegated = reader.readBool();
+    auto res = std::make_unique<WorldStateModificationFact>(FactOptional(readFact(), isFactNegated));
+    res->setSuccessions(readSuccessions());
+    return res;
+  }
+  case BinaryWsModificationTag::NUMBER:
+    return std::make_unique<WorldStateModificationNumber>(readNumber());
+  }
+  throw std::runtime_error("Invalid world state modification in the binary snapshot");
+}
+
+Goal DomainSnapshotReader::readGoal()
+{
+  auto objective = readCondition();
+  if (!objective)
+    throw std::runtime_error("Failed to load a goal objective from binary");
+  bool isPersistent = reader.readBool();
+  bool oneStepTowards = reader.readBool();
+  auto maxTimeToKeepInactive = reader.readInt32();
+  const auto& goalGroupId = readSymbol();
+  return Goal(std::move(objective), isPersistent, oneStepTowards, maxTimeToKeepInactive, goalGroupId);
+}
+
+std::map<int, std::vector<Goal>> DomainSnapshotReader::readGoals()
+{
+  std::map<int, std::vector<Goal>> res;
+  auto nbOfPriorities = reader.readUint32();
+  for (std::uint32_t i = 0; i < nbOfPriorities; ++i)
+  {
+    auto& goals = res[reader.readInt32()];
+    auto nbOfGoals = reader.readUint32();
+    for (std::uint32_t j = 0; j < nbOfGoals; ++j)
+      goals.emplace_back(readGoal());
+  }
+  return res;
+}
+
+std::set<std::string> DomainSnapshotReader::readIds()
+{
+  std::set<std::string> res;
+  auto nbOfIds = reader.readUint32();
+  for (std::uint32_t i = 0; i < nbOfIds; ++i)
+    res.insert(readSymbol());
+  return res;
+}
+
+
+void _readAction(DomainSnapshotReader& pSnapshotReader,
+                 Action& pAction)
+{
+  pAction.parameters = pSnapshotReader.readParameters();
+  pAction.precondition = pSnapshotReader.readCondition();
+  pAction.overAllCondition = pSnapshotReader.readCondition();
+  pAction.preferInContext = pSnapshotReader.readCondition();
+  pAction.effect.worldStateModification = pSnapshotReader.readWsModification();
+  pAction.effect.potentialWorldStateModification = pSnapshotReader.readWsModification();
+  pAction.effect.worldStateModificationAtStart = pSnapshotReader.readWsModification();
+  pAction.effect.goalsToAdd = pSnapshotReader.readGoals();
+  auto nbOfGoalsInCurrentPriority = pSnapshotReader.reader.readUint32();
+  for (std::uint32_t i = 0; i < nbOfGoalsInCurrentPriority; ++i)
+    pAction.effect.goalsToAddInCurrentPriority.emplace_back(pSnapshotReader.readGoal());
+  pAction.highImportanceOfNotRepeatingIt = pSnapshotReader.reader.readBool();
+  pAction.canThisActionBeUsedByThePlanner = pSnapshotReader.reader.readBool();
+  pAction.actionsSuccessionsWithoutInterestCache = pSnapshotReader.readIds();
+  pAction.actionsPredecessorsCache = pSnapshotReader.readIds();
+  pAction.eventsPredecessorsCache = pSnapshotReader.readIds();
+}
+
+
+Event _readEvent(DomainSnapshotReader& pSnapshotReader)
+{
+  auto parameters = pSnapshotReader.readParameters();
+  auto precondition = pSnapshotReader.readCondition();
+  auto factsToModify = pSnapshotReader.readWsModification();
+  auto goalsToAdd = pSnapshotReader.readGoals();
+  Event res(std::move(precondition), std::move(factsToModify), parameters, goalsToAdd);
+  res.actionsPredecessorsCache = pSnapshotReader.readIds();
+  res.eventsPredecessorsCache = pSnapshotReader.readIds();
+  return res;
+}
+
+
+void _readHistorical(BinaryReader& pReader,
+                     const std::vector<std::string>& pSymbols,
+                     Historical& pHistorical)
+{
+  auto nbOfActions = pReader.readUint32();
+  for (std::uint32_t i = 0; i < nbOfActions; ++i)
+  {
+    const auto& actionId = _readSymbol(pReader, pSymbols);
+    auto nbOfTimeAlreadyDone = pReader.readUint32();
+    for (std::uint32_t j = 0; j < nbOfTimeAlreadyDone; ++j)
+      pHistorical.notifyActionDone(actionId);
+  }
+}
+
+}
+
+
+std::unique_ptr<Domain> binaryToDomain(const std::string& pBinary)
+{
+  if (pBinary.compare(0, binaryDomainSnapshotMagic.size(), binaryDomainSnapshotMagic) != 0)
+    throw std::runtime_error("The input is not a binary snapshot of a domain");
+  BinaryReader reader(pBinary, binaryDomainSnapshotMagic.size());
+  auto version = reader.readUint32();
+  if (version != binaryDomainSnapshotVersion)
+    throw std::runtime_error("Binary snapshot version " + std::to_string(version) +
+                             " of a domain is not supported, the supported version is " + std::to_string(binaryDomainSnapshotVersion));
+
+  auto domainName = reader.readString();
+  auto symbols = _readSymbols(reader);
+  Ontology ontology;
+  DomainSnapshotReader snapshotReader(reader, symbols, ontology);
+  _readTypes(snapshotReader, ontology.types, "");
+  _readEntities(reader, symbols, ontology, ontology.constants);
+
+  auto nbOfPredicates = reader.readUint32();
+  for (std::uint32_t i = 0; i < nbOfPredicates; ++i)
+  {
+    auto predicate = snapshotReader.readPredicate();
+    ontology.predicates.addPredicate(predicate);
+    snapshotReader.nameToPredicate.emplace(predicate.name, std::move(predicate));
+  }
+  // A predicate has at least a name symbol, a number of parameters and a type symbol
+  auto nbOfDerivedPredicates = reader.readCount(12);
+  std::vector<Predicate> derivedPredicates;
+  derivedPredicates.reserve(nbOfDerivedPredicates);
+  for (std::uint32_t i = 0; i < nbOfDerivedPredicates; ++i)
+  {
+    derivedPredicates.emplace_back(snapshotReader.readPredicate());
+    snapshotReader.nameToPredicate.emplace(derivedPredicates.back().name, derivedPredicates.back());
+  }
+  for (const auto& currPredicate : derivedPredicates)
+    ontology.derivedPredicates.addDerivedPredicate(DerivedPredicate(currPredicate, snapshotReader.readCondition()));
+
+  SetOfConstFacts timelessFacts;
+  auto nbOfTimelessFacts = reader.readUint32();
+  for (std::uint32_t i = 0; i < nbOfTimelessFacts; ++i)
+    timelessFacts.add(snapshotReader.readFact());
+  auto requirements = snapshotReader.readIds();
+
+  std::map<ActionId, Action> actions;
+  auto nbOfActions = reader.readUint32();
+  for (std::uint32_t i = 0; i < nbOfActions; ++i)
+  {
+    const auto& actionId = snapshotReader.readSymbol();
+    auto& action = actions.emplace(std::piecewise_construct, std::forward_as_tuple(actionId),
+                                   std::forward_as_tuple(std::unique_ptr<Condition>(), ProblemModification())).first->second;
+    _readAction(snapshotReader, action);
+  }
+
+  std::map<SetOfEventsId, SetOfEvents> idToSetOfEvents;
+  auto nbOfSetOfEvents = reader.readUint32();
+  for (std::uint32_t i = 0; i < nbOfSetOfEvents; ++i)
+  {
+    auto& setOfEvents = idToSetOfEvents[snapshotReader.readSymbol()];
+    auto nbOfEvents = reader.readUint32();
+    for (std::uint32_t j = 0; j < nbOfEvents; ++j)
+    {
+      const auto& eventId = snapshotReader.readSymbol();
+      setOfEvents.add(_readEvent(snapshotReader), eventId);
+    }
+  }
+
+  return Domain::fromPreparedContent(std::move(actions), std::move(ontology), std::move(idToSetOfEvents),
+                                     std::move(timelessFacts), domainName, requirements);
+}
+
+
+std::unique_ptr<Problem> binaryToProblem(const std::string& pBinary,
+                                         const Domain& pDomain)
+{
+  if (pBinary.compare(0, binarySnapshotMagic.size(), binarySnapshotMagic) != 0)
+    throw std::runtime_error("The input is not a binary snapshot");
+  BinaryReader reader(pBinary, binarySnapshotMagic.size());
+  auto version = reader.readUint32();
+  if (version != binarySnapshotVersion)
+    throw std::runtime_error("Binary snapshot version " + std::to_string(version) +
+                             " is not supported, the supported version is " + std::to_string(binarySnapshotVersion));
+
+  auto problemName = reader.readString();
+  auto domainName = reader.readString();
+  if (domainName != pDomain.getName())
+    throw std::runtime_error("The problem is for the domain \"" + domainName + "\" and not for \"" + pDomain.getName() + "\"");
+  auto res = std::make_unique<Problem>(&pDomain.getTimelessFacts().setOfFacts());
+  auto& problem = *res;
+  problem.name = problemName;
+
+  auto symbols = _readSymbols(reader);
+  const auto& ontology = pDomain.getOntology();
+  _readEntities(reader, symbols, ontology, problem.entities);
+
+  auto facts = _readFacts(reader, symbols, ontology, problem.entities);
+  const SetOfCallbacks callbacks;
+  problem.worldState.addFacts(facts, problem.goalStack, pDomain.getSetOfEvents(), callbacks,
+                              ontology, problem.entities, {});
+
+  auto goals = readGoalsFromBinary(reader, ontology, problem.entities);
+  problem.goalStack.addGoals(goals, problem.worldState, ontology.constants, problem.entities, {});
+
+  _readHistorical(reader, symbols, problem.historical);
+  return res;
+}
+
+
+} // !ogp
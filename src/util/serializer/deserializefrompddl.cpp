@@ -1,7 +1,10 @@
 #include <orderedgoalsplanner/util/serializer/deserializefrompddl.hpp>
 #include <memory>
+#include <optional>
+#include <sstream>
 #include <orderedgoalsplanner/types/axiom.hpp>
 #include <orderedgoalsplanner/types/domain.hpp>
+#include <orderedgoalsplanner/types/parallelplan.hpp>
 #include <orderedgoalsplanner/types/problem.hpp>
 #include <orderedgoalsplanner/types/setofcallbacks.hpp>
 #include "../../types/expressionParsed.hpp"
@@ -274,12 +277,12 @@ std::unique_ptr<Goal> _expressionParsedToGoal(ExpressionParsed& pExpressionParse
   if (pExpressionParsed.name == "persist" && pExpressionParsed.arguments.size() == 1)
   {
     isPersistentIfSkipped = true;
-    pExpressionParsed = pExpressionParsed.arguments.front().clone();
+    pExpressionParsed.replaceByItsOnlyArgument();
   }
   if (pExpressionParsed.name == "oneStepTowards" && pExpressionParsed.arguments.size() == 1)
   {
     oneStepTowards = true;
-    pExpressionParsed = pExpressionParsed.arguments.front().clone();
+    pExpressionParsed.replaceByItsOnlyArgument();
   }
 
   auto objective = _expressionParsedToCondition(pExpressionParsed, pOntology, pEntities, {}, false);
@@ -603,11 +606,7 @@ ExpressionParsed _extractConditionPart(const ExpressionParsed& pInput,
       return std::move(newArguments.front());
     if (newArguments.size() > 1)
     {
-      auto res = pInput.clone();
-      res.arguments.clear();
-      for (const auto& arg : newArguments)
-         res.arguments.emplace_back(arg.clone());
-      return res;
+      return pInput.cloneWithArguments(std::move(newArguments));
     }
     return ExpressionParsed();
   }
@@ -651,11 +650,7 @@ ExpressionParsed _extractWsModificationPart(const ExpressionParsed& pInput,
       return std::move(newArguments.front());
     if (newArguments.size() > 1)
     {
-      auto res = pInput.clone();
-      res.arguments.clear();
-      for (const auto& arg : newArguments)
-         res.arguments.emplace_back(arg.clone());
-      return res;
+      return pInput.cloneWithArguments(std::move(newArguments));
     }
     return ExpressionParsed();
   }
@@ -1209,5 +1204,60 @@ std::vector<Parameter> pddlToParameters(const std::string& pStr,
 }
 
 
+ParallelPan pddlToParallelPlan(const std::string& pStr,
+                               const Domain& pDomain,
+                               const SetOfEntities& pEntities)
+{
+  ParallelPan res;
+  const auto& constants = pDomain.getOntology().constants;
+  std::optional<std::string> previousStepIndex;
+  std::istringstream stream(pStr);
+  std::string line;
+  while (std::getline(stream, line))
+  {
+    auto beginOfAction = line.find('(');
+    auto endOfAction = line.find(')', beginOfAction);
+    if (line.empty() || line[0] == ';' || beginOfAction == std::string::npos || endOfAction == std::string::npos)
+      continue;
+
+    std::optional<std::string> stepIndex;
+    auto endOfStepIndex = line.find(':');
+    if (endOfStepIndex != std::string::npos && endOfStepIndex < beginOfAction)
+      stepIndex = line.substr(0, endOfStepIndex);
+
+    std::istringstream actionStream(line.substr(beginOfAction + 1, endOfAction - beginOfAction - 1));
+    std::string actionId;
+    actionStream >> actionId;
+    auto* actionPtr = pDomain.getActionPtr(actionId);
+    if (actionPtr == nullptr)
+      throw std::runtime_error("Action \"" + actionId + "\" of the plan is not found in the domain");
+
+    std::map<Parameter, Entity> parameters;
+    std::string argument;
+    auto itParameter = actionPtr->parameters.begin();
+    while (actionStream >> argument)
+    {
+      if (itParameter == actionPtr->parameters.end())
+        throw std::runtime_error("Too many arguments for action \"" + actionId + "\" in the plan");
+      const auto* entityPtr = pEntities.valueToEntity(argument);
+      if (entityPtr == nullptr)
+        entityPtr = constants.valueToEntity(argument);
+      if (entityPtr == nullptr)
+        throw std::runtime_error("Argument \"" + argument + "\" of action \"" + actionId + "\" in the plan is not an entity");
+      parameters.emplace(*itParameter, *entityPtr);
+      ++itParameter;
+    }
+    if (itParameter != actionPtr->parameters.end())
+      throw std::runtime_error("Missing arguments for action \"" + actionId + "\" in the plan");
+
+    if (!stepIndex || stepIndex != previousStepIndex || res.actionsToDoInParallel.empty())
+      res.actionsToDoInParallel.emplace_back();
+    res.actionsToDoInParallel.back().actions.emplace_back(actionId, parameters, std::unique_ptr<Goal>(), 0);
+    previousStepIndex = stepIndex;
+  }
+  return res;
+}
+
+
 
 }
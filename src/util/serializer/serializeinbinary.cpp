@@ -0,0 +1,410 @@
+#include <orderedgoalsplanner/util/serializer/serializeinbinary.hpp>
+#include <stdexcept>
+#include <orderedgoalsplanner/types/domain.hpp>
+#include <orderedgoalsplanner/types/problem.hpp>
+#include "../../types/worldstatemodificationprivate.hpp"
+#include "binaryformat.hpp"
+
+
+namespace ogp
+{
+namespace
+{
+
+void _writeEntities(BinaryWriter& pWriter,
+                    SymbolTableWriter& pSymbols,
+                    const SetOfEntities& pEntities)
+{
+  const auto& valueToEntities = pEntities.valueToEntities();
+  pWriter.writeUint32(static_cast<std::uint32_t>(valueToEntities.size()));
+  for (const auto& currValueToEntity : valueToEntities)
+  {
+    const auto& entity = currValueToEntity.second;
+    pWriter.writeUint32(pSymbols.getId(entity.value));
+    pWriter.writeUint32(pSymbols.getId(entity.type ? entity.type->name : ""));
+  }
+}
+
+
+void _writeFacts(BinaryWriter& pWriter,
+                 SymbolTableWriter& pSymbols,
+                 const SetOfFacts& pFacts)
+{
+  std::uint32_t nbOfFacts = 0;
+  for (const auto& currFact : pFacts.facts())
+    if (currFact.second)
+      ++nbOfFacts;
+
+  pWriter.writeUint32(nbOfFacts);
+  for (const auto& currFact : pFacts.facts())
+  {
+    // Facts that cannot be removed come from the domain, so they are not part of the problem
+    if (!currFact.second)
+      continue;
+    const Fact& fact = currFact.first;
+    pWriter.writeUint32(pSymbols.getId(fact.name()));
+    pWriter.writeUint32(static_cast<std::uint32_t>(fact.arguments().size()));
+    for (const auto& currArg : fact.arguments())
+      pWriter.writeUint32(pSymbols.getId(currArg.value));
+    pWriter.writeBool(fact.fluent().has_value());
+    if (fact.fluent())
+      pWriter.writeUint32(pSymbols.getId(fact.fluent()->value));
+    pWriter.writeBool(fact.isValueNegated());
+  }
+}
+
+
+void _writeTypes(BinaryWriter& pWriter,
+                 SymbolTableWriter& pSymbols,
+                 const std::list<std::shared_ptr<Type>>& pTypes)
+{
+  pWriter.writeUint32(static_cast<std::uint32_t>(pTypes.size()));
+  for (const auto& currType : pTypes)
+  {
+    pWriter.writeUint32(pSymbols.getId(currType->name));
+    _writeTypes(pWriter, pSymbols, currType->subTypes);
+  }
+}
+
+
+void _writeEntity(BinaryWriter& pWriter,
+                  SymbolTableWriter& pSymbols,
+                  const Entity& pEntity)
+{
+  pWriter.writeUint32(pSymbols.getId(pEntity.value));
+  pWriter.writeUint32(pSymbols.getId(pEntity.type ? pEntity.type->name : ""));
+}
+
+
+void _writeParameters(BinaryWriter& pWriter,
+                      SymbolTableWriter& pSymbols,
+                      const std::vector<Parameter>& pParameters)
+{
+  pWriter.writeUint32(static_cast<std::uint32_t>(pParameters.size()));
+  for (const auto& currParameter : pParameters)
+  {
+    pWriter.writeUint32(pSymbols.getId(currParameter.name));
+    pWriter.writeUint32(pSymbols.getId(currParameter.type ? currParameter.type->name : ""));
+  }
+}
+
+
+void _writePredicate(BinaryWriter& pWriter,
+                     SymbolTableWriter& pSymbols,
+                     const Predicate& pPredicate)
+{
+  pWriter.writeUint32(pSymbols.getId(pPredicate.name));
+  _writeParameters(pWriter, pSymbols, pPredicate.parameters);
+  pWriter.writeUint32(pSymbols.getId(pPredicate.fluent ? pPredicate.fluent->name : ""));
+}
+
+
+void _writeFact(BinaryWriter& pWriter,
+                SymbolTableWriter& pSymbols,
+                const Fact& pFact)
+{
+  pWriter.writeUint32(pSymbols.getId(pFact.name()));
+  pWriter.writeUint32(static_cast<std::uint32_t>(pFact.arguments().size()));
+  for (const auto& currArg : pFact.arguments())
+    _writeEntity(pWriter, pSymbols, currArg);
+  pWriter.writeBool(pFact.fluent().has_value());
+  if (pFact.fluent())
+    _writeEntity(pWriter, pSymbols, *pFact.fluent());
+  pWriter.writeBool(pFact.isValueNegated());
+}
+
+
+void _writeNumber(BinaryWriter& pWriter,
+                  const Number& pNumber)
+{
+  if (std::holds_alternative<int>(pNumber))
+  {
+    pWriter.writeUint8(0);
+    pWriter.writeInt32(std::get<int>(pNumber));
+  }
+  else
+  {
+    pWriter.writeUint8(1);
+    pWriter.writeFloat(std::get<float>(pNumber));
+  }
+}
+
+
+void _writeCondition(BinaryWriter& pWriter,
+                     SymbolTableWriter& pSymbols,
+                     const Condition* pConditionPtr)
+{
+  if (pConditionPtr == nullptr)
+  {
+    pWriter.writeUint8(static_cast<std::uint8_t>(BinaryConditionTag::NONE));
+    return;
+  }
+
+  if (const auto* nodePtr = pConditionPtr->fcNodePtr())
+  {
+    pWriter.writeUint8(static_cast<std::uint8_t>(BinaryConditionTag::NODE));
+    pWriter.writeUint8(static_cast<std::uint8_t>(nodePtr->nodeType));
+    _writeCondition(pWriter, pSymbols, nodePtr->leftOperand.get());
+    _writeCondition(pWriter, pSymbols, nodePtr->rightOperand.get());
+  }
+  else if (const auto* existsPtr = pConditionPtr->fcExistsPtr())
+  {
+    pWriter.writeUint8(static_cast<std::uint8_t>(BinaryConditionTag::EXISTS));
+    _writeParameters(pWriter, pSymbols, {existsPtr->parameter});
+    _writeCondition(pWriter, pSymbols, existsPtr->condition.get());
+  }
+  else if (const auto* notPtr = pConditionPtr->fcNotPtr())
+  {
+    pWriter.writeUint8(static_cast<std::uint8_t>(BinaryConditionTag::NOT));
+    _writeCondition(pWriter, pSymbols, notPtr->condition.get());
+  }
+  else if (const auto* factPtr = pConditionPtr->fcFactPtr())
+  {
+    pWriter.writeUint8(static_cast<std::uint8_t>(BinaryConditionTag::FACT));
+    pWriter.writeBool(factPtr->factOptional.isFactNegated);
+    _writeFact(pWriter, pSymbols, factPtr->factOptional.fact);
+  }
+  else if (const auto* nbPtr = pConditionPtr->fcNbPtr())
+  {
+    pWriter.writeUint8(static_cast<std::uint8_t>(BinaryConditionTag::NUMBER));
+    _writeNumber(pWriter, nbPtr->nb);
+  }
+  else
+  {
+    throw std::runtime_error("Unknown condition type to write in binary");
+  }
+}
+
+
+void _writeSuccessions(BinaryWriter& pWriter,
+                       SymbolTableWriter& pSymbols,
+                       const Successions& pSuccessions)
+{
+  pWriter.writeUint32(static_cast<std::uint32_t>(pSuccessions.actions.size()));
+  for (const auto& currActionId : pSuccessions.actions)
+    pWriter.writeUint32(pSymbols.getId(currActionId));
+  pWriter.writeUint32(static_cast<std::uint32_t>(pSuccessions.events.size()));
+  for (const auto& currSetOfEvents : pSuccessions.events)
+  {
+    pWriter.writeUint32(pSymbols.getId(currSetOfEvents.first));
+    pWriter.writeUint32(static_cast<std::uint32_t>(currSetOfEvents.second.size()));
+    for (const auto& currEventId : currSetOfEvents.second)
+      pWriter.writeUint32(pSymbols.getId(currEventId));
+  }
+}
+
+
+void _writeWsModification(BinaryWriter& pWriter,
+                          SymbolTableWriter& pSymbols,
+                          const std::unique_ptr<WorldStateModification>& pWsModification)
+{
+  if (!pWsModification)
+  {
+    pWriter.writeUint8(static_cast<std::uint8_t>(BinaryWsModificationTag::NONE));
+    return;
+  }
+
+  if (const auto* nodePtr = toWmNode(*pWsModification))
+  {
+    pWriter.writeUint8(static_cast<std::uint8_t>(BinaryWsModificationTag::NODE));
+    pWriter.writeUint8(static_cast<std::uint8_t>(nodePtr->nodeType));
+    _writeWsModification(pWriter, pSymbols, nodePtr->leftOperand);
+    _writeWsModification(pWriter, pSymbols, nodePtr->rightOperand);
+    pWriter.writeBool(nodePtr->parameterOpt.has_value());
+    if (nodePtr->parameterOpt)
+      _writeParameters(pWriter, pSymbols, {*nodePtr->parameterOpt});
+    _writeSuccessions(pWriter, pSymbols, nodePtr->successions());
+  }
+  else if (const auto* factPtr = toWmFact(*pWsModification))
+  {
+    pWriter.writeUint8(static_cast<std::uint8_t>(BinaryWsModificationTag::FACT));
+    pWriter.writeBool(factPtr->factOptional.isFactNegated);
+    _writeFact(pWriter, pSymbols, factPtr->factOptional.fact);
+    _writeSuccessions(pWriter, pSymbols, factPtr->successions());
+  }
+  else if (const auto* nbPtr = toWmNumber(*pWsModification))
+  {
+    pWriter.writeUint8(static_cast<std::uint8_t>(BinaryWsModificationTag::NUMBER));
+    _writeNumber(pWriter, nbPtr->getNb());
+  }
+  else
+  {
+    throw std::runtime_error("Unknown world state modification type to write in binary");
+  }
+}
+
+
+void _writeGoal(BinaryWriter& pWriter,
+                SymbolTableWriter& pSymbols,
+                const Goal& pGoal)
+{
+  _writeCondition(pWriter, pSymbols, &pGoal.objective());
+  pWriter.writeBool(pGoal.isPersistent());
+  pWriter.writeBool(pGoal.isOneStepTowards());
+  pWriter.writeInt32(pGoal.getMaxTimeToKeepInactive());
+  pWriter.writeUint32(pSymbols.getId(pGoal.getGoalGroupId()));
+}
+
+
+void _writeGoals(BinaryWriter& pWriter,
+                 SymbolTableWriter& pSymbols,
+                 const std::map<int, std::vector<Goal>>& pGoals)
+{
+  pWriter.writeUint32(static_cast<std::uint32_t>(pGoals.size()));
+  for (const auto& currPriorityToGoals : pGoals)
+  {
+    pWriter.writeInt32(currPriorityToGoals.first);
+    pWriter.writeUint32(static_cast<std::uint32_t>(currPriorityToGoals.second.size()));
+    for (const auto& currGoal : currPriorityToGoals.second)
+      _writeGoal(pWriter, pSymbols, currGoal);
+  }
+}
+
+
+void _writeIds(BinaryWriter& pWriter,
+               SymbolTableWriter& pSymbols,
+               const std::set<std::string>& pIds)
+{
+  pWriter.writeUint32(static_cast<std::uint32_t>(pIds.size()));
+  for (const auto& currId : pIds)
+    pWriter.writeUint32(pSymbols.getId(currId));
+}
+
+
+void _writeAction(BinaryWriter& pWriter,
+                  SymbolTableWriter& pSymbols,
+                  const Action& pAction)
+{
+  _writeParameters(pWriter, pSymbols, pAction.parameters);
+  _writeCondition(pWriter, pSymbols, pAction.precondition.get());
+  _writeCondition(pWriter, pSymbols, pAction.overAllCondition.get());
+  _writeCondition(pWriter, pSymbols, pAction.preferInContext.get());
+  _writeWsModification(pWriter, pSymbols, pAction.effect.worldStateModification);
+  _writeWsModification(pWriter, pSymbols, pAction.effect.potentialWorldStateModification);
+  _writeWsModification(pWriter, pSymbols, pAction.effect.worldStateModificationAtStart);
+  _writeGoals(pWriter, pSymbols, pAction.effect.goalsToAdd);
+  pWriter.writeUint32(static_cast<std::uint32_t>(pAction.effect.goalsToAddInCurrentPriority.size()));
+  for (const auto& currGoal : pAction.effect.goalsToAddInCurrentPriority)
+    _writeGoal(pWriter, pSymbols, currGoal);
+  pWriter.writeBool(pAction.highImportanceOfNotRepeatingIt);
+  pWriter.writeBool(pAction.canThisActionBeUsedByThePlanner);
+  _writeIds(pWriter, pSymbols, pAction.actionsSuccessionsWithoutInterestCache);
+  _writeIds(pWriter, pSymbols, pAction.actionsPredecessorsCache);
+  _writeIds(pWriter, pSymbols, pAction.eventsPredecessorsCache);
+}
+
+
+void _writeEvent(BinaryWriter& pWriter,
+                 SymbolTableWriter& pSymbols,
+                 const Event& pEvent)
+{
+  _writeParameters(pWriter, pSymbols, pEvent.parameters);
+  _writeCondition(pWriter, pSymbols, pEvent.precondition.get());
+  _writeWsModification(pWriter, pSymbols, pEvent.factsToModify);
+  _writeGoals(pWriter, pSymbols, pEvent.goalsToAdd);
+  _writeIds(pWriter, pSymbols, pEvent.actionsPredecessorsCache);
+  _writeIds(pWriter, pSymbols, pEvent.eventsPredecessorsCache);
+}
+
+
+void _writeHistorical(BinaryWriter& pWriter,
+                      SymbolTableWriter& pSymbols,
+                      const Historical& pHistorical)
+{
+  auto actionToNumberOfTimeAlreadyDone = pHistorical.getActionToNumberOfTimeAlreadyDone();
+  pWriter.writeUint32(static_cast<std::uint32_t>(actionToNumberOfTimeAlreadyDone.size()));
+  for (const auto& currAction : actionToNumberOfTimeAlreadyDone)
+  {
+    pWriter.writeUint32(pSymbols.getId(currAction.first));
+    pWriter.writeUint32(static_cast<std::uint32_t>(currAction.second));
+  }
+}
+
+}
+
+
+std::string problemToBinary(const Problem& pProblem,
+                            const Domain& pDomain)
+{
+  // The content is written first, so that the symbol table is complete when the header is written
+  SymbolTableWriter symbols;
+  std::string content;
+  BinaryWriter contentWriter(content);
+  _writeEntities(contentWriter, symbols, pProblem.entities);
+  _writeFacts(contentWriter, symbols, pProblem.worldState.factsMapping());
+  writeGoalsInBinary(contentWriter, pProblem.goalStack.goals());
+  _writeHistorical(contentWriter, symbols, pProblem.historical);
+
+  std::string res = binarySnapshotMagic;
+  BinaryWriter writer(res);
+  writer.writeUint32(binarySnapshotVersion);
+  writer.writeString(pProblem.name);
+  writer.writeString(pDomain.getName());
+  writer.writeUint32(static_cast<std::uint32_t>(symbols.symbols().size()));
+  for (const auto& currSymbol : symbols.symbols())
+    writer.writeString(currSymbol);
+  return res + content;
+}
+
+
+std::string domainToBinary(const Domain& pDomain)
+{
+  SymbolTableWriter symbols;
+  std::string content;
+  BinaryWriter contentWriter(content);
+
+  const auto& ontology = pDomain.getOntology();
+  _writeTypes(contentWriter, symbols, ontology.types.rootTypes());
+  _writeEntities(contentWriter, symbols, ontology.constants);
+  const auto& nameToPredicates = ontology.predicates.nameToPredicates();
+  contentWriter.writeUint32(static_cast<std::uint32_t>(nameToPredicates.size()));
+  for (const auto& currPredicate : nameToPredicates)
+    _writePredicate(contentWriter, symbols, currPredicate.second);
+  // The predicates of the derived predicates are written before their conditions, because a condition can refer to another derived predicate
+  const auto& nameToDerivedPredicates = ontology.derivedPredicates.nameToDerivedPredicates();
+  contentWriter.writeUint32(static_cast<std::uint32_t>(nameToDerivedPredicates.size()));
+  for (const auto& currDerivedPredicate : nameToDerivedPredicates)
+    _writePredicate(contentWriter, symbols, currDerivedPredicate.second.predicate);
+  for (const auto& currDerivedPredicate : nameToDerivedPredicates)
+    _writeCondition(contentWriter, symbols, currDerivedPredicate.second.condition.get());
+
+  const auto& timelessFacts = pDomain.getTimelessFacts().setOfFacts().facts();
+  contentWriter.writeUint32(static_cast<std::uint32_t>(timelessFacts.size()));
+  for (const auto& currFact : timelessFacts)
+    _writeFact(contentWriter, symbols, currFact.first);
+  _writeIds(contentWriter, symbols, pDomain.requirements());
+
+  const auto& actions = pDomain.actions();
+  contentWriter.writeUint32(static_cast<std::uint32_t>(actions.size()));
+  for (const auto& currAction : actions)
+  {
+    contentWriter.writeUint32(symbols.getId(currAction.first));
+    _writeAction(contentWriter, symbols, currAction.second);
+  }
+
+  const auto& setOfEvents = pDomain.getSetOfEvents();
+  contentWriter.writeUint32(static_cast<std::uint32_t>(setOfEvents.size()));
+  for (const auto& currSetOfEvents : setOfEvents)
+  {
+    contentWriter.writeUint32(symbols.getId(currSetOfEvents.first));
+    const auto& events = currSetOfEvents.second.events();
+    contentWriter.writeUint32(static_cast<std::uint32_t>(events.size()));
+    for (const auto& currEvent : events)
+    {
+      contentWriter.writeUint32(symbols.getId(currEvent.first));
+      _writeEvent(contentWriter, symbols, currEvent.second);
+    }
+  }
+
+  std::string res = binaryDomainSnapshotMagic;
+  BinaryWriter writer(res);
+  writer.writeUint32(binaryDomainSnapshotVersion);
+  writer.writeString(pDomain.getName());
+  writer.writeUint32(static_cast<std::uint32_t>(symbols.symbols().size()));
+  for (const auto& currSymbol : symbols.symbols())
+    writer.writeString(currSymbol);
+  return res + content;
+}
+
+
+} // !ogp
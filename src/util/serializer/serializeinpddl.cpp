@@ -22,7 +22,8 @@ std::string _parametersToPddl(const std::vector<Parameter>& pParameters)
       res +=  " ";
     res += currParam.toStr();
   }
-  return res + ")";
+  res += ')';
+  return res;
 }
 
 
@@ -119,7 +120,8 @@ struct WorldStateModificationWithPartInfo
 };
 
 
-std::string _effectToPddl(
+void _effectToPddl(
+    std::string& pRes,
     const WorldStateModification& pWsModif,
     std::size_t pIdentation)
 {
@@ -127,10 +129,6 @@ std::string _effectToPddl(
   if (wsmNodePtr != nullptr)
   {
     const auto& wsmNode = *wsmNodePtr;
-    std::string leftOperandStr;
-    if (wsmNode.leftOperand)
-      leftOperandStr = _effectToPddl(*wsmNode.leftOperand, pIdentation);
-    std::string rightOperandStr;
     bool isRightOperandAFactWithoutParameter = false;
     if (wsmNode.rightOperand)
     {
@@ -138,53 +136,213 @@ std::string _effectToPddl(
       if (rightOperandFactPtr != nullptr && rightOperandFactPtr->factOptional.fact.arguments().empty() &&
           !rightOperandFactPtr->factOptional.fact.fluent())
         isRightOperandAFactWithoutParameter = true;
-      rightOperandStr = _effectToPddl(*wsmNode.rightOperand, pIdentation);
     }
 
     switch (wsmNode.nodeType)
     {
     case WorldStateModificationNodeType::AND:
-      return "(and " + leftOperandStr + " " + rightOperandStr + ")";
+      pRes += "(and ";
+      break;
     case WorldStateModificationNodeType::ASSIGN:
-    {
-      if (isRightOperandAFactWithoutParameter)
-        rightOperandStr += "()"; // To significate it is a fact
-      return "(assign " + leftOperandStr + " " + rightOperandStr + ")";
-    }
+      pRes += "(assign ";
+      break;
     case WorldStateModificationNodeType::FOR_ALL:
       if (!wsmNode.parameterOpt)
         throw std::runtime_error("for all statement without a parameter detected");
-      return "(forall (" + wsmNode.parameterOpt->toStr() + ") (when " +
-          leftOperandStr + " " + rightOperandStr + "))";
+      pRes += "(forall (";
+      pRes += wsmNode.parameterOpt->toStr();
+      pRes += ") (when ";
+      break;
     case WorldStateModificationNodeType::INCREASE:
-      return "(increase " + leftOperandStr + " " + rightOperandStr + ")";
+      pRes += "(increase ";
+      break;
     case WorldStateModificationNodeType::DECREASE:
-      return "(decrease " + leftOperandStr + " " + rightOperandStr + ")";
+      pRes += "(decrease ";
+      break;
     case WorldStateModificationNodeType::MULTIPLY:
-      return "(* " + leftOperandStr + " " + rightOperandStr + ")";
+      pRes += "(* ";
+      break;
     case WorldStateModificationNodeType::PLUS:
-      return "(+ " + leftOperandStr + " " + rightOperandStr + ")";
+      pRes += "(+ ";
+      break;
     case WorldStateModificationNodeType::MINUS:
-      return "(- " + leftOperandStr + " " + rightOperandStr + ")";
+      pRes += "(- ";
+      break;
     case WorldStateModificationNodeType::WHEN:
-      return "(when " + leftOperandStr + " " + rightOperandStr + ")";
+      pRes += "(when ";
+      break;
+    default:
+      throw std::runtime_error("Unkown WorldStateModificationNodeType type");
     }
 
-    throw std::runtime_error("Unkown WorldStateModificationNodeType type");
+    if (wsmNode.leftOperand)
+      _effectToPddl(pRes, *wsmNode.leftOperand, pIdentation);
+    pRes += ' ';
+    if (wsmNode.rightOperand)
+      _effectToPddl(pRes, *wsmNode.rightOperand, pIdentation);
+    if (wsmNode.nodeType == WorldStateModificationNodeType::ASSIGN && isRightOperandAFactWithoutParameter)
+      pRes += "()"; // To significate it is a fact
+    pRes += wsmNode.nodeType == WorldStateModificationNodeType::FOR_ALL ? "))" : ")";
+    return;
   }
 
   const auto* wsmFactPtr = toWmFact(pWsModif);
   if (wsmFactPtr != nullptr)
-    return wsmFactPtr->factOptional.toPddl(true, false);
+  {
+    wsmFactPtr->factOptional.toPddl(pRes, true, false);
+    return;
+  }
 
   const auto* wsmNbPtr = toWmNumber(pWsModif);
   if (wsmNbPtr != nullptr)
-    return numberToString(wsmNbPtr->getNb());
+  {
+    pRes += numberToString(wsmNbPtr->getNb());
+    return;
+  }
 
   throw std::runtime_error("Unknown WorldStateModification children struct");
 }
 
 
+std::string _effectToPddl(
+    const WorldStateModification& pWsModif,
+    std::size_t pIdentation)
+{
+  std::string res;
+  _effectToPddl(res, pWsModif, pIdentation);
+  return res;
+}
+
+
+void _conditionToPddl(std::string& pRes,
+                      const Condition& pCondition,
+                      std::size_t pIdentation)
+{
+  const ConditionNode* condNodePtr = pCondition.fcNodePtr();
+  if (condNodePtr != nullptr)
+  {
+    const auto& condNode = *condNodePtr;
+
+    if (condNode.nodeType == ConditionNodeType::AND || condNode.nodeType == ConditionNodeType::OR || condNode.nodeType == ConditionNodeType::IMPLY)
+    {
+      pRes += '(';
+      if (condNode.nodeType == ConditionNodeType::AND)
+        pRes += "and";
+      else if (condNode.nodeType == ConditionNodeType::OR)
+        pRes += "or";
+      else
+        pRes += "imply";
+      auto indentation = pIdentation + _identationOffset;
+      pRes += '\n';
+      pRes.append(indentation, ' ');
+      if (condNode.leftOperand)
+        _conditionToPddl(pRes, *condNode.leftOperand, indentation);
+      auto* nodePtr = condNodePtr;
+
+      while (true)
+      {
+        pRes += '\n';
+        pRes.append(indentation, ' ');
+        auto* newNodePtr = nodePtr->rightOperand->fcNodePtr();
+        if (newNodePtr == nullptr || newNodePtr->nodeType != condNode.nodeType)
+        {
+          _conditionToPddl(pRes, *nodePtr->rightOperand, indentation);
+          break;
+        }
+
+        _conditionToPddl(pRes, *newNodePtr->leftOperand, indentation);
+        nodePtr = newNodePtr;
+      }
+      pRes += '\n';
+      pRes.append(pIdentation, ' ');
+      pRes += ')';
+      return;
+    }
+
+    pRes += '(';
+    switch (condNode.nodeType)
+    {
+    case ConditionNodeType::EQUALITY:
+      pRes += "=";
+      break;
+    case ConditionNodeType::PLUS:
+      pRes += "+";
+      break;
+    case ConditionNodeType::MINUS:
+      pRes += "-";
+      break;
+    case ConditionNodeType::SUPERIOR:
+      pRes += ">";
+      break;
+    case ConditionNodeType::SUPERIOR_OR_EQUAL:
+      pRes += ">=";
+      break;
+    case ConditionNodeType::INFERIOR:
+      pRes += "<";
+      break;
+    case ConditionNodeType::INFERIOR_OR_EQUAL:
+      pRes += "<=";
+      break;
+    case ConditionNodeType::AND:
+    case ConditionNodeType::OR:
+    case ConditionNodeType::IMPLY:
+      break;
+    }
+    pRes += ' ';
+    if (condNode.leftOperand)
+      _conditionToPddl(pRes, *condNode.leftOperand, pIdentation);
+    pRes += ' ';
+    if (condNode.rightOperand)
+      _conditionToPddl(pRes, *condNode.rightOperand, pIdentation);
+    pRes += ')';
+    return;
+  }
+
+  const ConditionExists* condExistsPtr = pCondition.fcExistsPtr();
+  if (condExistsPtr != nullptr)
+  {
+    const auto& condExists = *condExistsPtr;
+    pRes += "(exists (";
+    pRes += condExists.parameter.toStr();
+    pRes += ") ";
+    if (condExists.condition)
+      _conditionToPddl(pRes, *condExists.condition, pIdentation);
+    pRes += ')';
+    return;
+  }
+
+
+  const ConditionNot* condNotPtr = pCondition.fcNotPtr();
+  if (condNotPtr != nullptr)
+  {
+    const auto& condNot = *condNotPtr;
+    if (condNot.condition)
+    {
+      pRes += "(not ";
+      _conditionToPddl(pRes, *condNot.condition, pIdentation);
+      pRes += ')';
+    }
+    return;
+  }
+
+  const ConditionFact* condFactPtr = pCondition.fcFactPtr();
+  if (condFactPtr != nullptr)
+  {
+    condFactPtr->factOptional.toPddl(pRes, false, false);
+    return;
+  }
+
+  const ConditionNumber* condNbPtr = pCondition.fcNbPtr();
+  if (condNbPtr != nullptr)
+  {
+    pRes += numberToString(condNbPtr->nb);
+    return;
+  }
+
+  throw std::runtime_error("Unknown conditon type");
+}
+
+
 std::string _effectsToPddl(
     const std::list<WorldStateModificationWithPartInfo>& pWorldStateModificationWithPartInfos,
     std::size_t pIdentation)
@@ -312,7 +470,7 @@ std::string domainToPddl(const Domain& pDomain)
     res += "\n" + std::string(identation, ' ') + ")\n\n";
   }
 
-  auto setOfEvents = pDomain.getSetOfEvents();
+  const auto& setOfEvents = pDomain.getSetOfEvents();
   if (!setOfEvents.empty())
   {
     for (const auto& currSetOfEvent : setOfEvents)
@@ -413,7 +571,8 @@ std::string domainToPddl(const Domain& pDomain)
     res += "\n" + std::string(identation, ' ') + ")\n\n";
   }
 
-  return res + ")";
+  res += ')';
+  return res;
 }
 
 
@@ -436,9 +595,12 @@ std::string problemToPddl(const Problem& pProblem,
   const SetOfFacts& facts = pProblem.worldState.factsMapping();
   if (!facts.empty())
   {
-    res += std::string(identation, ' ') + "(:init\n";
-    res += facts.toPddl(_identationOffset + identation, false);
-    res += "\n" + std::string(identation, ' ') + ")\n\n";
+    res.append(identation, ' ');
+    res += "(:init\n";
+    facts.toPddl(res, _identationOffset + identation, false);
+    res += '\n';
+    res.append(identation, ' ');
+    res += ")\n\n";
   }
 
 
@@ -500,7 +662,8 @@ std::string problemToPddl(const Problem& pProblem,
     res += std::string(identation, ' ') + ")\n\n";
   }
 
-  return res + ")";
+  res += ')';
+  return res;
 }
 
 
@@ -509,111 +672,9 @@ std::string problemToPddl(const Problem& pProblem,
 std::string conditionToPddl(const Condition& pCondition,
                             std::size_t pIdentation)
 {
-  const ConditionNode* condNodePtr = pCondition.fcNodePtr();
-  if (condNodePtr != nullptr)
-  {
-    const auto& condNode = *condNodePtr;
-
-    if (condNode.nodeType == ConditionNodeType::AND || condNode.nodeType == ConditionNodeType::OR || condNode.nodeType == ConditionNodeType::IMPLY)
-    {
-      std::string contentStr = "(";
-      if (condNode.nodeType == ConditionNodeType::AND)
-        contentStr += "and";
-      else if (condNode.nodeType == ConditionNodeType::OR)
-        contentStr += "or";
-      else
-        contentStr += "imply";
-      auto indentation = pIdentation + _identationOffset;
-      std::string leftOperandStr;
-      if (condNode.leftOperand)
-        leftOperandStr = conditionToPddl(*condNode.leftOperand, indentation);
-      contentStr += "\n" + std::string(indentation, ' ') + leftOperandStr;
-      auto* nodePtr = condNodePtr;
-
-      while (true)
-      {
-        contentStr += "\n" + std::string(indentation, ' ');
-        auto* newNodePtr = nodePtr->rightOperand->fcNodePtr();
-        if (newNodePtr == nullptr || newNodePtr->nodeType != condNode.nodeType)
-        {
-          contentStr += conditionToPddl(*nodePtr->rightOperand, indentation);
-          break;
-        }
-
-        contentStr += conditionToPddl(*newNodePtr->leftOperand, indentation);
-        nodePtr = newNodePtr;
-      }
-      return contentStr + "\n" + std::string(pIdentation, ' ') + ")";
-    }
-
-    std::string leftOperandStr;
-    if (condNode.leftOperand)
-      leftOperandStr = conditionToPddl(*condNode.leftOperand, pIdentation);
-    std::string rightOperandStr;
-    if (condNode.rightOperand)
-      rightOperandStr = conditionToPddl(*condNode.rightOperand, pIdentation);
-
-    std::string res = "(";
-    switch (condNode.nodeType)
-    {
-    case ConditionNodeType::EQUALITY:
-      res += "=";
-      break;
-    case ConditionNodeType::PLUS:
-      res += "+";
-      break;
-    case ConditionNodeType::MINUS:
-      res += "-";
-      break;
-    case ConditionNodeType::SUPERIOR:
-      res += ">";
-      break;
-    case ConditionNodeType::SUPERIOR_OR_EQUAL:
-      res += ">=";
-      break;
-    case ConditionNodeType::INFERIOR:
-      res += "<";
-      break;
-    case ConditionNodeType::INFERIOR_OR_EQUAL:
-      res += "<=";
-      break;
-    case ConditionNodeType::AND:
-    case ConditionNodeType::OR:
-    case ConditionNodeType::IMPLY:
-      break;
-    }
-    return res + " " + leftOperandStr + " " + rightOperandStr + ")";
-  }
-
-  const ConditionExists* condExistsPtr = pCondition.fcExistsPtr();
-  if (condExistsPtr != nullptr)
-  {
-    const auto& condExists = *condExistsPtr;
-    std::string conditionStr;
-    if (condExists.condition)
-      conditionStr = conditionToPddl(*condExists.condition, pIdentation);
-    return "(exists (" + condExists.parameter.toStr() + ") " + conditionStr + ")";
-  }
-
-
-  const ConditionNot* condNotPtr = pCondition.fcNotPtr();
-  if (condNotPtr != nullptr)
-  {
-    const auto& condNot = *condNotPtr;
-    if (condNot.condition)
-      return "(not " + conditionToPddl(*condNot.condition, pIdentation) + ")";
-    return "";
-  }
-
-  const ConditionFact* condFactPtr = pCondition.fcFactPtr();
-  if (condFactPtr != nullptr)
-    return condFactPtr->factOptional.toPddl(false, false);
-
-  const ConditionNumber* condNbPtr = pCondition.fcNbPtr();
-  if (condNbPtr != nullptr)
-    return numberToString(condNbPtr->nb);
-
-  throw std::runtime_error("Unknown conditon type");
+  std::string res;
+  _conditionToPddl(res, pCondition, pIdentation);
+  return res;
 }
 
 }
@@ -0,0 +1,362 @@
+#include <orderedgoalsplanner/util/trackers/plannertrace.hpp>
+#include <stdexcept>
+#include <orderedgoalsplanner/types/domain.hpp>
+#include <orderedgoalsplanner/types/problem.hpp>
+#include <orderedgoalsplanner/types/setofcallbacks.hpp>
+#include <orderedgoalsplanner/util/serializer/deserializefrombinary.hpp>
+#include <orderedgoalsplanner/util/serializer/serializeinbinary.hpp>
+#include <orderedgoalsplanner/orderedgoalsplanner.hpp>
+#include "../serializer/binaryformat.hpp"
+
+
+namespace ogp
+{
+namespace
+{
+const std::string _traceMagic = "OGPT";
+const std::uint32_t _traceVersion = 2;
+
+
+std::vector<const Fact*> _toFactPtrs(const std::vector<Fact>& pFacts)
+{
+  std::vector<const Fact*> res;
+  res.reserve(pFacts.size());
+  for (const auto& currFact : pFacts)
+    res.emplace_back(&currFact);
+  return res;
+}
+
+
+void _writePlan(BinaryWriter& pWriter,
+                const std::list<ActionInvocationWithGoal>& pPlan)
+{
+  pWriter.writeUint32(static_cast<std::uint32_t>(pPlan.size()));
+  for (const auto& currStep : pPlan)
+    pWriter.writeString(currStep.actionInvocation.toStr());
+}
+
+
+bool _isSamePlan(BinaryReader& pReader,
+                 const std::list<ActionInvocationWithGoal>& pPlan)
+{
+  bool res = true;
+  auto nbOfSteps = pReader.readUint32();
+  if (nbOfSteps != pPlan.size())
+    res = false;
+  auto itPlan = pPlan.begin();
+  for (std::uint32_t i = 0; i < nbOfSteps; ++i)
+  {
+    auto recordedStepStr = pReader.readString();
+    if (itPlan != pPlan.end())
+    {
+      if (recordedStepStr != itPlan->actionInvocation.toStr())
+        res = false;
+      ++itPlan;
+    }
+  }
+  return res;
+}
+
+
+ActionInvocationWithGoal _readActionInvocation(BinaryReader& pReader,
+                                               const Problem& pProblem,
+                                               const Domain& pDomain)
+{
+  const auto& ontology = pDomain.getOntology();
+  auto actionId = pReader.readString();
+  const auto* actionPtr = pDomain.getActionPtr(actionId);
+  std::map<Parameter, Entity> parameters;
+  auto nbOfParameters = pReader.readUint32();
+  for (std::uint32_t i = 0; i < nbOfParameters; ++i)
+  {
+    auto parameterName = pReader.readString();
+    auto parameterType = pReader.readString();
+    auto entity = Entity::fromUsage(pReader.readString(), ontology, pProblem.entities, {});
+    std::unique_ptr<Parameter> parameterPtr;
+    if (actionPtr != nullptr)
+      for (const auto& currParameter : actionPtr->parameters)
+        if (currParameter.name == parameterName)
+          parameterPtr = std::make_unique<Parameter>(currParameter);
+    if (!parameterPtr)
+      parameterPtr = std::make_unique<Parameter>(parameterName, ontology.types.nameToType(parameterType));
+    parameters.emplace(std::move(*parameterPtr), std::move(entity));
+  }
+
+  std::unique_ptr<Goal> fromGoal;
+  auto fromGoalPriority = pReader.readInt32();
+  if (pReader.readBool())
+  {
+    auto goals = readGoalsFromBinary(pReader, ontology, pProblem.entities);
+    if (!goals.empty() && !goals.begin()->second.empty())
+      fromGoal = goals.begin()->second.front().clone();
+  }
+  return ActionInvocationWithGoal(actionId, parameters, std::move(fromGoal), fromGoalPriority);
+}
+
+
+std::unique_ptr<std::chrono::steady_clock::time_point> _readNow(BinaryReader& pReader,
+                                                                const std::chrono::steady_clock::time_point& pOrigin)
+{
+  if (!pReader.readBool())
+    return {};
+  return std::make_unique<std::chrono::steady_clock::time_point>(pOrigin + std::chrono::nanoseconds(pReader.readInt64()));
+}
+
+}
+
+
+std::string plannerTraceCallTypeToStr(PlannerTraceCallType pCallType)
+{
+  switch (pCallType)
+  {
+  case PlannerTraceCallType::ADD_FACTS:
+    return "addFacts";
+  case PlannerTraceCallType::REMOVE_FACTS:
+    return "removeFacts";
+  case PlannerTraceCallType::PUSH_BACK_GOAL:
+    return "pushBackGoal";
+  case PlannerTraceCallType::PLAN_FOR_MORE_IMPORTANT_GOAL_POSSIBLE:
+    return "planForMoreImportantGoalPossible";
+  case PlannerTraceCallType::NOTIFY_ACTION_STARTED:
+    return "notifyActionStarted";
+  case PlannerTraceCallType::NOTIFY_ACTION_DONE:
+    return "notifyActionDone";
+  }
+  return "";
+}
+
+
+
+PlannerTraceRecorder::PlannerTraceRecorder(Problem& pProblem,
+                                           const Domain& pDomain)
+  : _problem(pProblem),
+    _domain(pDomain),
+    _origin(std::chrono::steady_clock::now()),
+    _trace(_traceMagic)
+{
+  BinaryWriter writer(_trace);
+  writer.writeUint32(_traceVersion);
+  writer.writeString(domainToBinary(_domain));
+  writer.writeString(problemToBinary(_problem, _domain));
+}
+
+
+bool PlannerTraceRecorder::addFacts(const std::vector<Fact>& pFacts,
+                                    const SetOfCallbacks& pCallbacks,
+                                    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow)
+{
+  auto callBegin = std::chrono::steady_clock::now();
+  bool res = _problem.worldState.addFacts(pFacts, _problem.goalStack, _domain.getSetOfEvents(), pCallbacks,
+                                          _domain.getOntology(), _problem.entities, pNow);
+  _writeCallHeader(PlannerTraceCallType::ADD_FACTS, callBegin, pNow);
+  BinaryWriter writer(_trace);
+  writeFactsInBinary(writer, _toFactPtrs(pFacts));
+  writer.writeBool(res);
+  return res;
+}
+
+
+bool PlannerTraceRecorder::removeFacts(const std::vector<Fact>& pFacts,
+                                       const SetOfCallbacks& pCallbacks,
+                                       const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow)
+{
+  auto callBegin = std::chrono::steady_clock::now();
+  bool res = _problem.worldState.removeFacts(pFacts, _problem.goalStack, _domain.getSetOfEvents(), pCallbacks,
+                                             _domain.getOntology(), _problem.entities, pNow);
+  _writeCallHeader(PlannerTraceCallType::REMOVE_FACTS, callBegin, pNow);
+  BinaryWriter writer(_trace);
+  writeFactsInBinary(writer, _toFactPtrs(pFacts));
+  writer.writeBool(res);
+  return res;
+}
+
+
+void PlannerTraceRecorder::pushBackGoal(const Goal& pGoal,
+                                        const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+                                        int pPriority)
+{
+  auto callBegin = std::chrono::steady_clock::now();
+  _problem.goalStack.pushBackGoal(pGoal, _problem.worldState, _domain.getOntology().constants,
+                                  _problem.entities, pNow, pPriority);
+  _writeCallHeader(PlannerTraceCallType::PUSH_BACK_GOAL, callBegin, pNow);
+  BinaryWriter writer(_trace);
+  writeGoalsInBinary(writer, {{pPriority, {pGoal}}});
+}
+
+
+std::list<ActionInvocationWithGoal> PlannerTraceRecorder::planForMoreImportantGoalPossible(
+    bool pTryToDoMoreOptimalSolution,
+    const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+    const Historical* pGlobalHistorical,
+    LookForAnActionOutputInfos* pLookForAnActionOutputInfosPtr)
+{
+  auto callBegin = std::chrono::steady_clock::now();
+  auto res = ogp::planForMoreImportantGoalPossible(_problem, _domain, pTryToDoMoreOptimalSolution, pNow,
+                                                   pGlobalHistorical, pLookForAnActionOutputInfosPtr);
+  _writeCallHeader(PlannerTraceCallType::PLAN_FOR_MORE_IMPORTANT_GOAL_POSSIBLE, callBegin, pNow);
+  BinaryWriter writer(_trace);
+  writer.writeBool(pTryToDoMoreOptimalSolution);
+  _writePlan(writer, res);
+  return res;
+}
+
+
+void PlannerTraceRecorder::notifyActionStarted(const SetOfCallbacks& pCallbacks,
+                                               const ActionInvocationWithGoal& pActionInvocationWithGoal,
+                                               const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow)
+{
+  auto callBegin = std::chrono::steady_clock::now();
+  ogp::notifyActionStarted(_problem, _domain, pCallbacks, pActionInvocationWithGoal, pNow);
+  _writeCallHeader(PlannerTraceCallType::NOTIFY_ACTION_STARTED, callBegin, pNow);
+  _writeActionInvocation(pActionInvocationWithGoal);
+}
+
+
+bool PlannerTraceRecorder::notifyActionDone(const SetOfCallbacks& pCallbacks,
+                                            const ActionInvocationWithGoal& pOnStepOfPlannerResult,
+                                            const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow,
+                                            LookForAnActionOutputInfos* pLookForAnActionOutputInfosPtr)
+{
+  auto callBegin = std::chrono::steady_clock::now();
+  bool res = ogp::notifyActionDone(_problem, _domain, pCallbacks, pOnStepOfPlannerResult, pNow,
+                                   pLookForAnActionOutputInfosPtr);
+  _writeCallHeader(PlannerTraceCallType::NOTIFY_ACTION_DONE, callBegin, pNow);
+  _writeActionInvocation(pOnStepOfPlannerResult);
+  BinaryWriter writer(_trace);
+  writer.writeBool(res);
+  return res;
+}
+
+
+std::string PlannerTraceRecorder::takeTrace()
+{
+  std::string res;
+  res.swap(_trace);
+  return res;
+}
+
+
+void PlannerTraceRecorder::_writeCallHeader(PlannerTraceCallType pCallType,
+                                            const std::chrono::steady_clock::time_point& pCallBegin,
+                                            const std::unique_ptr<std::chrono::steady_clock::time_point>& pNow)
+{
+  auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - pCallBegin);
+  BinaryWriter writer(_trace);
+  writer.writeUint8(static_cast<std::uint8_t>(pCallType));
+  writer.writeInt64(duration.count());
+  writer.writeBool(static_cast<bool>(pNow));
+  if (pNow)
+    writer.writeInt64(std::chrono::duration_cast<std::chrono::nanoseconds>(*pNow - _origin).count());
+}
+
+
+void PlannerTraceRecorder::_writeActionInvocation(const ActionInvocationWithGoal& pActionInvocationWithGoal)
+{
+  BinaryWriter writer(_trace);
+  const auto& actionInvocation = pActionInvocationWithGoal.actionInvocation;
+  writer.writeString(actionInvocation.actionId);
+  writer.writeUint32(static_cast<std::uint32_t>(actionInvocation.parameters.size()));
+  for (const auto& currParameter : actionInvocation.parameters)
+  {
+    writer.writeString(currParameter.first.name);
+    writer.writeString(currParameter.first.type ? currParameter.first.type->name : "");
+    writer.writeString(currParameter.second.value);
+  }
+  writer.writeInt32(pActionInvocationWithGoal.fromGoalPriority);
+  writer.writeBool(static_cast<bool>(pActionInvocationWithGoal.fromGoal));
+  if (pActionInvocationWithGoal.fromGoal)
+    writeGoalsInBinary(writer, {{pActionInvocationWithGoal.fromGoalPriority, {*pActionInvocationWithGoal.fromGoal}}});
+}
+
+
+
+void replayPlannerTrace(const std::string& pTrace,
+                        const std::function<void(const PlannerTraceCallReplayed&)>& pOnCallReplayed)
+{
+  if (pTrace.compare(0, _traceMagic.size(), _traceMagic) != 0)
+    throw std::runtime_error("The input is not a planner trace");
+  BinaryReader reader(pTrace, _traceMagic.size());
+  auto version = reader.readUint32();
+  if (version != _traceVersion)
+    throw std::runtime_error("Planner trace version " + std::to_string(version) +
+                             " is not supported, the supported version is " + std::to_string(_traceVersion));
+
+  auto domainPtr = binaryToDomain(reader.readString());
+  const Domain& domain = *domainPtr;
+  auto problemPtr = binaryToProblem(reader.readString(), domain);
+  Problem& problem = *problemPtr;
+  const auto& ontology = domain.getOntology();
+  const auto& setOfEvents = domain.getSetOfEvents();
+  const SetOfCallbacks callbacks;
+  const auto origin = std::chrono::steady_clock::now();
+
+  PlannerTraceCallReplayed callReplayed;
+  for (; !reader.isAtEnd(); ++callReplayed.index)
+  {
+    callReplayed.type = static_cast<PlannerTraceCallType>(reader.readUint8());
+    callReplayed.recordedDuration = std::chrono::nanoseconds(reader.readInt64());
+    auto now = _readNow(reader, origin);
+    std::chrono::steady_clock::time_point callBegin;
+
+    switch (callReplayed.type)
+    {
+    case PlannerTraceCallType::ADD_FACTS:
+    case PlannerTraceCallType::REMOVE_FACTS:
+    {
+      auto facts = readFactsFromBinary(reader, ontology, problem.entities);
+      callBegin = std::chrono::steady_clock::now();
+      bool res = callReplayed.type == PlannerTraceCallType::ADD_FACTS ?
+            problem.worldState.addFacts(facts, problem.goalStack, setOfEvents, callbacks, ontology, problem.entities, now) :
+            problem.worldState.removeFacts(facts, problem.goalStack, setOfEvents, callbacks, ontology, problem.entities, now);
+      callReplayed.replayedDuration = std::chrono::steady_clock::now() - callBegin;
+      callReplayed.sameResult = res == reader.readBool();
+      break;
+    }
+    case PlannerTraceCallType::PUSH_BACK_GOAL:
+    {
+      auto goals = readGoalsFromBinary(reader, ontology, problem.entities);
+      callBegin = std::chrono::steady_clock::now();
+      for (const auto& currPriorityToGoals : goals)
+        for (const auto& currGoal : currPriorityToGoals.second)
+          problem.goalStack.pushBackGoal(currGoal, problem.worldState, ontology.constants, problem.entities,
+                                         now, currPriorityToGoals.first);
+      callReplayed.replayedDuration = std::chrono::steady_clock::now() - callBegin;
+      callReplayed.sameResult = true;
+      break;
+    }
+    case PlannerTraceCallType::PLAN_FOR_MORE_IMPORTANT_GOAL_POSSIBLE:
+    {
+      bool tryToDoMoreOptimalSolution = reader.readBool();
+      callBegin = std::chrono::steady_clock::now();
+      auto plan = planForMoreImportantGoalPossible(problem, domain, tryToDoMoreOptimalSolution, now);
+      callReplayed.replayedDuration = std::chrono::steady_clock::now() - callBegin;
+      callReplayed.sameResult = _isSamePlan(reader, plan);
+      break;
+    }
+    case PlannerTraceCallType::NOTIFY_ACTION_STARTED:
+    {
+      auto actionInvocation = _readActionInvocation(reader, problem, domain);
+      callBegin = std::chrono::steady_clock::now();
+      notifyActionStarted(problem, domain, callbacks, actionInvocation, now);
+      callReplayed.replayedDuration = std::chrono::steady_clock::now() - callBegin;
+      callReplayed.sameResult = true;
+      break;
+    }
+    case PlannerTraceCallType::NOTIFY_ACTION_DONE:
+    {
+      auto actionInvocation = _readActionInvocation(reader, problem, domain);
+      callBegin = std::chrono::steady_clock::now();
+      bool res = notifyActionDone(problem, domain, callbacks, actionInvocation, now);
+      callReplayed.replayedDuration = std::chrono::steady_clock::now() - callBegin;
+      callReplayed.sameResult = res == reader.readBool();
+      break;
+    }
+    default:
+      throw std::runtime_error("Invalid call in the planner trace");
+    }
+    pOnCallReplayed(callReplayed);
+  }
+}
+
+
+} // !ogp
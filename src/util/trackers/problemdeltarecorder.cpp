@@ -0,0 +1,154 @@
+#include <orderedgoalsplanner/util/trackers/problemdeltarecorder.hpp>
+#include <stdexcept>
+#include <vector>
+#include <orderedgoalsplanner/types/domain.hpp>
+#include <orderedgoalsplanner/types/goal.hpp>
+#include <orderedgoalsplanner/types/problem.hpp>
+#include "../serializer/binaryformat.hpp"
+
+
+namespace ogp
+{
+namespace
+{
+const std::string _deltaLogMagic = "OGPD";
+const std::uint32_t _deltaLogVersion = 1;
+
+enum class DeltaEntryType : std::uint8_t
+{
+  FACTS_ADDED,
+  FACTS_REMOVED,
+  GOALS_CHANGED,
+  ACTION_DONE
+};
+
+
+void _writeFacts(std::string& pEntries,
+                 DeltaEntryType pEntryType,
+                 const std::vector<const Fact*>& pFacts)
+{
+  if (pFacts.empty())
+    return;
+  BinaryWriter writer(pEntries);
+  writer.writeUint8(static_cast<std::uint8_t>(pEntryType));
+  writeFactsInBinary(writer, pFacts);
+}
+
+}
+
+
+ProblemDeltaRecorder::ProblemDeltaRecorder(const Problem& pProblem)
+  : _problem(pProblem),
+    _entries(),
+    _actionToNumberOfTimeAlreadyLogged(pProblem.historical.getActionToNumberOfTimeAlreadyDone()),
+    _onFactsAddedConnection(
+      pProblem.worldState.onFactsAdded.connectUnsafe([this](const std::set<Fact>& pFacts) {
+  // A fact can be added and removed in the same modification, so only the final state is logged
+  std::vector<const Fact*> factsPresent;
+  const auto& facts = _problem.worldState.facts();
+  for (const auto& currFact : pFacts)
+    if (facts.count(currFact) > 0)
+      factsPresent.emplace_back(&currFact);
+  _writeFacts(_entries, DeltaEntryType::FACTS_ADDED, factsPresent);
+})),
+    _onFactsRemovedConnection(
+      pProblem.worldState.onFactsRemoved.connectUnsafe([this](const std::set<Fact>& pFacts) {
+  std::vector<const Fact*> factsAbsent;
+  const auto& facts = _problem.worldState.facts();
+  for (const auto& currFact : pFacts)
+    if (facts.count(currFact) == 0)
+      factsAbsent.emplace_back(&currFact);
+  _writeFacts(_entries, DeltaEntryType::FACTS_REMOVED, factsAbsent);
+})),
+    _onGoalsChangedConnection(
+      pProblem.goalStack.onGoalsChanged.connectUnsafe([this](const std::map<int, std::vector<Goal>>& pGoals) {
+  BinaryWriter writer(_entries);
+  writer.writeUint8(static_cast<std::uint8_t>(DeltaEntryType::GOALS_CHANGED));
+  writeGoalsInBinary(writer, pGoals);
+}))
+{
+}
+
+
+ProblemDeltaRecorder::~ProblemDeltaRecorder()
+{
+  _onFactsAddedConnection.disconnect();
+  _onFactsRemovedConnection.disconnect();
+  _onGoalsChangedConnection.disconnect();
+}
+
+
+std::string ProblemDeltaRecorder::takeDeltaLog()
+{
+  // The historical has no observable so it is compared with what was already logged
+  BinaryWriter entriesWriter(_entries);
+  for (const auto& currAction : _problem.historical.getActionToNumberOfTimeAlreadyDone())
+  {
+    auto& nbOfTimeAlreadyLogged = _actionToNumberOfTimeAlreadyLogged[currAction.first];
+    if (currAction.second <= nbOfTimeAlreadyLogged)
+      continue;
+    entriesWriter.writeUint8(static_cast<std::uint8_t>(DeltaEntryType::ACTION_DONE));
+    entriesWriter.writeString(currAction.first);
+    entriesWriter.writeUint32(static_cast<std::uint32_t>(currAction.second - nbOfTimeAlreadyLogged));
+    nbOfTimeAlreadyLogged = currAction.second;
+  }
+
+  if (_entries.empty())
+    return "";
+  std::string res = _deltaLogMagic;
+  BinaryWriter writer(res);
+  writer.writeUint32(_deltaLogVersion);
+  res += _entries;
+  _entries.clear();
+  return res;
+}
+
+
+void applyProblemDeltaLog(const std::string& pDeltaLog,
+                          Problem& pProblem,
+                          const Domain& pDomain)
+{
+  if (pDeltaLog.empty())
+    return;
+  if (pDeltaLog.compare(0, _deltaLogMagic.size(), _deltaLogMagic) != 0)
+    throw std::runtime_error("The input is not a problem delta log");
+  BinaryReader reader(pDeltaLog, _deltaLogMagic.size());
+  auto version = reader.readUint32();
+  if (version != _deltaLogVersion)
+    throw std::runtime_error("Problem delta log version " + std::to_string(version) +
+                             " is not supported, the supported version is " + std::to_string(_deltaLogVersion));
+
+  const auto& ontology = pDomain.getOntology();
+  while (!reader.isAtEnd())
+  {
+    auto entryType = static_cast<DeltaEntryType>(reader.readUint8());
+    switch (entryType)
+    {
+    case DeltaEntryType::FACTS_ADDED:
+      pProblem.worldState.replicateModifications(readFactsFromBinary(reader, ontology, pProblem.entities), {});
+      break;
+    case DeltaEntryType::FACTS_REMOVED:
+      pProblem.worldState.replicateModifications({}, readFactsFromBinary(reader, ontology, pProblem.entities));
+      break;
+    case DeltaEntryType::GOALS_CHANGED:
+    {
+      auto goals = readGoalsFromBinary(reader, ontology, pProblem.entities);
+      pProblem.goalStack.setGoals(goals, pProblem.worldState, ontology.constants, pProblem.entities, {});
+      break;
+    }
+    case DeltaEntryType::ACTION_DONE:
+    {
+      auto actionId = reader.readString();
+      auto nbOfTimeDone = reader.readUint32();
+      for (std::uint32_t i = 0; i < nbOfTimeDone; ++i)
+        pProblem.historical.notifyActionDone(actionId);
+      break;
+    }
+    default:
+      throw std::runtime_error("Invalid entry in the problem delta log");
+    }
+  }
+}
+
+
+} // !ogp
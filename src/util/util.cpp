@@ -1,5 +1,8 @@
 #include <orderedgoalsplanner/util/util.hpp>
 #include <cctype> // For isdigit()
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
 #include <sstream>
 #include <orderedgoalsplanner/types/entity.hpp>
 #include <orderedgoalsplanner/types/parameter.hpp>
@@ -65,27 +68,45 @@ void _unfoldMapWithSet(std::list<std::map<Parameter, Entity>>& pOutMap,
 
 // Function to convert a string to either an int or a float and store it in a variant
 Number stringToNumber(const std::string& str) {
-    std::istringstream iss(str);
-
-    // Try to parse as an int first
-    int intValue;
-    if (iss >> intValue && iss.eof()) {
-        return intValue;  // Successfully parsed as an int
-    }
-
-    // Clear error flags and try parsing as a float
-    iss.clear();
-    iss.str(str);
-
-    float floatValue;
-    if (iss >> floatValue && iss.eof()) {
-        return floatValue;  // Successfully parsed as a float
-    }
+    auto res = tryStringToNumber(str);
+    if (res)
+      return *res;
 
     // If neither works, throw an exception
     throw std::invalid_argument("Invalid number format: " + str);
 }
 
+
+std::optional<Number> tryStringToNumber(const std::string& pStr)
+{
+  // Accept the same formats as an extraction from a std::istringstream, without constructing a stream
+  const char* beginPtr = pStr.c_str();
+  const char* endPtr = beginPtr + pStr.size();
+  while (beginPtr != endPtr && std::isspace(static_cast<unsigned char>(*beginPtr)))
+    ++beginPtr;
+  if (beginPtr == endPtr)
+    return {};
+  for (const char* currPtr = beginPtr; currPtr != endPtr; ++currPtr)
+    if (!std::isdigit(static_cast<unsigned char>(*currPtr)) &&
+        *currPtr != '-' && *currPtr != '+' && *currPtr != '.' && *currPtr != 'e' && *currPtr != 'E')
+      return {};
+
+  // Try to parse as an int first
+  char* parsedEndPtr = nullptr;
+  errno = 0;
+  long intValue = std::strtol(beginPtr, &parsedEndPtr, 10);
+  if (parsedEndPtr == endPtr && errno == 0 &&
+      intValue >= std::numeric_limits<int>::min() && intValue <= std::numeric_limits<int>::max())
+    return static_cast<int>(intValue);
+
+  // Then try parsing as a float
+  errno = 0;
+  float floatValue = std::strtof(beginPtr, &parsedEndPtr);
+  if (parsedEndPtr == endPtr && errno == 0)
+    return floatValue;
+  return {};
+}
+
 // Overloaded operator for addition of two Number objects
 Number operator+(const Number& lhs, const Number& rhs) {
     return std::visit([](auto&& l, auto&& r) -> Number {
@@ -172,12 +193,10 @@ std::optional<Entity> plusIntOrStr(const std::optional<Entity>& pNb1,
 {
   if (!pNb1 || !pNb2 || pNb1->type != pNb2->type)
     return {};
-  try
-  {
-    auto nb1 = stringToNumber(pNb1->value);
-    auto nb2 = stringToNumber(pNb2->value);
-    return Entity(numberToString(nb1 + nb2), pNb1->type);
-  } catch (...) {}
+  auto nb1 = pNb1->toNumber();
+  auto nb2 = pNb2->toNumber();
+  if (nb1 && nb2)
+    return Entity(*nb1 + *nb2, pNb1->type);
   return Entity(pNb1->value + pNb2->value, pNb1->type);
 }
 
@@ -187,12 +206,10 @@ std::optional<Entity> minusIntOrStr(const std::optional<Entity>& pNb1,
 {
   if (!pNb1 || !pNb2 || pNb1->type != pNb2->type)
     return {};
-  try
-  {
-    auto nb1 = stringToNumber(pNb1->value);
-    auto nb2 = stringToNumber(pNb2->value);
-    return Entity(numberToString(nb1 - nb2), pNb1->type);
-  } catch (...) {}
+  auto nb1 = pNb1->toNumber();
+  auto nb2 = pNb2->toNumber();
+  if (nb1 && nb2)
+    return Entity(*nb1 - *nb2, pNb1->type);
   return Entity(pNb1->value + "-" + pNb2->value, pNb1->type);
 }
 
@@ -202,33 +219,30 @@ std::optional<Entity> multiplyNbOrStr(const std::optional<Entity>& pNb1,
 {
   if (!pNb1 || !pNb2 || pNb1->type != pNb2->type)
     return {};
-  try
-  {
-    auto nb1 = stringToNumber(pNb1->value);
-    auto nb2 = stringToNumber(pNb2->value);
-    return Entity(numberToString(nb1 * nb2), pNb1->type);
-  } catch (...) {}
+  auto nb1 = pNb1->toNumber();
+  auto nb2 = pNb2->toNumber();
+  if (nb1 && nb2)
+    return Entity(*nb1 * *nb2, pNb1->type);
   return Entity(pNb1->value + "*" + pNb2->value, pNb1->type);
 }
 
 
 bool compIntNb(
-    const std::string& pNb1Str,
+    const Entity& pNb1,
     const Number& pNb2,
     bool pBoolSuperiorOrInferior,
     bool pCanBeEqual)
 {
-  try
-  {
-    auto nb1 = stringToNumber(pNb1Str);
-    if (nb1 == pNb2)
-      return pCanBeEqual;
-    if (pBoolSuperiorOrInferior)
-      return nb1 > pNb2;
-    else
-      return nb1 < pNb2;
-  } catch (...) {}
-  return false;
+  auto nb1Opt = pNb1.toNumber();
+  if (!nb1Opt)
+    return false;
+  const auto& nb1 = *nb1Opt;
+  if (nb1 == pNb2)
+    return pCanBeEqual;
+  if (pBoolSuperiorOrInferior)
+    return nb1 > pNb2;
+  else
+    return nb1 < pNb2;
 }
 
 std::string incrementLastNumberUntilAConditionIsSatisfied(
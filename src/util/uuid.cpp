@@ -4,6 +4,7 @@
 #include <array>
 #include <algorithm>
 #include <functional>
+#include <mutex>
 
 namespace ogp
 {
@@ -26,8 +27,11 @@ std::mt19937 createEngine() {
 static std::mt19937                    gen(createEngine());
 static std::uniform_int_distribution<> dis(0, 15);
 static std::uniform_int_distribution<> dis2(8, 11);
+// The generator is shared, so it is protected for the programs that load domains in several threads
+static std::mutex genMutex;
 
 std::string generateUuid() {
+  std::lock_guard<std::mutex> lock(genMutex);
   std::stringstream ss;
   int i;
   ss << std::hex;
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <orderedgoalsplanner/types/action.hpp>
+#include <orderedgoalsplanner/types/ontology.hpp>
+#include <orderedgoalsplanner/types/setofpredicates.hpp>
+#include <orderedgoalsplanner/types/worldstatemodification.hpp>
+#include <orderedgoalsplanner/util/serializer/deserializefrompddl.hpp>
+#include <algo/actiondataforparallelisation.hpp>
+
+using namespace ogp;
+
+namespace
+{
+
+FactsFootprint _footprintFromPddl(const std::vector<std::string>& pFactStrs,
+                                  const Ontology& pOntology,
+                                  const SetOfEntities& pEntities)
+{
+  FactsFootprint res;
+  for (const auto& currFactStr : pFactStrs)
+    res.addFact(Fact::fromPddl(currFactStr, pOntology, pEntities, {}));
+  res.finalize();
+  return res;
+}
+
+ActionDataForParallelisation _actionData(const Action& pAction)
+{
+  return ActionDataForParallelisation(pAction, ActionInvocationWithGoal("action", std::map<Parameter, Entity>(), {}, 0));
+}
+
+}
+
+
+TEST(Tool, test_factsFootprint)
+{
+  Ontology ontology;
+  ontology.types = SetOfTypes::fromPddl("entity");
+  {
+    std::size_t pos = 0;
+    ontology.predicates = SetOfPredicates::fromPddl("(fact_a ?e - entity)\n"
+                                                    "(fact_b ?e - entity)\n"
+                                                    "fact_c", pos, ontology.types);
+  }
+  auto entities = SetOfEntities::fromPddl("toto titi - entity", ontology.types);
+
+  // Disjoint names
+  auto footprintA = _footprintFromPddl({"(fact_a toto)"}, ontology, entities);
+  auto footprintBC = _footprintFromPddl({"(fact_b toto)", "(fact_c)"}, ontology, entities);
+  EXPECT_FALSE(footprintA.canShareAFactNameWith(footprintBC));
+  EXPECT_FALSE(footprintBC.canShareAFactNameWith(footprintA));
+  EXPECT_FALSE(footprintA.canShareAFactNameWith(FactsFootprint()));
+
+  // Shared names, whatever the arguments of the facts
+  auto footprintAB = _footprintFromPddl({"(fact_a titi)", "(fact_b titi)", "(fact_b toto)"}, ontology, entities);
+  EXPECT_EQ(2u, footprintAB.factNameIds.size());
+  EXPECT_TRUE(footprintA.canShareAFactNameWith(footprintAB));
+  EXPECT_TRUE(footprintAB.canShareAFactNameWith(footprintA));
+  EXPECT_TRUE(footprintAB.canShareAFactNameWith(footprintBC));
+
+  // Different names with the same bit in the mask are told apart by the sorted identifiers
+  const auto bitOfFactA = std::hash<std::string>()("fact_a") % 64;
+  std::string otherFactName;
+  for (std::size_t i = 0; otherFactName.empty(); ++i)
+  {
+    auto currFactName = "fact_" + std::to_string(i);
+    if (std::hash<std::string>()(currFactName) % 64 == bitOfFactA)
+      otherFactName = currFactName;
+  }
+  ontology.predicates.addAll(SetOfPredicates::fromStr(otherFactName, ontology.types));
+  auto footprintOther = _footprintFromPddl({"(" + otherFactName + ")"}, ontology, entities);
+  EXPECT_NE(0u, footprintA.factNamesMask & footprintOther.factNamesMask);
+  EXPECT_FALSE(footprintA.canShareAFactNameWith(footprintOther));
+}
+
+
+TEST(Tool, test_actionFootprintsWithAtStartEffects)
+{
+  Ontology ontology;
+  ontology.predicates = SetOfPredicates::fromStr("fact_a\n"
+                                                 "fact_b\n"
+                                                 "fact_c\n"
+                                                 "fact_d", ontology.types);
+
+  Action actionWithAtStartEffect({}, strToWsModification("fact_c", ontology, {}, {}));
+  actionWithAtStartEffect.effect.worldStateModificationAtStart = strToWsModification("fact_a", ontology, {}, {});
+  Action actionThatAddsFactA({}, strToWsModification("fact_a", ontology, {}, {}));
+  Action actionThatReadsFactB(strToCondition("fact_b", ontology, {}, {}),
+                              strToWsModification("fact_d", ontology, {}, {}));
+
+  auto atStartData = _actionData(actionWithAtStartEffect);
+  auto addFactAData = _actionData(actionThatAddsFactA);
+  auto readFactBData = _actionData(actionThatReadsFactB);
+
+  // The facts modified at start are in the effects footprint
+  EXPECT_EQ(2u, atStartData.getEffectsFootprint().factNameIds.size());
+  EXPECT_TRUE(atStartData.getConditionFootprint().factNameIds.empty());
+  EXPECT_TRUE(atStartData.getEffectsFootprint().canShareAFactNameWith(addFactAData.getEffectsFootprint()));
+  EXPECT_FALSE(atStartData.getEffectsFootprint().canShareAFactNameWith(readFactBData.getConditionFootprint()));
+  EXPECT_FALSE(atStartData.getEffectsFootprint().canShareAFactNameWith(readFactBData.getEffectsFootprint()));
+
+  // A name written at start is shared, so the exact check is done and it sees the same fact modified
+  EXPECT_FALSE(atStartData.canBeInParallel(addFactAData));
+  EXPECT_FALSE(addFactAData.canBeInParallel(atStartData));
+  // No common name
+  EXPECT_TRUE(atStartData.canBeInParallel(readFactBData));
+  EXPECT_TRUE(readFactBData.canBeInParallel(atStartData));
+}
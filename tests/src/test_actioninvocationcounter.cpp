@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <vector>
+#include <orderedgoalsplanner/types/entity.hpp>
+#include <orderedgoalsplanner/types/parameter.hpp>
+#include <orderedgoalsplanner/types/setoftypes.hpp>
+#include <types/actioninvocationcounter.hpp>
+
+using namespace ogp;
+
+
+TEST(Tool, test_actionInvocationCounter)
+{
+  auto types = SetOfTypes::fromPddl("entity");
+  const auto parameter = Parameter::fromStr("?e - entity", types);
+  const auto entityType = types.nameToType("entity");
+
+  std::vector<ActionInvocation> invocations;
+  for (std::size_t i = 0; i < 20; ++i)
+  {
+    invocations.emplace_back("action_" + std::to_string(i), std::map<Parameter, Entity>());
+    invocations.emplace_back("action_" + std::to_string(i),
+                             std::map<Parameter, Entity>{{parameter, Entity("obj_" + std::to_string(i % 3), entityType)}});
+  }
+
+  // Add invocations that fall in the same slot of the initial table, to force the probing
+  const std::size_t initialMask = 15;
+  const auto slotOfFirst = invocations.front().hash() & initialMask;
+  std::size_t nbOfCollisions = 0;
+  for (std::size_t i = 20; nbOfCollisions < 6; ++i)
+  {
+    ActionInvocation invocation("action_" + std::to_string(i), std::map<Parameter, Entity>());
+    if ((invocation.hash() & initialMask) == slotOfFirst)
+    {
+      invocations.insert(invocations.begin() + static_cast<std::ptrdiff_t>(nbOfCollisions + 1), invocation);
+      ++nbOfCollisions;
+    }
+  }
+
+  // Compare with the counts keyed on the string of the invocations, done before the hash table
+  ActionInvocationCounter counter;
+  std::map<std::string, std::size_t> stringKeyedCounter;
+  for (std::size_t i = 0; i < 3 * invocations.size(); ++i)
+  {
+    const auto& invocation = invocations[(i * 7) % invocations.size()];
+    if (i % 5 != 0)
+    {
+      ++counter[invocation];
+      ++stringKeyedCounter[invocation.toStr()];
+    }
+    else
+    {
+      EXPECT_EQ(stringKeyedCounter[invocation.toStr()], counter[invocation]) << invocation.toStr();
+    }
+  }
+  EXPECT_EQ(invocations.size(), stringKeyedCounter.size());
+  EXPECT_EQ(stringKeyedCounter.size(), counter.size());
+  for (const auto& currInvocation : invocations)
+    EXPECT_EQ(stringKeyedCounter[currInvocation.toStr()], counter[currInvocation]) << currInvocation.toStr();
+  EXPECT_EQ(stringKeyedCounter.size(), counter.size());
+
+  // The lookups of invocations already counted do not grow the table
+  ActionInvocationCounter halfFullCounter;
+  for (std::size_t i = 0; i < 8; ++i)
+    ++halfFullCounter[invocations[i]];
+  EXPECT_EQ(16u, halfFullCounter.nbOfSlots());
+  for (std::size_t i = 0; i < 8; ++i)
+    EXPECT_EQ(1u, halfFullCounter[invocations[i]]);
+  EXPECT_EQ(16u, halfFullCounter.nbOfSlots());
+  EXPECT_EQ(8u, halfFullCounter.size());
+  ++halfFullCounter[invocations[8]];
+  EXPECT_EQ(32u, halfFullCounter.nbOfSlots());
+  EXPECT_EQ(9u, halfFullCounter.size());
+  for (std::size_t i = 0; i < 9; ++i)
+    EXPECT_EQ(1u, halfFullCounter[invocations[i]]);
+}
@@ -215,6 +215,85 @@ void _testAlreadySatisfiedGoal()
 }
 
 
+
+void _testValidatePlan()
+{
+  const std::string action1 = "action1";
+  const std::string action2 = "action2";
+  const std::string action3 = "action3";
+
+  ogp::Ontology ontology;
+  ontology.predicates = ogp::SetOfPredicates::fromStr(_fact_a + "\n" +
+                                                      _fact_b + "\n" +
+                                                      _fact_c, ontology.types);
+
+  std::map<std::string, ogp::Action> actions;
+  actions.emplace(action1, ogp::Action({}, _worldStateModification_fromStr(_fact_a, ontology)));
+  actions.emplace(action2, ogp::Action(_condition_fromStr(_fact_a + " & " + _fact_c, ontology),
+                                       _worldStateModification_fromStr(_fact_b, ontology)));
+  actions.emplace(action3, ogp::Action({}, _worldStateModification_fromStr("!" + _fact_a, ontology)));
+
+  ogp::Domain domain(std::move(actions), ontology);
+  ogp::Problem problem;
+  _setGoalsForAPriority(problem, {_goal(_fact_b, ontology)}, ontology.constants);
+  _addFact(problem.worldState, _fact_c,  problem.goalStack, ontology);
+
+  auto copiedProblem = problem;
+  auto parallelPlan = ogp::parallelPlanForEveryGoals(copiedProblem, domain, _now, nullptr);
+  EXPECT_EQ("valid", ogp::validatePlan(parallelPlan, problem, domain).toStr());
+
+  auto planFromPddl = ogp::pddlToParallelPlan(ogp::parallelPlanToPddl(parallelPlan, domain), domain, problem.entities);
+  EXPECT_EQ(ogp::parallelPlanToStr(parallelPlan), ogp::parallelPlanToStr(planFromPddl));
+  EXPECT_TRUE(ogp::validatePlan(planFromPddl, problem, domain).isValid());
+
+  _removeFact(problem.worldState, _fact_c,  problem.goalStack, ontology);
+  auto validationResult = ogp::validatePlan(parallelPlan, problem, domain);
+  ASSERT_TRUE(validationResult.failingStepIndex);
+  EXPECT_EQ(1u, *validationResult.failingStepIndex);
+  EXPECT_EQ(action2, validationResult.failingActionId);
+
+  // Check only the suffix after the first action is done
+  _addFact(problem.worldState, _fact_c,  problem.goalStack, ontology);
+  _addFact(problem.worldState, _fact_a,  problem.goalStack, ontology);
+  EXPECT_TRUE(ogp::validatePlan(parallelPlan, problem, domain, 1).isValid());
+
+  auto planWithInterference = ogp::pddlToParallelPlan("0: (action1) [1]\n"
+                                                      "0: (action3) [1]\n", domain, problem.entities);
+  EXPECT_EQ("invalid at step 0 (action3): interferes with action1",
+            ogp::validatePlan(planWithInterference, problem, domain).toStr());
+  EXPECT_FALSE(_evaluate(planWithInterference, problem, domain));
+}
+
+
+void _testValidatePlanWithOverAllCondition()
+{
+  const std::string action1 = "action1";
+
+  ogp::Ontology ontology;
+  ontology.types = ogp::SetOfTypes::fromPddl("entity");
+  ontology.constants = ogp::SetOfEntities::fromPddl("v1 v2 - entity", ontology.types);
+  ontology.predicates = ogp::SetOfPredicates::fromStr(_fact_a + "(?e - entity)\n" +
+                                                      _fact_b, ontology.types);
+
+  std::map<std::string, ogp::Action> actions;
+  std::vector<ogp::Parameter> act1Parameters{_parameter("?e - entity", ontology)};
+  ogp::Action actionObj1({}, _worldStateModification_fromStr(_fact_b, ontology, act1Parameters));
+  actionObj1.overAllCondition = _condition_fromStr(_fact_a + "(?e)", ontology, act1Parameters);
+  actionObj1.parameters = std::move(act1Parameters);
+  actions.emplace(action1, std::move(actionObj1));
+
+  ogp::Domain domain(std::move(actions), ontology);
+  ogp::Problem problem;
+  _addFact(problem.worldState, _fact_a + "(v1)",  problem.goalStack, ontology);
+
+  EXPECT_EQ("valid", ogp::validatePlan(ogp::pddlToParallelPlan("0: (action1 v1) [1]\n", domain, problem.entities),
+                                       problem, domain).toStr());
+  EXPECT_EQ("invalid at step 0 (action1): over all condition not satisfied",
+            ogp::validatePlan(ogp::pddlToParallelPlan("0: (action1 v2) [1]\n", domain, problem.entities),
+                              problem, domain).toStr());
+}
+
+
 }
 
 
@@ -225,4 +304,6 @@ TEST(Planner, test_evaluator)
   _testEvaluateWithFirstActionAlreadyDone();
   _testEvaluateWithOneOfFirstActionAlreadyDone();
   _testAlreadySatisfiedGoal();
+  _testValidatePlan();
+  _testValidatePlanWithOverAllCondition();
 }
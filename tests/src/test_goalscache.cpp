@@ -172,5 +172,22 @@ TEST(Tool, test_goalsCache)
     EXPECT_EQ( "action1, action2, action3, action4", _actionIdsToStr(problem.goalStack.getActionsPredecessors()));
     EXPECT_EQ("soe_from_constructor|event, soe_from_constructor|event_2", _actionIdsToStr(problem.goalStack.getEventsPredecessors()));
   }
-}
 
+  {
+    auto goal = ogp::Goal::fromStr("fact_d", domainOntology, entities);
+    goal.refreshIfNeeded(domain);
+    auto clonedGoal = goal.clone();
+    const Goal& constGoal = goal;
+    const Goal& constClonedGoal = *clonedGoal;
+    EXPECT_EQ(&constGoal.objective(), &constClonedGoal.objective());
+    EXPECT_EQ(&constGoal.getActionsPredecessors(), &constClonedGoal.getActionsPredecessors());
+    EXPECT_EQ(goal, *clonedGoal);
+    EXPECT_TRUE(clonedGoal->canActionSatisfyThisGoal(action2));
+
+    // Modifying the objective of the clone must not modify the objective of the original goal
+    clonedGoal->objective();
+    EXPECT_NE(&constGoal.objective(), &constClonedGoal.objective());
+    EXPECT_EQ(goal, *clonedGoal);
+    EXPECT_EQ("fact_d", goal.toStr());
+  }
+}
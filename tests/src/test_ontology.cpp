@@ -38,6 +38,15 @@ void _test_setOfTypes()
                          "c3 - citroen\n"
                          "location",
                          setOfTypes.toStr());
+
+  auto c3Type = setOfTypes.nameToType("c3");
+  EXPECT_TRUE(c3Type->isA(*c3Type));
+  EXPECT_TRUE(c3Type->isA(*setOfTypes.nameToType("citroen")));
+  EXPECT_TRUE(c3Type->isA(*setOfTypes.nameToType("object")));
+  EXPECT_FALSE(c3Type->isA(*setOfTypes.nameToType("ferrari")));
+  EXPECT_FALSE(c3Type->isA(*setOfTypes.nameToType("location")));
+  EXPECT_FALSE(setOfTypes.nameToType("voiture")->isA(*c3Type));
+  EXPECT_TRUE(setOfTypes.nameToType("maison")->isA(*setOfTypes.nameToType("object")));
 }
 
 
@@ -114,6 +114,26 @@ std::string _parallelPlanPddl(ogp::Problem& pProblem,
   return ogp::parallelPlanToPddl(ogp::parallelPlanForEveryGoals(pProblem, pDomain, pNow, pGlobalHistorical), pDomain);
 }
 
+#ifdef ORDEREDGOALSPLANNER_STATISTICS
+/// Number of copies of the problem done to convert the sequential plan to a parallel plan.
+std::size_t _nbOfProblemCopiesToParallelise(const ogp::Problem& pProblem,
+                                            const ogp::Domain& pDomain)
+{
+  ogp::PlannerStatistics sequentialStatistics;
+  ogp::PlannerOptions sequentialOptions;
+  sequentialOptions.statisticsPtr = &sequentialStatistics;
+  auto sequentialProblem = pProblem;
+  ogp::planForEveryGoals(sequentialProblem, pDomain, _now, sequentialOptions);
+
+  ogp::PlannerStatistics parallelStatistics;
+  ogp::PlannerOptions parallelOptions;
+  parallelOptions.statisticsPtr = &parallelStatistics;
+  auto parallelProblem = pProblem;
+  ogp::parallelPlanForEveryGoals(parallelProblem, pDomain, _now, parallelOptions, nullptr);
+  return parallelStatistics.nbOfProblemCopies - sequentialStatistics.nbOfProblemCopies;
+}
+#endif
+
 
 void _goalsToDoInParallel()
 {
@@ -284,6 +304,80 @@ void _goalsToDoInParallelWithConflitingEffects()
 }
 
 
+
+void _chainOfDependentActions()
+{
+  const std::string action1 = "action1";
+  const std::string action2 = "action2";
+  const std::string action3 = "action3";
+  const std::string action4 = "action4";
+
+  ogp::Ontology ontology;
+  ontology.predicates = ogp::SetOfPredicates::fromStr(_fact_a + "\n" +
+                                                      _fact_b + "\n" +
+                                                      _fact_c + "\n" +
+                                                      _fact_d, ontology.types);
+
+  std::map<std::string, ogp::Action> actions;
+  actions.emplace(action1, ogp::Action({}, _worldStateModification_fromStr(_fact_a, ontology)));
+  actions.emplace(action2, ogp::Action(_condition_fromStr(_fact_a, ontology),
+                                       _worldStateModification_fromStr(_fact_b, ontology)));
+  actions.emplace(action3, ogp::Action(_condition_fromStr(_fact_b, ontology),
+                                       _worldStateModification_fromStr(_fact_c, ontology)));
+  actions.emplace(action4, ogp::Action({}, _worldStateModification_fromStr(_fact_d, ontology)));
+
+  ogp::Domain domain(std::move(actions), ontology);
+  ogp::Problem problem;
+  _setGoalsForAPriority(problem, {_goal(_fact_a + " & " + _fact_b + " & " + _fact_c + " & " + _fact_d, ontology)}, ontology.constants);
+
+  auto sequentialProblem = problem;
+  EXPECT_EQ("action1, action4\n"
+            "action2\n"
+            "action3", _parallelPlanStr(problem, domain, _now));
+
+#ifdef ORDEREDGOALSPLANNER_STATISTICS
+  // The dependency graph copies the problem twice, the fallback would copy it once more per candidate simulated
+  EXPECT_EQ(2u, _nbOfProblemCopiesToParallelise(sequentialProblem, domain));
+#endif
+}
+
+
+void _fallbackWhenAnEventSatisfiesAPrecondition()
+{
+  const std::string action1 = "action1";
+  const std::string action2 = "action2";
+  const std::string action3 = "action3";
+
+  ogp::Ontology ontology;
+  ontology.predicates = ogp::SetOfPredicates::fromStr(_fact_a + "\n" +
+                                                      _fact_b + "\n" +
+                                                      _fact_c + "\n" +
+                                                      _fact_d, ontology.types);
+
+  std::map<std::string, ogp::Action> actions;
+  actions.emplace(action1, ogp::Action({}, _worldStateModification_fromStr(_fact_a, ontology)));
+  actions.emplace(action2, ogp::Action(_condition_fromStr(_fact_b, ontology),
+                                       _worldStateModification_fromStr(_fact_c, ontology)));
+  actions.emplace(action3, ogp::Action({}, _worldStateModification_fromStr(_fact_d, ontology)));
+
+  // The dependency graph does not see that action2 needs action1 because fact_b is added by an event
+  ogp::SetOfEvents setOfEvents;
+  setOfEvents.add(ogp::Event(_condition_fromStr(_fact_a, ontology),
+                             _worldStateModification_fromStr(_fact_b, ontology)));
+
+  ogp::Domain domain(std::move(actions), ontology, setOfEvents);
+  ogp::Problem problem;
+  _setGoalsForAPriority(problem, {_goal(_fact_c + " & " + _fact_d, ontology)}, ontology.constants);
+  auto sequentialProblem = problem;
+  EXPECT_EQ("action1, action3\n"
+            "action2", _parallelPlanStr(problem, domain, _now));
+
+#ifdef ORDEREDGOALSPLANNER_STATISTICS
+  EXPECT_LT(2u, _nbOfProblemCopiesToParallelise(sequentialProblem, domain));
+#endif
+}
+
+
 }
 
 
@@ -295,4 +389,6 @@ TEST(Planner, test_parallelPlan)
   _2actionsNotInParallelBecauseFrom2DifferentSkills();
   _moreThan2GoalsInParallel();
   _goalsToDoInParallelWithConflitingEffects();
+  _chainOfDependentActions();
+  _fallbackWhenAnEventSatisfiesAPrecondition();
 }
@@ -1,18 +1,39 @@
 #include <gtest/gtest.h>
+#include <functional>
 #include <orderedgoalsplanner/types/domain.hpp>
 #include <orderedgoalsplanner/types/problem.hpp>
 #include <orderedgoalsplanner/types/ontology.hpp>
 #include <orderedgoalsplanner/types/predicate.hpp>
+#include <orderedgoalsplanner/types/setofcallbacks.hpp>
 #include <orderedgoalsplanner/types/setofentities.hpp>
 #include <orderedgoalsplanner/types/setofpredicates.hpp>
 #include <orderedgoalsplanner/types/worldstatemodification.hpp>
+#include <orderedgoalsplanner/util/serializer/deserializefrombinary.hpp>
 #include <orderedgoalsplanner/util/serializer/deserializefrompddl.hpp>
+#include <orderedgoalsplanner/util/serializer/serializeinbinary.hpp>
 #include <orderedgoalsplanner/util/serializer/serializeinpddl.hpp>
+#include <orderedgoalsplanner/util/trackers/plannertrace.hpp>
+#include <orderedgoalsplanner/util/trackers/problemdeltarecorder.hpp>
+#include <orderedgoalsplanner/orderedgoalsplanner.hpp>
 
 namespace
 {
 
 
+std::string _runtimeErrorMessage(const std::function<void()>& pFunction)
+{
+  try
+  {
+    pFunction();
+  }
+  catch (const std::runtime_error& pError)
+  {
+    return pError.what();
+  }
+  return "";
+}
+
+
 void _test_pddlSerializationParts()
 {
   ogp::Ontology ontology;
@@ -506,6 +527,111 @@ void _test_loadPddlDomain()
     std::cout << outProblemPddl2 << std::endl;
     ASSERT_TRUE(false);
   }
+
+  // reload the prepared domain and the problem from binary snapshots
+  auto domainBinary = ogp::domainToBinary(*domainAndProblemPtrs.domainPtr);
+  auto domain3Ptr = ogp::binaryToDomain(domainBinary);
+  EXPECT_EQ(expectedDomain, ogp::domainToPddl(*domain3Ptr));
+  EXPECT_EQ(domainAndProblemPtrs.domainPtr->printSuccessionCache(), domain3Ptr->printSuccessionCache());
+  EXPECT_EQ(domainBinary, ogp::domainToBinary(*domain3Ptr));
+  EXPECT_THROW(ogp::binaryToDomain(domainBinary.substr(0, domainBinary.size() / 2)), std::runtime_error);
+  EXPECT_THROW(ogp::binaryToDomain("(define (domain d))"), std::runtime_error);
+  // a corrupted number of symbols is reported as a std::runtime_error instead of allocating a huge buffer
+  auto corruptedDomainBinary = domainBinary;
+  const std::size_t domainNbOfSymbolsPos = 4 + 4 + 4 + domain3Ptr->getName().size();
+  corruptedDomainBinary.replace(domainNbOfSymbolsPos, 4, "\xFF\xFF\xFF\xFF");
+  EXPECT_THROW(ogp::binaryToDomain(corruptedDomainBinary), std::runtime_error);
+
+  auto problemBinary = ogp::problemToBinary(*domainAndProblemPtrs.problemPtr, *domainAndProblemPtrs.domainPtr);
+  auto problem3Ptr = ogp::binaryToProblem(problemBinary, *domain3Ptr);
+  auto outProblemPddl3 = ogp::problemToPddl(*problem3Ptr, *domain3Ptr);
+  if (outProblemPddl3 != expectedProblem)
+  {
+    std::cout << outProblemPddl3 << std::endl;
+    ASSERT_TRUE(false);
+  }
+  EXPECT_THROW(ogp::binaryToProblem(problemBinary.substr(0, problemBinary.size() / 2), *domain3Ptr), std::runtime_error);
+  EXPECT_THROW(ogp::binaryToProblem("(define (problem p))", *domain3Ptr), std::runtime_error);
+  EXPECT_THROW(ogp::binaryToProblem(problemBinary, loadedDomains.at("building")), std::runtime_error);
+  auto corruptedProblemBinary = problemBinary;
+  const std::size_t problemNbOfSymbolsPos = 4 + 4 + 4 + problem3Ptr->name.size() + 4 + domain3Ptr->getName().size();
+  corruptedProblemBinary.replace(problemNbOfSymbolsPos, 4, "\xFF\xFF\xFF\xFF");
+  EXPECT_THROW(ogp::binaryToProblem(corruptedProblemBinary, *domain3Ptr), std::runtime_error);
+
+  // replicate the execution of a plan with delta logs
+  auto& problem1 = *domainAndProblemPtrs.problemPtr;
+  const auto& domain1 = *domainAndProblemPtrs.domainPtr;
+  ogp::ProblemDeltaRecorder deltaRecorder(problem1);
+  EXPECT_EQ("", deltaRecorder.takeDeltaLog());
+  const std::unique_ptr<std::chrono::steady_clock::time_point> now;
+  const ogp::SetOfCallbacks callbacks;
+  std::string firstDeltaLog;
+  for (std::size_t i = 0; i < 10; ++i)
+  {
+    auto plan = ogp::planForMoreImportantGoalPossible(problem1, domain1, true, now);
+    if (plan.empty())
+      break;
+    ogp::notifyActionDone(problem1, domain1, callbacks, plan.front(), now);
+    EXPECT_EQ(ogp::planToStr(plan), ogp::planToStr(ogp::planForMoreImportantGoalPossible(*problem3Ptr, *domain3Ptr, true, now)));
+    auto deltaLog = deltaRecorder.takeDeltaLog();
+    ogp::applyProblemDeltaLog(deltaLog, *problem3Ptr, *domain3Ptr);
+    if (firstDeltaLog.empty())
+      firstDeltaLog = deltaLog;
+    EXPECT_EQ(ogp::problemToPddl(problem1, domain1), ogp::problemToPddl(*problem3Ptr, *domain3Ptr));
+    EXPECT_EQ(problem1.historical.getActionToNumberOfTimeAlreadyDone(),
+              problem3Ptr->historical.getActionToNumberOfTimeAlreadyDone());
+  }
+  EXPECT_NE(expectedProblem, ogp::problemToPddl(problem1, domain1));
+  EXPECT_THROW(ogp::applyProblemDeltaLog("OGPB", problem1, domain1), std::runtime_error);
+
+  // record the calls done on the planner and replay them
+  auto& problem2 = *outDomainAndProblemPtrs2.problemPtr;
+  const auto& domain2InProblem = *outDomainAndProblemPtrs2.domainPtr;
+  ogp::PlannerTraceRecorder traceRecorder(problem2, domain2InProblem);
+  auto trace = traceRecorder.takeTrace();
+  const auto& ontology2 = domain2InProblem.getOntology();
+  traceRecorder.removeFacts({ogp::Fact::fromPddl("(on-site w s1)", ontology2, problem2.entities, {})}, callbacks, now);
+  traceRecorder.addFacts({ogp::Fact::fromPddl("(on-site w s1)", ontology2, problem2.entities, {})}, callbacks, now);
+  std::size_t nbOfCallsRecorded = 2;
+  for (std::size_t i = 0; i < 10; ++i)
+  {
+    auto plan = traceRecorder.planForMoreImportantGoalPossible(true, now);
+    ++nbOfCallsRecorded;
+    if (plan.empty())
+      break;
+    traceRecorder.notifyActionStarted(callbacks, plan.front(), now);
+    traceRecorder.notifyActionDone(callbacks, plan.front(), now);
+    nbOfCallsRecorded += 2;
+  }
+  trace += traceRecorder.takeTrace();
+  EXPECT_EQ("", traceRecorder.takeTrace());
+  EXPECT_EQ(ogp::problemToPddl(problem1, domain1), ogp::problemToPddl(problem2, domain2InProblem));
+
+  std::size_t nbOfCallsReplayed = 0;
+  ogp::replayPlannerTrace(trace, [&](const ogp::PlannerTraceCallReplayed& pCall) {
+    EXPECT_EQ(nbOfCallsReplayed, pCall.index);
+    EXPECT_TRUE(pCall.sameResult) << ogp::plannerTraceCallTypeToStr(pCall.type);
+    ++nbOfCallsReplayed;
+  });
+  EXPECT_EQ(nbOfCallsRecorded, nbOfCallsReplayed);
+  EXPECT_THROW(ogp::replayPlannerTrace(trace.substr(0, trace.size() - 1), [](const ogp::PlannerTraceCallReplayed&) {}),
+               std::runtime_error);
+  EXPECT_THROW(ogp::replayPlannerTrace("OGPD", [](const ogp::PlannerTraceCallReplayed&) {}), std::runtime_error);
+
+  // each binary format is rejected by the magic check of the loaders of the other formats
+  ASSERT_FALSE(firstDeltaLog.empty());
+  for (const auto* currBlobPtr : {&problemBinary, &firstDeltaLog, &trace})
+    EXPECT_EQ("The input is not a binary snapshot of a domain",
+              _runtimeErrorMessage([&] { ogp::binaryToDomain(*currBlobPtr); }));
+  for (const auto* currBlobPtr : {&domainBinary, &firstDeltaLog, &trace})
+    EXPECT_EQ("The input is not a binary snapshot",
+              _runtimeErrorMessage([&] { ogp::binaryToProblem(*currBlobPtr, *domain3Ptr); }));
+  for (const auto* currBlobPtr : {&domainBinary, &problemBinary, &trace})
+    EXPECT_EQ("The input is not a problem delta log",
+              _runtimeErrorMessage([&] { ogp::applyProblemDeltaLog(*currBlobPtr, *problem3Ptr, *domain3Ptr); }));
+  for (const auto* currBlobPtr : {&domainBinary, &problemBinary, &firstDeltaLog})
+    EXPECT_EQ("The input is not a planner trace",
+              _runtimeErrorMessage([&] { ogp::replayPlannerTrace(*currBlobPtr, [](const ogp::PlannerTraceCallReplayed&) {}); }));
 }
 
 }
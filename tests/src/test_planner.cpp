@@ -7,6 +7,7 @@
 #include <orderedgoalsplanner/util/serializer/deserializefrompddl.hpp>
 #include <orderedgoalsplanner/util/trackers/goalsremovedtracker.hpp>
 #include <orderedgoalsplanner/util/print.hpp>
+#include "util/plannerstatisticscollector.hpp"
 #include "docexamples/test_planningDummyExample.hpp"
 #include "docexamples/test_planningExampleWithAPreconditionSolve.hpp"
 
@@ -670,6 +671,394 @@ void _disjunctivePrecondition()
 }
 
 
+/// Domain with two actions to add fact_a, "action1" adds only fact_a and "action2" adds also fact_b.
+ogp::Domain _twoActionsToAddFactADomain(ogp::Ontology& pOntology)
+{
+  pOntology.predicates = ogp::SetOfPredicates::fromStr("fact_a\n"
+                                                       "fact_b", pOntology.types);
+
+  std::map<std::string, ogp::Action> actions;
+  actions.emplace("action1", ogp::Action({}, ogp::strToWsModification("fact_a", pOntology, {}, {})));
+  actions.emplace("action2", ogp::Action({}, ogp::strToWsModification("fact_a & fact_b", pOntology, {}, {})));
+  return ogp::Domain(std::move(actions), pOntology);
+}
+
+void _plannerStatistics()
+{
+  ogp::Ontology ontology;
+  auto domain = _twoActionsToAddFactADomain(ontology);
+
+  ogp::Problem problem;
+  auto& entities = problem.entities;
+  _setGoalsForAPriority(problem, {ogp::Goal::fromStr("fact_a", ontology, entities)}, ontology.constants);
+
+  ogp::LookForAnActionOutputInfos lookForAnActionOutputInfos;
+  EXPECT_EQ(nullptr, lookForAnActionOutputInfos.statistics());
+  lookForAnActionOutputInfos.enableStatistics();
+#ifdef ORDEREDGOALSPLANNER_STATISTICS
+  auto plan = ogp::planForMoreImportantGoalPossible(problem, domain, true, _now, nullptr, &lookForAnActionOutputInfos);
+  ASSERT_FALSE(plan.empty());
+  const auto* statisticsPtr = lookForAnActionOutputInfos.statistics();
+  ASSERT_NE(nullptr, statisticsPtr);
+  EXPECT_EQ(2u, statisticsPtr->nbOfCandidateActionsEvaluated);
+  EXPECT_LE(2u, statisticsPtr->nbOfLookForAPossibleEffectCalls);
+  EXPECT_EQ(2u, statisticsPtr->nbOfRollouts);
+  EXPECT_LE(2u, statisticsPtr->nbOfProblemCopies);
+  EXPECT_LT(0u, statisticsPtr->nbOfCacheMisses);
+  EXPECT_LT(0u, statisticsPtr->nbOfGoalSatisfactionCacheMisses);
+  EXPECT_LT(0, statisticsPtr->candidateSearchDuration.count());
+  EXPECT_LE(statisticsPtr->rolloutDuration.count(), statisticsPtr->candidateSearchDuration.count());
+
+  // The caches are now up to date
+  auto nbOfCacheHits = statisticsPtr->nbOfCacheHits;
+  ogp::planForMoreImportantGoalPossible(problem, domain, true, _now, nullptr, &lookForAnActionOutputInfos);
+  EXPECT_LT(nbOfCacheHits, statisticsPtr->nbOfCacheHits);
+  EXPECT_LT(0u, statisticsPtr->nbOfGoalSatisfactionCacheHits);
+  EXPECT_EQ(4u, statisticsPtr->nbOfRollouts);
+
+  // Nothing is collected without the output infos
+  ogp::planForMoreImportantGoalPossible(problem, domain, true, _now);
+  EXPECT_EQ(4u, statisticsPtr->nbOfRollouts);
+
+  notifyActionDone(problem, domain, _emptyCallbacks, plan.front(), _now, &lookForAnActionOutputInfos);
+  EXPECT_LT(0, statisticsPtr->effectApplicationDuration.count());
+  EXPECT_NE(std::string::npos, statisticsPtr->toStr().find("rollouts: 4\n"));
+#else
+  EXPECT_EQ(nullptr, lookForAnActionOutputInfos.statistics());
+#endif
+}
+
+void _nestedPlannerStatisticsCollectors()
+{
+#ifdef ORDEREDGOALSPLANNER_STATISTICS
+  ogp::PlannerStatistics outerStatistics;
+  ogp::PlannerStatistics innerStatistics;
+  innerStatistics.nbOfRollouts = 5;
+  {
+    ogp::PlannerStatisticsCollector outerCollector(&outerStatistics);
+    ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfRollouts);
+    {
+      ogp::PlannerStatisticsCollector innerCollector(&innerStatistics);
+      ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfRollouts);
+      ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfRollouts);
+    }
+    {
+      ogp::PlannerStatisticsCollector sameCollector(&outerStatistics);
+      ORDEREDGOALSPLANNER_STATISTICS_INCREMENT(nbOfRollouts);
+    }
+    EXPECT_EQ(&outerStatistics, ogp::PlannerStatisticsCollector::current());
+  }
+  EXPECT_EQ(nullptr, ogp::PlannerStatisticsCollector::current());
+  // What the inner statistics already held is not added to the outer ones
+  EXPECT_EQ(7u, innerStatistics.nbOfRollouts);
+  EXPECT_EQ(4u, outerStatistics.nbOfRollouts);
+#endif
+}
+
+void _plannerOptions()
+{
+  ogp::Ontology ontology;
+  auto domain = _twoActionsToAddFactADomain(ontology);
+
+  EXPECT_EQ(ogp::PlannerSearchMode::GREEDY, ogp::plannerSearchModeFromStr(ogp::plannerSearchModeToStr(ogp::PlannerSearchMode::GREEDY)));
+  EXPECT_EQ(ogp::PlannerSearchMode::ROLLOUT_OPTIMAL, ogp::plannerSearchModeFromStr("rollout-optimal"));
+  EXPECT_ANY_THROW(ogp::plannerSearchModeFromStr("optimal"));
+
+  ogp::PlannerStatistics statistics;
+  ogp::PlannerOptions options;
+  options.statisticsPtr = &statistics;
+  options.searchMode = ogp::PlannerSearchMode::GREEDY;
+  {
+    ogp::Problem problem;
+    _setGoalsForAPriority(problem, {ogp::Goal::fromStr("fact_a", ontology, problem.entities)}, ontology.constants);
+    EXPECT_EQ(1u, ogp::planForEveryGoals(problem, domain, _now, options).size());
+  }
+#ifdef ORDEREDGOALSPLANNER_STATISTICS
+  EXPECT_EQ(2u, statistics.nbOfCandidateActionsEvaluated);
+  EXPECT_EQ(0u, statistics.nbOfRollouts);
+#endif
+
+  options.searchMode = ogp::PlannerSearchMode::ROLLOUT_OPTIMAL;
+  options.maxRolloutDepth = 1;
+  {
+    ogp::Problem problem;
+    _setGoalsForAPriority(problem, {ogp::Goal::fromStr("fact_a", ontology, problem.entities)}, ontology.constants);
+    auto plan = ogp::planForEveryGoals(problem, domain, _now, options);
+    ASSERT_EQ(1u, plan.size());
+    EXPECT_EQ("action1", plan.front().actionInvocation.actionId);
+  }
+#ifdef ORDEREDGOALSPLANNER_STATISTICS
+  EXPECT_EQ(2u, statistics.nbOfRollouts);
+  EXPECT_EQ(0u, statistics.nbOfTruncatedRollouts);
+#endif
+}
+
+void _plannerOptionsTruncatedRollouts()
+{
+  ogp::Ontology ontology;
+  ontology.predicates = ogp::SetOfPredicates::fromStr("fact_a\n"
+                                                      "fact_b\n"
+                                                      "fact_c\n"
+                                                      "fact_d", ontology.types);
+
+  // "action_dead_end" blocks action_c, the rollout after it fails at once.
+  // The rollout after "action_a" needs 2 actions so it is truncated by the maximum rollout depth.
+  std::map<std::string, ogp::Action> actions;
+  actions.emplace("action_a", ogp::Action({}, ogp::strToWsModification("fact_a", ontology, {}, {})));
+  actions.emplace("action_dead_end", ogp::Action({}, ogp::strToWsModification("fact_a & fact_d", ontology, {}, {})));
+  actions.emplace("action_b", ogp::Action(ogp::strToCondition("fact_a", ontology, {}, {}),
+                                          ogp::strToWsModification("fact_b", ontology, {}, {})));
+  actions.emplace("action_c", ogp::Action(ogp::strToCondition("fact_b & !fact_d", ontology, {}, {}),
+                                          ogp::strToWsModification("fact_c", ontology, {}, {})));
+  ogp::Domain domain(std::move(actions), ontology);
+
+  ogp::PlannerStatistics statistics;
+  ogp::PlannerOptions options;
+  options.statisticsPtr = &statistics;
+  options.maxRolloutDepth = 1;
+  ogp::Problem problem;
+  _setGoalsForAPriority(problem, {ogp::Goal::fromStr("fact_c", ontology, problem.entities)}, ontology.constants);
+  EXPECT_EQ("action_a, action_b, action_c", ogp::planToStr(ogp::planForEveryGoals(problem, domain, _now, options)));
+#ifdef ORDEREDGOALSPLANNER_STATISTICS
+  EXPECT_EQ(2u, statistics.nbOfRollouts);
+  EXPECT_EQ(1u, statistics.nbOfTruncatedRollouts);
+#endif
+}
+
+void _planIndependentGoalsInParallel()
+{
+  ogp::Ontology ontology;
+  ontology.predicates = ogp::SetOfPredicates::fromStr("fact_a\n"
+                                                      "fact_b\n"
+                                                      "fact_c\n"
+                                                      "fact_d\n"
+                                                      "fact_e", ontology.types);
+
+  std::map<std::string, ogp::Action> actions;
+  actions.emplace("action_a", ogp::Action({}, ogp::strToWsModification("fact_a", ontology, {}, {})));
+  actions.emplace("action_b", ogp::Action(ogp::strToCondition("fact_a", ontology, {}, {}),
+                                          ogp::strToWsModification("fact_b", ontology, {}, {})));
+  actions.emplace("action_c", ogp::Action({}, ogp::strToWsModification("fact_c", ontology, {}, {})));
+  actions.emplace("action_d", ogp::Action(ogp::strToCondition("fact_c", ontology, {}, {}),
+                                          ogp::strToWsModification("fact_d", ontology, {}, {})));
+  actions.emplace("action_e", ogp::Action(ogp::strToCondition("fact_a", ontology, {}, {}),
+                                          ogp::strToWsModification("fact_e", ontology, {}, {})));
+  ogp::Domain domain(std::move(actions), ontology);
+
+  // fact_e, the less important goal, is in the partition of fact_b because they both depend on fact_a
+  auto planWithOptions = [&](const ogp::PlannerOptions& pOptions, std::list<ogp::Goal>& pGoalsDone) {
+    ogp::Problem problem;
+    problem.goalStack.setGoals({{10, {ogp::Goal::fromStr("fact_b", ontology, problem.entities)}},
+                                {5, {ogp::Goal::fromStr("fact_d", ontology, problem.entities),
+                                     ogp::Goal::fromStr("fact_a", ontology, problem.entities)}},
+                                {1, {ogp::Goal::fromStr("fact_e", ontology, problem.entities)}}},
+                               problem.worldState, ontology.constants, problem.entities, _now);
+    auto res = ogp::planToStr(ogp::planForEveryGoals(problem, domain, _now, pOptions, nullptr, &pGoalsDone), ", ");
+    EXPECT_TRUE(problem.goalStack.goals().empty());
+    return res;
+  };
+
+  ogp::PlannerOptions options;
+  std::list<ogp::Goal> sequentialGoalsDone;
+  auto sequentialPlan = planWithOptions(options, sequentialGoalsDone);
+  EXPECT_EQ("action_a, action_b, action_c, action_d, action_e", sequentialPlan);
+
+  ogp::PlannerStatistics statistics;
+  options.statisticsPtr = &statistics;
+  options.planIndependentGoalsInParallel = true;
+  options.nbOfThreads = 2;
+  std::list<ogp::Goal> parallelGoalsDone;
+  EXPECT_EQ(sequentialPlan, planWithOptions(options, parallelGoalsDone));
+  EXPECT_EQ(sequentialGoalsDone.size(), parallelGoalsDone.size());
+#ifdef ORDEREDGOALSPLANNER_STATISTICS
+  EXPECT_EQ(2u, statistics.nbOfGoalPartitionsPlannedInParallel);
+#endif
+}
+
+
+void _actionInvocationEqualityAndHash()
+{
+  ogp::Ontology ontology;
+  ontology.types = ogp::SetOfTypes::fromPddl("entity");
+  ontology.constants = ogp::SetOfEntities::fromPddl("v1 v2 - entity", ontology.types);
+  auto parameter = ogp::Parameter::fromStr("?p - entity", ontology.types);
+  auto v1 = ogp::Entity::fromUsage("v1", ontology, {}, {});
+  auto v2 = ogp::Entity::fromUsage("v2", ontology, {}, {});
+
+  ogp::ActionInvocation actionWithV1("action", std::map<ogp::Parameter, ogp::Entity>{{parameter, v1}});
+  ogp::ActionInvocation otherActionWithV1("action", std::map<ogp::Parameter, ogp::Entity>{{parameter, v1}});
+  ogp::ActionInvocation actionWithV2("action", std::map<ogp::Parameter, ogp::Entity>{{parameter, v2}});
+  EXPECT_TRUE(actionWithV1 == otherActionWithV1);
+  EXPECT_EQ(actionWithV1.hash(), otherActionWithV1.hash());
+  EXPECT_TRUE(actionWithV1 != actionWithV2);
+  EXPECT_NE(actionWithV1.hash(), actionWithV2.hash());
+
+  // Like the string of the invocations, only the names and the values are compared, not the types
+  ogp::ActionInvocation untypedActionWithV1("action", std::map<ogp::Parameter, ogp::Entity>{{ogp::Parameter(parameter.name, {}),
+                                                                                                ogp::Entity(v1.value, {})}});
+  EXPECT_EQ(actionWithV1.toStr(), untypedActionWithV1.toStr());
+  EXPECT_TRUE(actionWithV1 == untypedActionWithV1);
+  EXPECT_EQ(actionWithV1.hash(), untypedActionWithV1.hash());
+  EXPECT_TRUE(untypedActionWithV1 != actionWithV2);
+}
+
+
+void _repairPlan()
+{
+  ogp::Ontology ontology;
+  ontology.predicates = ogp::SetOfPredicates::fromStr("fact_a\n"
+                                                      "fact_b\n"
+                                                      "fact_c", ontology.types);
+
+  std::map<std::string, ogp::Action> actions;
+  actions.emplace("action_a", ogp::Action({}, ogp::strToWsModification("fact_a", ontology, {}, {})));
+  actions.emplace("action_b", ogp::Action(ogp::strToCondition("fact_a", ontology, {}, {}),
+                                          ogp::strToWsModification("fact_b", ontology, {}, {})));
+  actions.emplace("action_c", ogp::Action(ogp::strToCondition("fact_b", ontology, {}, {}),
+                                          ogp::strToWsModification("fact_c", ontology, {}, {})));
+  ogp::Domain domain(std::move(actions), ontology);
+
+  ogp::Problem problem;
+  problem.goalStack.setGoals({ogp::Goal::fromStr("fact_c", ontology, problem.entities)},
+                             problem.worldState, ontology.constants, problem.entities, _now);
+  auto problemForPlanning = problem;
+  auto plan = ogp::planForEveryGoals(problemForPlanning, domain, _now);
+  EXPECT_EQ("action_a, action_b, action_c", ogp::planToStr(plan, ", "));
+
+  // The first action is done, the rest of the plan is kept without searching
+  ogp::notifyActionDone(problem, domain, _emptyCallbacks, plan.front(), _now);
+  plan.pop_front();
+  ogp::PlannerStatistics statistics;
+  ogp::PlannerOptions options;
+  options.statisticsPtr = &statistics;
+  std::size_t nbOfActionsKept = 0;
+  auto problemForRepair = problem;
+  EXPECT_EQ("action_b, action_c", ogp::planToStr(ogp::repairPlan(plan, problemForRepair, domain, _now, options, nullptr, &nbOfActionsKept), ", "));
+  EXPECT_EQ(2u, nbOfActionsKept);
+  EXPECT_EQ(0u, statistics.nbOfCandidateActionsEvaluated);
+  EXPECT_TRUE(problemForRepair.goalStack.goals().empty());
+
+  // An external change breaks the first action of the plan
+  problem.worldState.removeFact(ogp::Fact("fact_a", false, ontology, {}, {}), problem.goalStack, domain.getSetOfEvents(),
+                                _emptyCallbacks, ontology, problem.entities, _now);
+  problemForRepair = problem;
+  EXPECT_EQ("action_a, action_b, action_c", ogp::planToStr(ogp::repairPlan(plan, problemForRepair, domain, _now, options, nullptr, &nbOfActionsKept), ", "));
+  EXPECT_EQ(0u, nbOfActionsKept);
+
+  // An external change satisfies the goal
+  problem.worldState.addFact(ogp::Fact("fact_c", false, ontology, {}, {}), problem.goalStack, domain.getSetOfEvents(),
+                             _emptyCallbacks, ontology, problem.entities, _now);
+  problemForRepair = problem;
+  EXPECT_EQ("", ogp::planToStr(ogp::repairPlan(plan, problemForRepair, domain, _now), ", "));
+}
+
+
+void _repairPlanOnlyForTheBrokenGoal()
+{
+  ogp::Ontology ontology;
+  ontology.predicates = ogp::SetOfPredicates::fromStr("fact_a\n"
+                                                      "fact_b\n"
+                                                      "fact_c\n"
+                                                      "fact_d\n"
+                                                      "fact_e", ontology.types);
+
+  std::map<std::string, ogp::Action> actions;
+  actions.emplace("action_a", ogp::Action({}, ogp::strToWsModification("fact_a", ontology, {}, {})));
+  actions.emplace("action_b", ogp::Action(ogp::strToCondition("fact_a", ontology, {}, {}),
+                                          ogp::strToWsModification("fact_b", ontology, {}, {})));
+  actions.emplace("action_c", ogp::Action(ogp::strToCondition("fact_b", ontology, {}, {}),
+                                          ogp::strToWsModification("fact_c", ontology, {}, {})));
+  actions.emplace("action_d", ogp::Action({}, ogp::strToWsModification("fact_d", ontology, {}, {})));
+  actions.emplace("action_e", ogp::Action({}, ogp::strToWsModification("fact_e", ontology, {}, {})));
+  actions.emplace("action_e_from_d", ogp::Action(ogp::strToCondition("fact_d", ontology, {}, {}),
+                                                 ogp::strToWsModification("fact_e", ontology, {}, {})));
+  ogp::Domain domain(std::move(actions), ontology);
+
+  ogp::Problem problem;
+  problem.goalStack.pushBackGoal(ogp::Goal::fromStr("fact_c", ontology, problem.entities),
+                                 problem.worldState, ontology.constants, problem.entities, _now, 10);
+  problem.goalStack.pushBackGoal(ogp::Goal::fromStr("fact_e", ontology, problem.entities),
+                                 problem.worldState, ontology.constants, problem.entities, _now, 9);
+  auto problemForPlanning = problem;
+  auto plan = ogp::planForEveryGoals(problemForPlanning, domain, _now);
+  EXPECT_EQ("action_a, action_b, action_c, action_e", ogp::planToStr(plan, ", "));
+
+  // The previous plan reached the second goal in another way than the one the planner would choose now
+  auto plannedGoalEPtr = plan.back().fromGoal->clone();
+  plan.pop_back();
+  plan.emplace_back("action_d", std::map<ogp::Parameter, ogp::Entity>(), plannedGoalEPtr->clone(), 9);
+  plan.emplace_back("action_e_from_d", std::map<ogp::Parameter, ogp::Entity>(), plannedGoalEPtr->clone(), 9);
+
+  // An external change breaks the actions of the first goal, the actions of the second goal are kept
+  ogp::notifyActionDone(problem, domain, _emptyCallbacks, plan.front(), _now);
+  plan.pop_front();
+  problem.worldState.removeFact(ogp::Fact("fact_a", false, ontology, {}, {}), problem.goalStack, domain.getSetOfEvents(),
+                                _emptyCallbacks, ontology, problem.entities, _now);
+  std::size_t nbOfActionsKept = 0;
+  auto problemForRepair = problem;
+  EXPECT_EQ("action_a, action_b, action_c, action_d, action_e_from_d",
+            ogp::planToStr(ogp::repairPlan(plan, problemForRepair, domain, _now, {}, nullptr, &nbOfActionsKept), ", "));
+  EXPECT_EQ(0u, nbOfActionsKept);
+  EXPECT_TRUE(problemForRepair.goalStack.goals().empty());
+
+  // An external change breaks the actions of the second goal, only this goal is planned again
+  problem.worldState.addFact(ogp::Fact("fact_a", false, ontology, {}, {}), problem.goalStack, domain.getSetOfEvents(),
+                             _emptyCallbacks, ontology, problem.entities, _now);
+  plan.erase(std::next(plan.begin(), 2));
+  problemForRepair = problem;
+  EXPECT_EQ("action_b, action_c, action_e",
+            ogp::planToStr(ogp::repairPlan(plan, problemForRepair, domain, _now, {}, nullptr, &nbOfActionsKept), ", "));
+  EXPECT_EQ(2u, nbOfActionsKept);
+  EXPECT_TRUE(problemForRepair.goalStack.goals().empty());
+}
+
+
+void _planForEveryGoalsStreaming()
+{
+  ogp::Ontology ontology;
+  ontology.predicates = ogp::SetOfPredicates::fromStr("fact_a\n"
+                                                      "fact_b\n"
+                                                      "fact_c", ontology.types);
+
+  std::map<std::string, ogp::Action> actions;
+  actions.emplace("action_a", ogp::Action({}, ogp::strToWsModification("fact_a", ontology, {}, {})));
+  actions.emplace("action_b", ogp::Action(ogp::strToCondition("fact_a", ontology, {}, {}),
+                                          ogp::strToWsModification("fact_b", ontology, {}, {})));
+  actions.emplace("action_c", ogp::Action({}, ogp::strToWsModification("fact_c", ontology, {}, {})));
+  ogp::Domain domain(std::move(actions), ontology);
+
+  ogp::Problem problem;
+  problem.goalStack.setGoals({{10, {ogp::Goal::fromStr("fact_b", ontology, problem.entities)}},
+                              {5, {ogp::Goal::fromStr("fact_c", ontology, problem.entities)}}},
+                             problem.worldState, ontology.constants, problem.entities, _now);
+
+  auto problemForPlanning = problem;
+  auto plan = ogp::planForEveryGoals(problemForPlanning, domain, _now);
+  EXPECT_EQ("action_a, action_b, action_c", ogp::planToStr(plan, ", "));
+
+  std::list<ogp::ActionInvocationWithGoal> streamedPlan;
+  auto problemForStreaming = problem;
+  ogp::planForEveryGoalsStreaming(problemForStreaming, domain, [&](ogp::ActionInvocationWithGoal&& pAction) {
+    streamedPlan.emplace_back(std::move(pAction));
+    return ogp::ContinueOrBreak::CONTINUE;
+  }, _now);
+  EXPECT_EQ(ogp::planToStr(plan, ", "), ogp::planToStr(streamedPlan, ", "));
+  EXPECT_TRUE(problemForStreaming.goalStack.goals().empty());
+
+  // Stop after the first action, the problem is only modified by that action
+  streamedPlan.clear();
+  problemForStreaming = problem;
+  ogp::planForEveryGoalsStreaming(problemForStreaming, domain, [&](ogp::ActionInvocationWithGoal&& pAction) {
+    streamedPlan.emplace_back(std::move(pAction));
+    return ogp::ContinueOrBreak::BREAK;
+  }, _now);
+  EXPECT_EQ("action_a", ogp::planToStr(streamedPlan, ", "));
+  EXPECT_EQ(2u, problemForStreaming.goalStack.goals().size());
+}
+
+
+
+
 }
 
 
@@ -694,4 +1083,13 @@ TEST(Planner, test_planner)
   _planToMove();
   _disjunctiveGoal();
   _disjunctivePrecondition();
+  _plannerStatistics();
+  _nestedPlannerStatisticsCollectors();
+  _plannerOptions();
+  _plannerOptionsTruncatedRollouts();
+  _planIndependentGoalsInParallel();
+  _actionInvocationEqualityAndHash();
+  _repairPlan();
+  _repairPlanOnlyForTheBrokenGoal();
+  _planForEveryGoalsStreaming();
 }
@@ -0,0 +1,89 @@
+#include "plannerusingexternaldata.hpp"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <plannerserver.hpp>
+
+
+namespace
+{
+
+bool _startsWith(const std::string& pStr,
+                 const std::string& pPrefix)
+{
+  return pStr.compare(0, pPrefix.size(), pPrefix) == 0;
+}
+
+}
+
+
+TEST_F(PlannerUsingExternalData, test_plannerServer_validRequests)
+{
+  const auto directory = PlannerUsingExternalData::dataPath + "/simple";
+  ogp::PlannerServer server;
+  EXPECT_EQ("ok move-pickup", server.handleRequest("load-domain " + directory + "/domain.pddl"));
+  EXPECT_EQ("ok move-pickup-problem", server.handleRequest("  load-problem   " + directory + "/problem.pddl \r\n"));
+  EXPECT_EQ("ok (at robot1 locationA) (at-object box1 locationB)", server.handleRequest("facts"));
+
+  EXPECT_EQ("ok (move robot1 locationA locationB)", server.handleRequest("next-action"));
+  EXPECT_EQ("ok", server.handleRequest("action-started (move robot1 locationA locationB)"));
+  EXPECT_EQ("ok", server.handleRequest("action-done (move robot1 locationA locationB)"));
+  EXPECT_EQ("ok (at robot1 locationB) (at-object box1 locationB)", server.handleRequest("facts"));
+
+  EXPECT_EQ("ok changed", server.handleRequest("patch-facts (not (at-object box1 locationB)) (at-object box1 locationC)"));
+  EXPECT_EQ("ok unchanged", server.handleRequest("patch-facts (at-object box1 locationC)"));
+  EXPECT_EQ("ok (move robot1 locationB locationA)", server.handleRequest("next-action"));
+
+  EXPECT_EQ("ok", server.handleRequest("clear-goals"));
+  EXPECT_EQ("ok", server.handleRequest("next-action"));
+  EXPECT_EQ("ok", server.handleRequest("push-goal 10 (at robot1 locationC)"));
+  EXPECT_EQ("ok (move robot1 locationB locationC)", server.handleRequest("next-action"));
+
+  EXPECT_EQ("ok", server.handleRequest("set-facts (at robot1 locationC)"));
+  EXPECT_EQ("ok (at robot1 locationC)", server.handleRequest("facts"));
+
+  EXPECT_FALSE(server.isQuitRequested());
+  EXPECT_EQ("ok", server.handleRequest("quit"));
+  EXPECT_TRUE(server.isQuitRequested());
+}
+
+
+TEST_F(PlannerUsingExternalData, test_plannerServer_malformedRequests)
+{
+  const auto directory = PlannerUsingExternalData::dataPath + "/simple";
+  ogp::PlannerServer server;
+  EXPECT_EQ("error No problem is loaded", server.handleRequest("facts"));
+  EXPECT_EQ("error No problem is loaded", server.handleRequest("next-action"));
+  EXPECT_TRUE(_startsWith(server.handleRequest("load-domain " + directory + "/not_existing.pddl"), "error "));
+  EXPECT_TRUE(_startsWith(server.handleRequest("load-problem " + directory + "/problem.pddl"), "error "));
+
+  EXPECT_EQ("ok move-pickup", server.handleRequest("load-domain " + directory + "/domain.pddl"));
+  EXPECT_EQ("ok move-pickup-problem", server.handleRequest("load-problem " + directory + "/problem.pddl"));
+  for (const auto& currRequest : {"patch-facts (at robot1", "patch-facts (unknown-predicate robot1)",
+                                  "set-facts (at robot1 unknownLocation)", "push-goal (at robot1",
+                                  "push-goal high (at robot1 locationC)",
+                                  "action-done (move robot1 locationA locationB)"})
+  {
+    auto response = server.handleRequest(currRequest);
+    EXPECT_TRUE(_startsWith(response, "error ")) << currRequest << " -> " << response;
+    EXPECT_EQ(std::string::npos, response.find('\n')) << currRequest;
+  }
+  // The world has not been modified by the rejected requests
+  EXPECT_EQ("ok (at robot1 locationA) (at-object box1 locationB)", server.handleRequest("facts"));
+  EXPECT_FALSE(server.isQuitRequested());
+}
+
+
+TEST_F(PlannerUsingExternalData, test_plannerServer_unknownRequests)
+{
+  ogp::PlannerServer server;
+  EXPECT_EQ("error Unknown command \"fly\"", server.handleRequest("fly to the moon"));
+  EXPECT_EQ("error Unknown command \"\"", server.handleRequest("   "));
+  EXPECT_EQ("error Unknown command \"QUIT\"", server.handleRequest("QUIT"));
+  EXPECT_FALSE(server.isQuitRequested());
+
+  std::istringstream input("facts\n\nunknown\nquit\nfacts\n");
+  std::ostringstream output;
+  ogp::runPlannerServerOnStreams(server, input, output);
+  EXPECT_EQ("error No problem is loaded\nerror Unknown command \"unknown\"\nok\n", output.str());
+  EXPECT_TRUE(server.isQuitRequested());
+}
@@ -68,6 +68,10 @@ TEST(Tool, test_setOfFacts)
     auto factWithParam = ogp::Fact::fromStr("pred_name5(?p1)=titi_const", ontology, entities, parameters);
     EXPECT_EQ("[pred_name5(toto)=titi_const]", factToFacts.find(factWithParam).toStr());
     EXPECT_EQ("[pred_name5(toto2)=titi, pred_name5(toto)=titi, pred_name5(toto)=titi_const]", factToFacts.find(factWithParam, true).toStr());
+    EXPECT_EQ(3, factToFacts.estimateNbOfMatchingFacts(factWithParam));
+    EXPECT_EQ(2, factToFacts.estimateNbOfMatchingFacts(ogp::Fact::fromStr("pred_name5(toto)=titi", ontology, entities, {})));
+    EXPECT_EQ(0, factToFacts.estimateNbOfMatchingFacts(ogp::Fact::fromStr("pred_name5(toto3)=titi", ontology, entities, {})));
+    EXPECT_EQ(0, factToFacts.estimateNbOfMatchingFacts(fact1));
   }
 
   auto factCopied = fact3;
@@ -87,4 +91,16 @@ TEST(Tool, test_setOfFacts)
     EXPECT_EQ("[]", factToFacts.find(factWithParam).toStr());
     EXPECT_EQ("[]", factToFacts.find(factWithParam, true).toStr());
   }
+
+  // facts are ordered by the string of their arguments
+  {
+    auto factA = ogp::Fact::fromStr("pred_name3(toto, titi)", ontology, entities, {});
+    auto factB = ogp::Fact::fromStr("pred_name3(toto2, titi)", ontology, entities, {});
+    auto factC = ogp::Fact::fromStr("pred_name3(toto, titi2)", ontology, entities, {});
+    EXPECT_TRUE(factA < factB);
+    EXPECT_FALSE(factB < factA);
+    EXPECT_TRUE(factA < factC);
+    EXPECT_TRUE(factC < factB);
+    EXPECT_FALSE(factA < factA);
+  }
 }
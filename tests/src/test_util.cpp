@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <orderedgoalsplanner/types/entity.hpp>
 #include <orderedgoalsplanner/types/parameter.hpp>
+#include <orderedgoalsplanner/util/functionref.hpp>
 #include <orderedgoalsplanner/util/util.hpp>
 
 using namespace ogp;
@@ -83,9 +84,67 @@ void test_autoIncrementOfVersion()
   EXPECT_EQ("didi", incrementAddIdAndReturnValue("didi"));
 }
 
+int _callTwice(ogp::FunctionRef<int (int)> pCallback)
+{
+  return pCallback(pCallback(1));
+}
+
+void _iterateOnValues(ogp::FunctionRef<void (const std::string&)> pCallback)
+{
+  pCallback("a");
+  pCallback("b");
+}
+
+void test_functionRef()
+{
+  int offset = 10;
+  EXPECT_EQ(21, _callTwice([&](int pNb) { return pNb + offset; }));
+  offset = 1;
+  EXPECT_EQ(3, _callTwice([&](int pNb) { return pNb + offset; }));
+
+  std::function<int (int)> doubleFunction = [](int pNb) { return pNb * 2; };
+  EXPECT_EQ(4, _callTwice(doubleFunction));
+
+  std::string res;
+  _iterateOnValues([&](const std::string& pStr) { res += pStr; return res.size(); });
+  EXPECT_EQ("ab", res);
+}
+
+void test_numbers()
+{
+  EXPECT_EQ(Number(12), stringToNumber("12"));
+  EXPECT_EQ(Number(-3), stringToNumber("-3"));
+  EXPECT_EQ(Number(2.5f), stringToNumber("2.5"));
+  EXPECT_TRUE(std::holds_alternative<float>(stringToNumber("2.5")));
+  EXPECT_TRUE(std::holds_alternative<int>(stringToNumber("4")));
+  EXPECT_FALSE(tryStringToNumber(""));
+  EXPECT_FALSE(tryStringToNumber("toto"));
+  EXPECT_FALSE(tryStringToNumber("4a"));
+  EXPECT_FALSE(tryStringToNumber("-"));
+  EXPECT_THROW(stringToNumber("toto"), std::invalid_argument);
+
+  auto nb4 = Entity::createNumberEntity("4");
+  auto nb3 = Entity::createNumberEntity(Number(3));
+  EXPECT_EQ("3", nb3.value);
+  EXPECT_EQ("7", plusIntOrStr(nb4, nb3)->value);
+  EXPECT_EQ(Number(7), *plusIntOrStr(nb4, nb3)->toNumber());
+  EXPECT_EQ("1", minusIntOrStr(nb4, nb3)->value);
+  EXPECT_EQ("12", multiplyNbOrStr(nb4, nb3)->value);
+  EXPECT_TRUE(compIntNb(nb4, Number(3), true, false));
+  EXPECT_FALSE(compIntNb(nb3, Number(3), true, false));
+  EXPECT_TRUE(compIntNb(nb3, Number(3), true, true));
+
+  auto entity = Entity::createNumberEntity("4");
+  entity.setValue(Entity::anyEntityValue());
+  EXPECT_FALSE(entity.toNumber());
+  EXPECT_EQ("a4", plusIntOrStr(Entity("a", nb4.type), nb4)->value);
+}
+
 
 TEST(Tool, test_util)
 {
   test_unfoldMapWithSet();
   test_autoIncrementOfVersion();
+  test_functionRef();
+  test_numbers();
 }
@@ -5,6 +5,8 @@
 #include <orderedgoalsplanner/types/setofevents.hpp>
 #include <orderedgoalsplanner/types/setofpredicates.hpp>
 #include <orderedgoalsplanner/types/worldstate.hpp>
+#include <orderedgoalsplanner/types/worldstatemodification.hpp>
+#include <orderedgoalsplanner/util/serializer/deserializefrompddl.hpp>
 
 using namespace ogp;
 
@@ -61,3 +63,144 @@ TEST(Tool, test_wordstate)
   _modifyFactsFromPddl(worldstate, "(= (pred_e ent_b) undefined)", ontology, entities);
   EXPECT_EQ("(pred_a ent_a)\n(pred_b)", worldstate.factsMapping().toPddl(0, true));
 }
+
+
+TEST(Tool, test_wordstate_applyEffectWithParameters)
+{
+  ogp::WorldState worldstate;
+
+  ogp::Ontology ontology;
+  ontology.types = ogp::SetOfTypes::fromPddl("type1 type2 - entity");
+  ontology.constants = ogp::SetOfEntities::fromPddl("ent_a ent_b - entity", ontology.types);
+
+  {
+    std::size_t pos = 0;
+    ontology.predicates = ogp::SetOfPredicates::fromPddl("(pred_a ?e - entity)\n"
+                                                         "(pred_c ?t1 - type1)\n"
+                                                         "(pred_e ?e - entity) - type1", pos, ontology.types);
+  }
+
+  auto entities = ogp::SetOfEntities::fromPddl("toto titi - type1", ontology.types);
+  _modifyFactsFromPddl(worldstate, "(pred_a ent_a)\n(pred_a ent_b)", ontology, entities);
+
+  auto parameters = ogp::pddlToParameters("(?t - type1 ?e - entity)", ontology.types);
+  std::size_t pos = 0;
+  auto effect = ogp::pddlToWsModification("(and (pred_c ?t) (assign (pred_e ?e) ?t) (forall (?o - entity) (when (pred_a ?o) (not (pred_a ?o)))))",
+                                          pos, ontology, entities, parameters);
+  const std::string effectStr = effect->toStr();
+
+  GoalStack goalStack;
+  const std::map<SetOfEventsId, SetOfEvents> setOfEvents;
+  const SetOfCallbacks callbacks;
+  bool goalChanged = false;
+  std::map<Parameter, Entity> parameterValues{{parameters[0], Entity("toto", ontology.types.nameToType("type1"))},
+                                              {parameters[1], Entity("ent_b", ontology.types.nameToType("entity"))}};
+  worldstate.applyEffect(parameterValues, effect, goalChanged, goalStack, setOfEvents, callbacks, ontology, entities, {});
+  EXPECT_EQ("(pred_c toto)\n(= (pred_e ent_b) toto)", worldstate.factsMapping().toPddl(0, true));
+  // The effect is applied without being modified
+  EXPECT_EQ(effectStr, effect->toStr());
+
+  parameterValues.insert_or_assign(parameters[0], Entity("titi", ontology.types.nameToType("type1")));
+  worldstate.applyEffect(parameterValues, effect, goalChanged, goalStack, setOfEvents, callbacks, ontology, entities, {});
+  EXPECT_EQ("(pred_c titi)\n(pred_c toto)\n(= (pred_e ent_b) titi)", worldstate.factsMapping().toPddl(0, true));
+
+  // The buffers reused from the previous applications do not leak their values
+  _modifyFactsFromPddl(worldstate, "(pred_a ent_a)\n(pred_a titi)", ontology, entities);
+  parameterValues.insert_or_assign(parameters[1], Entity("ent_a", ontology.types.nameToType("entity")));
+  worldstate.applyEffect(parameterValues, effect, goalChanged, goalStack, setOfEvents, callbacks, ontology, entities, {});
+  EXPECT_EQ("(pred_c titi)\n(pred_c toto)\n(= (pred_e ent_a) titi)\n(= (pred_e ent_b) titi)", worldstate.factsMapping().toPddl(0, true));
+  EXPECT_EQ(effectStr, effect->toStr());
+}
+
+
+TEST(Tool, test_wordstate_isGoalSatisfiedWithCache)
+{
+  ogp::WorldState worldstate;
+
+  ogp::Ontology ontology;
+  ontology.types = ogp::SetOfTypes::fromPddl("type1 type2 - entity");
+  {
+    std::size_t pos = 0;
+    ontology.predicates = ogp::SetOfPredicates::fromPddl("(pred_a ?e - entity)\n"
+                                                         "pred_b\n"
+                                                         "(pred_c ?t1 - type1)", pos, ontology.types);
+  }
+  auto entities = ogp::SetOfEntities::fromPddl("toto - type1\n"
+                                               "titi - type2", ontology.types);
+
+  std::size_t pos = 0;
+  auto goalPtr = ogp::pddlToGoal("(and (pred_a toto) (pred_b))", pos, ontology, entities);
+  ASSERT_TRUE(goalPtr);
+  const auto& goal = *goalPtr;
+  EXPECT_FALSE(worldstate.isGoalSatisfied(goal, ontology.constants, entities));
+  _modifyFactsFromPddl(worldstate, "(pred_a toto)\n(pred_c toto)", ontology, entities);
+  EXPECT_FALSE(worldstate.isGoalSatisfied(goal, ontology.constants, entities));
+  _modifyFactsFromPddl(worldstate, "(pred_b)", ontology, entities);
+  EXPECT_TRUE(worldstate.isGoalSatisfied(goal, ontology.constants, entities));
+  _modifyFactsFromPddl(worldstate, "(not (pred_c toto))", ontology, entities);
+  EXPECT_TRUE(worldstate.isGoalSatisfied(goal, ontology.constants, entities));
+
+  // The copies keep the cache valid but they are modified independently
+  auto worldstateCopy = worldstate;
+  _modifyFactsFromPddl(worldstateCopy, "(not (pred_b))", ontology, entities);
+  EXPECT_FALSE(worldstateCopy.isGoalSatisfied(goal, ontology.constants, entities));
+  EXPECT_TRUE(worldstate.isGoalSatisfied(goal, ontology.constants, entities));
+  ogp::WorldState otherWorldstate;
+  EXPECT_FALSE(otherWorldstate.isGoalSatisfied(goal, ontology.constants, entities));
+  worldstateCopy = worldstate;
+  EXPECT_TRUE(worldstateCopy.isGoalSatisfied(goal, ontology.constants, entities));
+
+  // The quantifiers depend on the entities
+  pos = 0;
+  auto existsGoalPtr = ogp::pddlToGoal("(exists (?t - type2) (pred_b))", pos, ontology, entities);
+  ASSERT_TRUE(existsGoalPtr);
+  auto noEntities = ogp::SetOfEntities();
+  EXPECT_FALSE(worldstate.isGoalSatisfied(*existsGoalPtr, ontology.constants, noEntities));
+  EXPECT_TRUE(worldstate.isGoalSatisfied(*existsGoalPtr, ontology.constants, entities));
+  // Other entities with the same number of entities
+  auto otherEntities = ogp::SetOfEntities::fromPddl("toto tata - type1", ontology.types);
+  EXPECT_FALSE(worldstate.isGoalSatisfied(*existsGoalPtr, ontology.constants, otherEntities));
+  otherEntities.add(ogp::Entity("tutu", ontology.types.nameToType("type2")));
+  EXPECT_TRUE(worldstate.isGoalSatisfied(*existsGoalPtr, ontology.constants, otherEntities));
+}
+
+
+TEST(Tool, test_wordstate_existsConjunctionOrderedBySelectivity)
+{
+  ogp::WorldState worldstate;
+
+  ogp::Ontology ontology;
+  ontology.types = ogp::SetOfTypes::fromPddl("type1 - entity");
+  {
+    std::size_t pos = 0;
+    ontology.predicates = ogp::SetOfPredicates::fromPddl("(pred_a ?e - entity)\n"
+                                                         "(pred_b ?e - entity)\n"
+                                                         "(pred_c ?e - entity)", pos, ontology.types);
+  }
+  auto entities = ogp::SetOfEntities::fromPddl("e1 e2 e3 e4 e5 - type1", ontology.types);
+  _modifyFactsFromPddl(worldstate, "(pred_a e1)\n(pred_a e2)\n(pred_a e3)\n(pred_a e4)\n(pred_a e5)\n"
+                                   "(pred_b e2)\n(pred_b e4)\n(pred_b e5)\n"
+                                   "(pred_c e4)", ontology, entities);
+
+  // The most selective fact is the last one of the conjunction, so the evaluation starts from it
+  const auto& setOfFacts = worldstate.factsMapping();
+  std::vector<ogp::Parameter> parameters(1, ogp::Parameter::fromStr("?e - entity", ontology.types));
+  EXPECT_EQ(5, setOfFacts.estimateNbOfMatchingFacts(ogp::Fact::fromStr("pred_a(?e)", ontology, entities, parameters)));
+  EXPECT_EQ(3, setOfFacts.estimateNbOfMatchingFacts(ogp::Fact::fromStr("pred_b(?e)", ontology, entities, parameters)));
+  EXPECT_EQ(1, setOfFacts.estimateNbOfMatchingFacts(ogp::Fact::fromStr("pred_c(?e)", ontology, entities, parameters)));
+
+  std::size_t pos = 0;
+  auto goalPtr = ogp::pddlToGoal("(exists (?e - type1) (and (pred_a ?e) (pred_b ?e) (pred_c ?e)))", pos, ontology, entities);
+  ASSERT_TRUE(goalPtr);
+  EXPECT_TRUE(worldstate.isGoalSatisfied(*goalPtr, ontology.constants, entities));
+
+  // Each fact matches but not for the same entity
+  _modifyFactsFromPddl(worldstate, "(not (pred_b e4))", ontology, entities);
+  EXPECT_FALSE(worldstate.isGoalSatisfied(*goalPtr, ontology.constants, entities));
+  _modifyFactsFromPddl(worldstate, "(pred_c e5)", ontology, entities);
+  EXPECT_TRUE(worldstate.isGoalSatisfied(*goalPtr, ontology.constants, entities));
+
+  // A fact without any match makes the conjunction false
+  _modifyFactsFromPddl(worldstate, "(not (pred_c e4))\n(not (pred_c e5))", ontology, entities);
+  EXPECT_FALSE(worldstate.isGoalSatisfied(*goalPtr, ontology.constants, entities));
+}